@@ -743,4 +743,24 @@ class ErrorObjectIdProvider final : public ObjectIdProvider {
     {{write_command_serialization_methods(command, True)}}
 {% endfor %}
 
+const char* GetWireCmdName(WireCmd cmd) {
+    switch (cmd) {
+        {% for command in cmd_records["command"] %}
+            case WireCmd::{{command.name.CamelCase()}}:
+                return "{{command.name.CamelCase()}}";
+        {% endfor %}
+    }
+    return "Unknown";
+}
+
+const char* GetReturnWireCmdName(ReturnWireCmd cmd) {
+    switch (cmd) {
+        {% for command in cmd_records["return command"] %}
+            case ReturnWireCmd::{{command.name.CamelCase()}}:
+                return "{{command.name.CamelCase()}}";
+        {% endfor %}
+    }
+    return "Unknown";
+}
+
 }  // namespace dawn::wire
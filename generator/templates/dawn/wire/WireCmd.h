@@ -77,6 +77,14 @@ namespace dawn::wire {
         {% endfor %}
     };
 
+    //* The number of commands of each kind, for use by tables indexed by command.
+    constexpr size_t kWireCmdCount = {{cmd_records["command"] | length}};
+    constexpr size_t kReturnWireCmdCount = {{cmd_records["return command"] | length}};
+
+    //* Names of the commands with static storage duration, for instrumentation.
+    const char* GetWireCmdName(WireCmd cmd);
+    const char* GetReturnWireCmdName(ReturnWireCmd cmd);
+
     struct CmdHeader {
         uint64_t commandSize;
     };
@@ -85,6 +93,8 @@ namespace dawn::wire {
     {% set Return = "Return" if is_return_command else "" %}
     {% set Cmd = command.name.CamelCase() + "Cmd" %}
     struct {{Return}}{{Cmd}} {
+        static constexpr {{Return}}WireCmd kCommandId = {{Return}}WireCmd::{{command.name.CamelCase()}};
+
         //* From a filled structure, compute how much size will be used in the serialization buffer.
         size_t GetRequiredSize() const;
 
@@ -78,14 +78,22 @@ namespace dawn::wire::client {
 
             ReturnWireCmd cmdId = *static_cast<const volatile ReturnWireCmd*>(static_cast<const volatile void*>(
                 deserializeBuffer.Buffer() + sizeof(CmdHeader)));
+            uint64_t commandSize = static_cast<const volatile CmdHeader*>(
+                static_cast<const volatile void*>(deserializeBuffer.Buffer()))->commandSize;
             WireResult result = WireResult::FatalError;
-            switch (cmdId) {
-                {% for command in cmd_records["return command"] %}
-                    {% set Suffix = command.name.CamelCase() %}
-                    case ReturnWireCmd::{{Suffix}}:
-                        result = Handle{{Suffix}}(&deserializeBuffer);
-                        break;
-                {% endfor %}
+            {
+                ScopedReceivedCommand instrumentation(mInstrumentation.get(), nullptr,
+                                                      static_cast<size_t>(cmdId),
+                                                      GetReturnWireCmdName(cmdId),
+                                                      static_cast<size_t>(commandSize));
+                switch (cmdId) {
+                    {% for command in cmd_records["return command"] %}
+                        {% set Suffix = command.name.CamelCase() %}
+                        case ReturnWireCmd::{{Suffix}}:
+                            result = Handle{{Suffix}}(&deserializeBuffer);
+                            break;
+                    {% endfor %}
+                }
             }
 
             if (result != WireResult::Success) {
@@ -104,15 +104,23 @@ namespace dawn::wire::server {
 
             WireCmd cmdId = *static_cast<const volatile WireCmd*>(static_cast<const volatile void*>(
                 deserializeBuffer.Buffer() + sizeof(CmdHeader)));
+            uint64_t commandSize = static_cast<const volatile CmdHeader*>(
+                static_cast<const volatile void*>(deserializeBuffer.Buffer()))->commandSize;
             WireResult result;
-            switch (cmdId) {
-                {% for command in cmd_records["command"] %}
-                    case WireCmd::{{command.name.CamelCase()}}:
-                        result = Handle{{command.name.CamelCase()}}(&deserializeBuffer);
-                        break;
-                {% endfor %}
-                default:
-                    result = WireResult::FatalError;
+            {
+                ScopedReceivedCommand instrumentation(mInstrumentation.get(), mPlatform,
+                                                      static_cast<size_t>(cmdId),
+                                                      GetWireCmdName(cmdId),
+                                                      static_cast<size_t>(commandSize));
+                switch (cmdId) {
+                    {% for command in cmd_records["command"] %}
+                        case WireCmd::{{command.name.CamelCase()}}:
+                            result = Handle{{command.name.CamelCase()}}(&deserializeBuffer);
+                            break;
+                    {% endfor %}
+                    default:
+                        result = WireResult::FatalError;
+                }
             }
 
             if (result != WireResult::Success) {
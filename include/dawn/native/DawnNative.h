@@ -214,6 +214,19 @@ DAWN_NATIVE_EXPORT std::vector<const char*> GetTogglesUsed(WGPUDevice device);
 // Backdoor to get the number of lazy clears for testing
 DAWN_NATIVE_EXPORT size_t GetLazyClearCountForTesting(WGPUDevice device);
 
+// Backdoor to get the number of compute dispatches encoded to validate indirect draws for testing
+DAWN_NATIVE_EXPORT size_t GetIndirectDrawValidationDispatchCountForTesting(WGPUDevice device);
+
+// Backdoor to get the number of copies recorded from staging memory to buffers for testing
+DAWN_NATIVE_EXPORT size_t GetStagingBufferCopyCountForTesting(WGPUDevice device);
+
+// Backdoor to get the number of bytes written to staging memory for testing
+DAWN_NATIVE_EXPORT size_t GetStagedByteCountForTesting(WGPUDevice device);
+
+// Backdoor to get the number of times uploads waited to stay in the staging memory budget for
+// testing
+DAWN_NATIVE_EXPORT size_t GetStagingBudgetWaitCountForTesting(WGPUDevice device);
+
 //  Query if texture has been initialized
 DAWN_NATIVE_EXPORT bool IsTextureSubresourceInitialized(
     WGPUTexture texture,
@@ -342,9 +355,42 @@ struct DAWN_NATIVE_EXPORT AllocatorMemoryInfo {
     uint64_t totalAllocatedMemory = 0;
     uint64_t totalLazyAllocatedMemory = 0;
     uint64_t totalLazyUsedMemory = 0;
+    // Peak size of the memory that transient attachments reused from destroyed transient
+    // attachments the GPU may still have been using. Only reported when transient attachments are
+    // aliased.
+    uint64_t peakAliasedTransientMemory = 0;
 };
 DAWN_NATIVE_EXPORT AllocatorMemoryInfo GetAllocatorMemoryInfo(WGPUDevice device);
 
+// Statistics of one of Dawn's memory allocators, or of a group of them. All sizes are in bytes.
+struct DAWN_NATIVE_EXPORT MemoryAllocatorStatistics {
+    // Size of the live allocations, and its high-water mark.
+    uint64_t usedSize = 0;
+    uint64_t peakUsedSize = 0;
+    // Size of the memory held by the allocator to serve the allocations, and its high-water mark.
+    uint64_t reservedSize = 0;
+    uint64_t peakReservedSize = 0;
+    // Number of live allocations.
+    uint64_t allocationCount = 0;
+    // Fraction of the reserved memory that isn't used by live allocations, between 0 and 1.
+    double fragmentation = 0.0;
+};
+
+// Memory statistics of a device, grouped by the allocators that produced them. The statistics are
+// tracked as allocations happen so querying them is cheap enough to be done every frame. The peaks
+// of a group of allocators are the sum of their individual peaks.
+struct DAWN_NATIVE_EXPORT DeviceMemoryStatistics {
+    // Staging memory of the ring buffers used for Queue::WriteBuffer, Queue::WriteTexture, etc.
+    MemoryAllocatorStatistics staging;
+    // Buffer and texture memory of the backend's resource allocator. Vulkan only.
+    MemoryAllocatorStatistics resources;
+    // Sub-allocations of the buddy allocators of the resource allocator. Vulkan only.
+    MemoryAllocatorStatistics buddyAllocators;
+    // Heaps of the resource allocator that are handed out (used) or kept for reuse. Vulkan only.
+    MemoryAllocatorStatistics heapPools;
+};
+DAWN_NATIVE_EXPORT DeviceMemoryStatistics GetDeviceMemoryStatistics(WGPUDevice device);
+
 // Free any unused GPU memory like staging buffers, cached resources, etc. Returns true if there are
 // still objects to delete and ReduceMemoryUsage() should be run again after a short delay to allow
 // submitted work to complete.
@@ -32,6 +32,7 @@
 
 #include <cstdint>
 #include <limits>
+#include <vector>
 
 #include "dawn/wire/dawn_wire_export.h"
 
@@ -64,6 +65,28 @@ class DAWN_WIRE_EXPORT CommandHandler {
     virtual const volatile char* HandleCommands(const volatile char* commands, size_t size) = 0;
 };
 
+// Statistics for one type of command, collected when instrumentation is enabled.
+struct DAWN_WIRE_EXPORT WireCommandStats {
+    // The name of the command, with static storage duration.
+    const char* name = nullptr;
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+    // Total time spent handling the command, only collected for received commands.
+    uint64_t handleTimeNs = 0;
+};
+
+struct DAWN_WIRE_EXPORT WireStats {
+    // Only command types that have been sent or received at least once are present.
+    std::vector<WireCommandStats> sentCommands;
+    std::vector<WireCommandStats> receivedCommands;
+
+    // Each call to HandleCommands is one batch, usually corresponding to one flush of the other
+    // side's CommandSerializer.
+    uint64_t receivedBatchCount = 0;
+    uint64_t receivedBatchBytes = 0;
+    uint64_t maxReceivedBatchBytes = 0;
+};
+
 // Handle struct that are used to uniquely represent an object of a particular type in the wire.
 struct Handle {
     uint32_t id = 0;
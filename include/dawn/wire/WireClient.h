@@ -70,6 +70,25 @@ struct ReservedInstance {
 struct DAWN_WIRE_EXPORT WireClientDescriptor {
     CommandSerializer* serializer;
     client::MemoryTransferService* memoryTransferService = nullptr;
+    // When non-zero, Queue::WriteBuffer and Queue::WriteTexture calls with at least
+    // |writeTransferThreshold| bytes of data are staged in a per-queue ring of
+    // |writeTransferRingSize| bytes created with the MemoryTransferService, and only the ring
+    // offsets go in the command stream. This is only beneficial when the MemoryTransferService
+    // uses memory shared with the server.
+    size_t writeTransferRingSize = 0;
+    size_t writeTransferThreshold = 64 * 1024;
+    // Collect the statistics returned by WireClient::GetStats.
+    bool enableInstrumentation = false;
+    // When set, creating a Sampler, BindGroupLayout or PipelineLayout with the same descriptor
+    // as a live object of that type returns a new reference to the existing object instead of
+    // creating another one on the server. Validation errors and labels are then shared by all the
+    // deduplicated references.
+    bool deduplicateImmutableObjects = false;
+    // When non-zero, the server keeps up to |shaderSourceCacheSize| bytes of the WGSL sources it
+    // received, and creating a shader module with a source that was already sent references it
+    // instead of sending it again. The server's Device then also reuses the parsed module.
+    // Must not be larger than the server's WireServerDescriptor::maxShaderSourceCacheSize.
+    size_t shaderSourceCacheSize = 0;
 };
 
 class DAWN_WIRE_EXPORT WireClient : public CommandHandler {
@@ -92,6 +111,11 @@ class DAWN_WIRE_EXPORT WireClient : public CommandHandler {
 
     Handle GetWireHandle(WGPUDevice device) const;
 
+    // Returns the statistics collected since creation or the last call to ResetStats. Empty
+    // unless WireClientDescriptor::enableInstrumentation was set.
+    WireStats GetStats() const;
+    void ResetStats();
+
     // Disconnects the client.
     // Commands allocated after this point will not be sent.
     void Disconnect();
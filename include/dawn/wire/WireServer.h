@@ -28,12 +28,18 @@
 #ifndef INCLUDE_DAWN_WIRE_WIRESERVER_H_
 #define INCLUDE_DAWN_WIRE_WIRESERVER_H_
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 
 #include "dawn/wire/Wire.h"
 
 struct DawnProcTable;
 
+namespace dawn::platform {
+class Platform;
+}  // namespace dawn::platform
+
 namespace dawn::wire {
 
 namespace server {
@@ -45,6 +51,24 @@ struct DAWN_WIRE_EXPORT WireServerDescriptor {
     const DawnProcTable* procs;
     CommandSerializer* serializer;
     server::MemoryTransferService* memoryTransferService = nullptr;
+    // Collect the statistics returned by WireServer::GetStats.
+    bool enableInstrumentation = false;
+    // When set, a trace event is emitted for the handling of each command.
+    dawn::platform::Platform* platform = nullptr;
+    // The most bytes of WGSL sources the client may register at once with its shader source
+    // cache. Registering more is a fatal error.
+    size_t maxShaderSourceCacheSize = 16 * 1024 * 1024;
+};
+
+// Statistics of the memory used by the server to deserialize commands. Heap allocations are
+// retained across commands so in steady state the allocation count is expected to stay constant.
+struct DAWN_WIRE_EXPORT WireDeserializeAllocatorStats {
+    uint64_t heapAllocationCount = 0;
+    uint64_t heapFreeCount = 0;
+    // Bytes of heap memory currently retained, not counting the inline storage.
+    size_t retainedBytes = 0;
+    // The most bytes used to deserialize a single command.
+    size_t peakBytesInUse = 0;
 };
 
 class DAWN_WIRE_EXPORT WireServer : public CommandHandler {
@@ -73,6 +97,13 @@ class DAWN_WIRE_EXPORT WireServer : public CommandHandler {
     // them periodically to ensure progress on asynchronous work is made.
     bool IsDeviceKnown(WGPUDevice device) const;
 
+    WireDeserializeAllocatorStats GetDeserializeAllocatorStats() const;
+
+    // Returns the statistics collected since creation or the last call to ResetStats. Empty
+    // unless WireServerDescriptor::enableInstrumentation was set.
+    WireStats GetStats() const;
+    void ResetStats();
+
   private:
     std::shared_ptr<server::Server> mImpl;
 };
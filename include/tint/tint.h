@@ -37,6 +37,7 @@
 #include "src/tint/api/common/vertex_pulling_config.h"
 #include "src/tint/api/tint.h"
 #include "src/tint/lang/core/ir/reflection.h"
+#include "src/tint/lang/core/ir/transform/constant_propagation.h"
 #include "src/tint/lang/core/ir/transform/single_entry_point.h"
 #include "src/tint/lang/core/ir/transform/substitute_overrides.h"
 #include "src/tint/lang/core/type/manager.h"
@@ -303,6 +303,10 @@ ResultOrError<Ref<DeviceBase>> AdapterBase::CreateDeviceInternal(
         DAWN_INVALID_IF(!IsPowerOfTwo(allocatorDesc->allocatorHeapBlockSize),
                         "allocator heap block size (%d) isn't a power of two.",
                         allocatorDesc->allocatorHeapBlockSize);
+
+        DAWN_INVALID_IF(allocatorDesc->stagingRingBufferSize % 4 != 0,
+                        "staging ring buffer size (%u) isn't a multiple of 4.",
+                        allocatorDesc->stagingRingBufferSize);
     }
 
     DAWN_INVALID_IF(mAdapterIsConsumed,
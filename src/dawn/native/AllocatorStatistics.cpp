@@ -0,0 +1,88 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/native/AllocatorStatistics.h"
+
+#include <algorithm>
+
+#include "dawn/common/Assert.h"
+
+namespace dawn::native {
+
+void AllocatorStatisticsTracker::AddAllocation(uint64_t size) {
+    mStatistics.usedSize += size;
+    mStatistics.peakUsedSize = std::max(mStatistics.peakUsedSize, mStatistics.usedSize);
+    mStatistics.allocationCount++;
+}
+
+void AllocatorStatisticsTracker::RemoveAllocation(uint64_t size) {
+    DAWN_ASSERT(mStatistics.usedSize >= size);
+    DAWN_ASSERT(mStatistics.allocationCount > 0);
+    mStatistics.usedSize -= size;
+    mStatistics.allocationCount--;
+}
+
+void AllocatorStatisticsTracker::AddReservedMemory(uint64_t size) {
+    mStatistics.reservedSize += size;
+    mStatistics.peakReservedSize =
+        std::max(mStatistics.peakReservedSize, mStatistics.reservedSize);
+}
+
+void AllocatorStatisticsTracker::RemoveReservedMemory(uint64_t size) {
+    DAWN_ASSERT(mStatistics.reservedSize >= size);
+    mStatistics.reservedSize -= size;
+}
+
+MemoryAllocatorStatistics AllocatorStatisticsTracker::Get() const {
+    MemoryAllocatorStatistics statistics = mStatistics;
+    UpdateFragmentation(&statistics);
+    return statistics;
+}
+
+void UpdateFragmentation(MemoryAllocatorStatistics* statistics) {
+    // The used size may exceed the reserved size transiently when an allocator reclaims memory
+    // and stops counting it as used at different times.
+    if (statistics->reservedSize == 0 || statistics->usedSize >= statistics->reservedSize) {
+        statistics->fragmentation = 0.0;
+        return;
+    }
+    statistics->fragmentation =
+        static_cast<double>(statistics->reservedSize - statistics->usedSize) /
+        static_cast<double>(statistics->reservedSize);
+}
+
+void AccumulateAllocatorStatistics(MemoryAllocatorStatistics* statistics,
+                                   const MemoryAllocatorStatistics& other) {
+    statistics->usedSize += other.usedSize;
+    statistics->peakUsedSize += other.peakUsedSize;
+    statistics->reservedSize += other.reservedSize;
+    statistics->peakReservedSize += other.peakReservedSize;
+    statistics->allocationCount += other.allocationCount;
+    UpdateFragmentation(statistics);
+}
+
+}  // namespace dawn::native
@@ -0,0 +1,65 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_NATIVE_ALLOCATORSTATISTICS_H_
+#define SRC_DAWN_NATIVE_ALLOCATORSTATISTICS_H_
+
+#include <cstdint>
+
+#include "dawn/native/DawnNative.h"
+
+namespace dawn::native {
+
+// Keeps the MemoryAllocatorStatistics of an allocator up to date as it allocates and releases
+// memory, so that they can be queried without walking the allocator's data structures.
+class AllocatorStatisticsTracker {
+  public:
+    // Records an allocation of `size` bytes handed out to a client, or its release.
+    void AddAllocation(uint64_t size);
+    void RemoveAllocation(uint64_t size);
+
+    // Records `size` bytes of memory acquired by the allocator to serve allocations, or its
+    // release.
+    void AddReservedMemory(uint64_t size);
+    void RemoveReservedMemory(uint64_t size);
+
+    MemoryAllocatorStatistics Get() const;
+
+  private:
+    MemoryAllocatorStatistics mStatistics;
+};
+
+// Computes the fragmentation of `statistics` from its used and reserved sizes.
+void UpdateFragmentation(MemoryAllocatorStatistics* statistics);
+
+// Adds `other` to `statistics` as if they came from the same allocator.
+void AccumulateAllocatorStatistics(MemoryAllocatorStatistics* statistics,
+                                   const MemoryAllocatorStatistics& other);
+
+}  // namespace dawn::native
+
+#endif  // SRC_DAWN_NATIVE_ALLOCATORSTATISTICS_H_
@@ -89,9 +89,11 @@ ResultOrError<ResourceMemoryAllocation> BuddyMemoryAllocator::Allocate(uint64_t
         std::unique_ptr<ResourceHeapBase> memory;
         DAWN_TRY_ASSIGN(memory, mHeapAllocator->AllocateResourceHeap(mMemoryBlockSize));
         mTrackedSubAllocations[memoryIndex] = {/*refcount*/ 0, std::move(memory)};
+        mStatistics.AddReservedMemory(mMemoryBlockSize);
     }
 
     mTrackedSubAllocations[memoryIndex].refcount++;
+    mStatistics.AddAllocation(originalAllocationSize);
 
     AllocationInfo info;
     info.mBlockOffset = blockOffset;
@@ -115,10 +117,12 @@ void BuddyMemoryAllocator::Deallocate(const ResourceMemoryAllocation& allocation
 
     DAWN_ASSERT(mTrackedSubAllocations[memoryIndex].refcount > 0);
     mTrackedSubAllocations[memoryIndex].refcount--;
+    mStatistics.RemoveAllocation(info.mRequestedSize);
 
     if (mTrackedSubAllocations[memoryIndex].refcount == 0) {
         mHeapAllocator->DeallocateResourceHeap(
             std::move(mTrackedSubAllocations[memoryIndex].mMemoryAllocation));
+        mStatistics.RemoveReservedMemory(mMemoryBlockSize);
     }
 
     mBuddyBlockAllocator.Deallocate(info.mBlockOffset);
@@ -128,6 +132,10 @@ uint64_t BuddyMemoryAllocator::GetMemoryBlockSize() const {
     return mMemoryBlockSize;
 }
 
+MemoryAllocatorStatistics BuddyMemoryAllocator::GetStatistics() const {
+    return mStatistics.Get();
+}
+
 uint64_t BuddyMemoryAllocator::ComputeTotalNumOfHeapsForTesting() const {
     uint64_t count = 0;
     for (const TrackedSubAllocations& allocation : mTrackedSubAllocations) {
@@ -31,6 +31,7 @@
 #include <memory>
 #include <vector>
 
+#include "dawn/native/AllocatorStatistics.h"
 #include "dawn/native/BuddyAllocator.h"
 #include "dawn/native/Error.h"
 #include "dawn/native/ResourceMemoryAllocation.h"
@@ -65,6 +66,10 @@ class BuddyMemoryAllocator {
 
     uint64_t GetMemoryBlockSize() const;
 
+    // The used size is the sum of the requested sizes and the reserved size is the size of the
+    // heaps backing the allocations.
+    MemoryAllocatorStatistics GetStatistics() const;
+
     // For testing purposes.
     uint64_t ComputeTotalNumOfHeapsForTesting() const;
 
@@ -82,6 +87,8 @@ class BuddyMemoryAllocator {
     };
 
     std::vector<TrackedSubAllocations> mTrackedSubAllocations;
+
+    AllocatorStatisticsTracker mStatistics;
 };
 
 }  // namespace dawn::native
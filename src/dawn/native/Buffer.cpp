@@ -382,6 +382,12 @@ BufferBase::~BufferBase() {
 }
 
 void BufferBase::DestroyImpl() {
+    // Record the write to the buffer that may have been held back before it is destroyed.
+    if (DynamicUploader* uploader = GetDevice()->GetDynamicUploader()) {
+        [[maybe_unused]] bool hadError = GetDevice()->ConsumedError(
+            uploader->FlushCombinedWriteTo(this), "calling %s.Destroy().", this);
+    }
+
     switch (mState.load(std::memory_order::acquire)) {
         case BufferState::Mapped:
         case BufferState::PendingMap: {
@@ -587,6 +593,7 @@ Future BufferBase::APIMapAsync(wgpu::MapMode mode,
             DAWN_INVALID_IF(mState.load(std::memory_order::acquire) == BufferState::PendingMap,
                             "%s already has an outstanding map pending.", this);
             DAWN_TRY(ValidateMapAsync(mode, offset, size, &status));
+            DAWN_TRY(GetDevice()->GetDynamicUploader()->FlushCombinedWriteTo(this));
             DAWN_TRY(MapAsyncImpl(mode, offset, size));
             return {};
         }();
@@ -880,11 +887,11 @@ MaybeError BufferBase::UploadData(uint64_t bufferOffset, const void* data, size_
         return {};
     }
 
-    return GetDevice()->GetDynamicUploader()->WithUploadReservation(
+    DynamicUploader* uploader = GetDevice()->GetDynamicUploader();
+    return uploader->WithUploadReservation(
         size, kCopyBufferToBufferOffsetAlignment, [&](UploadReservation reservation) -> MaybeError {
             memcpy(reservation.mappedPointer, data, size);
-            return GetDevice()->CopyFromStagingToBuffer(
-                reservation.buffer.Get(), reservation.offsetInBuffer, this, bufferOffset, size);
+            return uploader->CopyToBuffer(reservation, this, bufferOffset, size);
         });
 }
 
@@ -42,6 +42,7 @@
 #include "dawn/native/Error.h"
 #include "dawn/native/VisitableMembers.h"
 #include "dawn/platform/metrics/HistogramMacros.h"
+#include "dawn/platform/tracing/TraceEvent.h"
 
 namespace dawn::native {
 
@@ -124,10 +125,16 @@ class CacheRequestImpl {
         using CacheResultType = CacheResult<UnwrappedReturnType>;
         using ReturnType = ResultOrError<CacheResultType>;
 
+        TRACE_EVENT1(device->GetPlatform(), General, "CacheRequest::LoadOrRun", "request",
+                     Request::kName);
         CacheKey key = r.CreateCacheKey(device);
         platform::metrics::DawnHistogramTimer cacheTimer(
             cacheMetricName.empty() ? nullptr : device->GetPlatform());
-        Blob blob = device->GetBlobCache()->Load(key);
+        Blob blob;
+        {
+            TRACE_EVENT0(device->GetPlatform(), General, "BlobCache::Load");
+            blob = device->GetBlobCache()->Load(key);
+        }
 
         if (!blob.Empty()) {
             // Cache hit. Handle the cached blob.
@@ -151,6 +158,7 @@ class CacheRequestImpl {
         }
         // Cache miss, or the CacheHitFn failed.
         cacheTimer.Reset();
+        TRACE_EVENT0(device->GetPlatform(), General, "CacheRequest::CacheMiss");
         auto result = cacheMissFn(std::move(r));
         std::string cacheMissMetricName = cacheMetricName + ".CacheMiss";
         if (result.IsSuccess()) [[likely]] {
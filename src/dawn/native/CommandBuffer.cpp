@@ -101,6 +101,15 @@ const CommandBufferResourceUsage& CommandBufferBase::GetResourceUsages() const {
     return mResourceUsages;
 }
 
+void CommandBufferBase::TrackRenderPassBufferUsage(size_t renderPassIndex,
+                                                   BufferBase* buffer,
+                                                   wgpu::BufferUsage usage) {
+    DAWN_ASSERT(renderPassIndex < mResourceUsages.renderPasses.size());
+    RenderPassResourceUsage& passUsage = mResourceUsages.renderPasses[renderPassIndex];
+    passUsage.buffers.push_back(buffer);
+    passUsage.bufferSyncInfos.push_back({usage, wgpu::ShaderStage::None});
+}
+
 const std::vector<IndirectDrawMetadata>& CommandBufferBase::GetIndirectDrawMetadata() {
     return mIndirectDrawMetadata;
 }
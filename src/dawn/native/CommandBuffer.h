@@ -64,6 +64,12 @@ class CommandBufferBase : public ApiObjectBase {
 
     const CommandBufferResourceUsage& GetResourceUsages() const;
 
+    // Adds a usage of `buffer` to a render pass after encoding, for internal buffers that are
+    // only known to be used at Queue::Submit.
+    void TrackRenderPassBufferUsage(size_t renderPassIndex,
+                                    BufferBase* buffer,
+                                    wgpu::BufferUsage usage);
+
     const std::vector<IndirectDrawMetadata>& GetIndirectDrawMetadata();
 
     CommandIterator* GetCommandIteratorForTesting();
@@ -27,6 +27,7 @@
 
 #include "dawn/native/CommandBufferStateTracker.h"
 
+#include <algorithm>
 #include <limits>
 #include <optional>
 #include <type_traits>
@@ -358,6 +359,11 @@ MaybeError CommandBufferStateTracker::ValidateCanDrawIndexed() {
 }
 
 MaybeError CommandBufferStateTracker::ValidateNoDifferentTextureViewsOnSameTexture() {
+    // The bind groups and pipeline layout haven't changed since the last successful check.
+    if (mTextureViewsValidated) {
+        return {};
+    }
+
     // TODO(dawn:1855): Look into optimizations as flat_hash_map does many allocations
     absl::flat_hash_map<const TextureBase*, VectorOfTextureViews> textureToViews;
 
@@ -389,6 +395,7 @@ MaybeError CommandBufferStateTracker::ValidateNoDifferentTextureViewsOnSameTextu
             texture, ityp::span<size_t, const TextureViewBase* const>(views.data(), views.size()));
     }
 
+    mTextureViewsValidated = true;
     return {};
 }
 
@@ -401,6 +408,15 @@ MaybeError CommandBufferStateTracker::ValidateBufferInRangeForVertexBuffer(uint3
         return {};
     }
 
+    // Fast path, the draw fits in the cached limits. Otherwise find the vertex buffer that is
+    // too small to produce the error message.
+    if (mDrawLimitsDirty) {
+        RecomputeDrawLimits();
+    }
+    if (strideCount <= mMaxVertexStrideCount) {
+        return {};
+    }
+
     RenderPipelineBase* lastRenderPipeline = GetRenderPipeline();
 
     const auto& vertexBuffersUsedAsVertexBuffer =
@@ -447,6 +463,13 @@ MaybeError CommandBufferStateTracker::ValidateBufferInRangeForInstanceBuffer(
         return {};
     }
 
+    if (mDrawLimitsDirty) {
+        RecomputeDrawLimits();
+    }
+    if (strideCount <= mMaxInstanceStrideCount) {
+        return {};
+    }
+
     RenderPipelineBase* lastRenderPipeline = GetRenderPipeline();
 
     const auto& vertexBuffersUsedAsInstanceBuffer =
@@ -484,6 +507,39 @@ MaybeError CommandBufferStateTracker::ValidateBufferInRangeForInstanceBuffer(
     return {};
 }
 
+void CommandBufferStateTracker::RecomputeDrawLimits() {
+    RenderPipelineBase* lastRenderPipeline = GetRenderPipeline();
+
+    // Returns the largest stride count for which
+    // (strideCount - 1) * arrayStride + lastStride <= bufferSize for all the slots in `slots`.
+    auto ComputeMaxStrideCount = [&](const VertexBufferMask& slots) -> uint64_t {
+        uint64_t maxStrideCount = std::numeric_limits<uint64_t>::max();
+        for (auto slot : slots) {
+            const VertexBufferInfo& vertexBuffer = lastRenderPipeline->GetVertexBuffer(slot);
+            uint64_t bufferSize = mVertexBufferSizes[slot];
+            if (vertexBuffer.arrayStride == 0) {
+                if (vertexBuffer.usedBytesInStride > bufferSize) {
+                    return 0;
+                }
+            } else {
+                if (vertexBuffer.lastStride > bufferSize) {
+                    return 0;
+                }
+                maxStrideCount = std::min(
+                    maxStrideCount,
+                    (bufferSize - vertexBuffer.lastStride) / vertexBuffer.arrayStride + 1);
+            }
+        }
+        return maxStrideCount;
+    };
+
+    mMaxVertexStrideCount =
+        ComputeMaxStrideCount(lastRenderPipeline->GetVertexBuffersUsedAsVertexBuffer());
+    mMaxInstanceStrideCount =
+        ComputeMaxStrideCount(lastRenderPipeline->GetVertexBuffersUsedAsInstanceBuffer());
+    mDrawLimitsDirty = false;
+}
+
 MaybeError CommandBufferStateTracker::ValidateIndexBufferInRange(uint32_t indexCount,
                                                                  uint32_t firstIndex) {
     // Validate the range of index buffer
@@ -750,6 +806,7 @@ void CommandBufferStateTracker::SetRenderPipeline(RenderPipelineBase* pipeline)
 void CommandBufferStateTracker::UnsetBindGroup(BindGroupIndex index) {
     mBindgroups[index] = nullptr;
     mAspects.reset(VALIDATION_ASPECT_BIND_GROUPS);
+    mTextureViewsValidated = false;
 }
 void CommandBufferStateTracker::SetBindGroup(BindGroupIndex index,
                                              BindGroupBase* bindgroup,
@@ -758,6 +815,7 @@ void CommandBufferStateTracker::SetBindGroup(BindGroupIndex index,
     mBindgroups[index] = bindgroup;
     mDynamicOffsets[index].assign(dynamicOffsets, dynamicOffsets + dynamicOffsetCount);
     mAspects.reset(VALIDATION_ASPECT_BIND_GROUPS);
+    mTextureViewsValidated = false;
 }
 
 void CommandBufferStateTracker::SetIndexBuffer(BufferBase* buffer,
@@ -774,11 +832,13 @@ void CommandBufferStateTracker::UnsetVertexBuffer(VertexBufferSlot slot) {
     mVertexBuffersUsed.set(slot, false);
     mVertexBufferSizes[slot] = 0;
     mAspects.reset(VALIDATION_ASPECT_VERTEX_BUFFERS);
+    mDrawLimitsDirty = true;
 }
 
 void CommandBufferStateTracker::SetVertexBuffer(VertexBufferSlot slot, uint64_t size) {
     mVertexBuffersUsed.set(slot);
     mVertexBufferSizes[slot] = size;
+    mDrawLimitsDirty = true;
 }
 
 void CommandBufferStateTracker::SetPipelineCommon(PipelineBase* pipeline) {
@@ -788,8 +848,11 @@ void CommandBufferStateTracker::SetPipelineCommon(PipelineBase* pipeline) {
 
     mAspects.set(VALIDATION_ASPECT_PIPELINE);
 
-    // Reset lazy aspects so they get recomputed on the next operation.
+    // Reset lazy aspects and cached validation results so they get recomputed on the next
+    // operation.
     mAspects &= ~kLazyAspects;
+    mTextureViewsValidated = false;
+    mDrawLimitsDirty = true;
 }
 
 BindGroupBase* CommandBufferStateTracker::GetBindGroup(BindGroupIndex index) const {
@@ -844,6 +907,8 @@ void CommandBufferStateTracker::End() {
     mLastPipeline = nullptr;
     mMinBufferSizes = nullptr;
     mBindgroups.fill(nullptr);
+    mTextureViewsValidated = false;
+    mDrawLimitsDirty = true;
 }
 
 }  // namespace dawn::native
@@ -98,8 +98,19 @@ class CommandBufferStateTracker {
 
     void SetPipelineCommon(PipelineBase* pipeline);
 
+    // Computes the largest first + count of vertices and instances that fits in all the vertex
+    // buffers used by the current render pipeline.
+    void RecomputeDrawLimits();
+
     ValidationAspects mAspects;
 
+    // Validation results that only depend on the current state and are cached until that state
+    // changes, so that runs of draws without state changes in between are validated in O(1).
+    bool mTextureViewsValidated = false;
+    bool mDrawLimitsDirty = true;
+    uint64_t mMaxVertexStrideCount = 0;
+    uint64_t mMaxInstanceStrideCount = 0;
+
     VertexBufferMask mVertexBuffersUsed;
     PerVertexBuffer<uint64_t> mVertexBufferSizes = {};
 
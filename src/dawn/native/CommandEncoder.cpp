@@ -1230,6 +1230,10 @@ void CommandEncoder::TrackUsedQuerySet(QuerySetBase* querySet) {
     mUsedQuerySets.insert(querySet);
 }
 
+bool CommandEncoder::IsBufferUsedOutsideOfPasses(BufferBase* buffer) const {
+    return mTopLevelBuffers.contains(buffer);
+}
+
 void CommandEncoder::TrackQueryAvailability(QuerySetBase* querySet, uint32_t queryIndex) {
     DAWN_ASSERT(querySet != nullptr);
 
@@ -1257,6 +1261,7 @@ ComputePassEncoder* CommandEncoder::APIBeginComputePass(const ComputePassDescrip
 Ref<ComputePassEncoder> CommandEncoder::BeginComputePass(const ComputePassDescriptor* descriptor) {
     DeviceBase* device = GetDevice();
     DAWN_ASSERT(device->IsLockedByCurrentThreadIfNeeded());
+    TRACE_EVENT0(device->GetPlatform(), Recording, "CommandEncoder::BeginComputePass");
 
     bool success = mEncodingContext.TryEncode(
         this,
@@ -1322,6 +1327,7 @@ RenderPassEncoder* CommandEncoder::APIBeginRenderPass(const RenderPassDescriptor
 Ref<RenderPassEncoder> CommandEncoder::BeginRenderPass(const RenderPassDescriptor* rawDescriptor) {
     DeviceBase* device = GetDevice();
     DAWN_ASSERT(device->IsLockedByCurrentThreadIfNeeded());
+    TRACE_EVENT0(device->GetPlatform(), Recording, "CommandEncoder::BeginRenderPass");
 
     RenderPassResourceUsageTracker usageTracker;
 
@@ -66,6 +66,10 @@ class CommandEncoder final : public ApiObjectBase {
     void TrackUsedQuerySet(QuerySetBase* querySet);
     void TrackQueryAvailability(QuerySetBase* querySet, uint32_t queryIndex);
 
+    // Whether `buffer` is used by a command encoded outside of a pass, e.g. as a copy
+    // destination, so far.
+    bool IsBufferUsedOutsideOfPasses(BufferBase* buffer) const;
+
     // Dawn API
     ComputePassEncoder* APIBeginComputePass(const ComputePassDescriptor* descriptor);
     RenderPassEncoder* APIBeginRenderPass(const RenderPassDescriptor* descriptor);
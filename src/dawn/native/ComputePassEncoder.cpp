@@ -42,6 +42,7 @@
 #include "dawn/native/PassResourceUsageTracker.h"
 #include "dawn/native/QuerySet.h"
 #include "dawn/native/utils/WGPUHelpers.h"
+#include "dawn/platform/tracing/TraceEvent.h"
 
 namespace dawn::native {
 
@@ -174,6 +175,7 @@ ObjectType ComputePassEncoder::GetType() const {
 }
 
 void ComputePassEncoder::APIEnd() {
+    TRACE_EVENT0(GetDevice()->GetPlatform(), Recording, "ComputePassEncoder::End");
     if (mEnded && IsValidationEnabled()) {
         GetDevice()->HandleError(DAWN_VALIDATION_ERROR("%s was already ended.", this));
         return;
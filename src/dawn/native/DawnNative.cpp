@@ -33,6 +33,7 @@
 #include "dawn/native/BindGroupLayout.h"
 #include "dawn/native/Buffer.h"
 #include "dawn/native/Device.h"
+#include "dawn/native/DynamicUploader.h"
 #include "dawn/native/Instance.h"
 #include "dawn/native/Texture.h"
 #include "dawn/platform/DawnPlatform.h"
@@ -199,6 +200,22 @@ size_t GetLazyClearCountForTesting(WGPUDevice device) {
     return FromAPI(device)->GetLazyClearCountForTesting();
 }
 
+size_t GetIndirectDrawValidationDispatchCountForTesting(WGPUDevice device) {
+    return FromAPI(device)->GetIndirectDrawValidationDispatchCountForTesting();
+}
+
+size_t GetStagingBufferCopyCountForTesting(WGPUDevice device) {
+    return FromAPI(device)->GetDynamicUploader()->GetStatistics().bufferCopies;
+}
+
+size_t GetStagedByteCountForTesting(WGPUDevice device) {
+    return FromAPI(device)->GetDynamicUploader()->GetStatistics().bytesStaged;
+}
+
+size_t GetStagingBudgetWaitCountForTesting(WGPUDevice device) {
+    return FromAPI(device)->GetDynamicUploader()->GetStatistics().budgetWaits;
+}
+
 bool IsTextureSubresourceInitialized(WGPUTexture texture,
                                      uint32_t baseMipLevel,
                                      uint32_t levelCount,
@@ -286,6 +303,11 @@ AllocatorMemoryInfo GetAllocatorMemoryInfo(WGPUDevice device) {
     return FromAPI(device)->GetAllocatorMemoryInfo();
 }
 
+DeviceMemoryStatistics GetDeviceMemoryStatistics(WGPUDevice device) {
+    auto deviceGuard = FromAPI(device)->GetGuard();
+    return FromAPI(device)->GetMemoryStatistics();
+}
+
 bool ReduceMemoryUsage(WGPUDevice device) {
     auto deviceGuard = FromAPI(device)->GetGuard();
     return FromAPI(device)->ReduceMemoryUsage();
@@ -444,7 +444,8 @@ MaybeError DeviceBase::Initialize(const UnpackedPtr<DeviceDescriptor>& descripto
     SetWGSLExtensionAllowList();
 
     mCaches = std::make_unique<DeviceBase::Caches>();
-    mDynamicUploader = std::make_unique<DynamicUploader>(this);
+    mDynamicUploader =
+        std::make_unique<DynamicUploader>(this, descriptor.Get<DawnDeviceAllocatorControl>());
     mCallbackTaskManager = AcquireRef(new CallbackTaskManager());
     mInternalPipelineStore = std::make_unique<InternalPipelineStore>(this);
 
@@ -1558,7 +1559,13 @@ bool DeviceBase::APITick() {
 }
 
 MaybeError DeviceBase::Tick() {
-    if (IsLost() || !mQueue->HasScheduledCommands()) {
+    if (IsLost()) {
+        return {};
+    }
+
+    // Record writes held back for coalescing so they are submitted in this tick.
+    DAWN_TRY(mQueue->RecordDeferredCommands());
+    if (!mQueue->HasScheduledCommands()) {
         return {};
     }
 
@@ -1761,6 +1768,14 @@ void DeviceBase::IncrementLazyClearCountForTesting() {
     ++mLazyClearCountForTesting;
 }
 
+size_t DeviceBase::GetIndirectDrawValidationDispatchCountForTesting() {
+    return mIndirectDrawValidationDispatchCountForTesting;
+}
+
+void DeviceBase::IncrementIndirectDrawValidationDispatchCountForTesting() {
+    ++mIndirectDrawValidationDispatchCountForTesting;
+}
+
 void DeviceBase::EmitWarningOnce(std::string_view message) {
     if (mWarnings.insert(std::string{message}).second) {
         this->EmitLog(wgpu::LoggingType::Warning, message);
@@ -2537,6 +2552,18 @@ AllocatorMemoryInfo DeviceBase::GetAllocatorMemoryInfo() const {
     return {};
 }
 
+DeviceMemoryStatistics DeviceBase::GetMemoryStatistics() const {
+    DAWN_ASSERT(IsLockedByCurrentThreadIfNeeded());
+    DeviceMemoryStatistics statistics = {};
+    if (mDynamicUploader != nullptr) {
+        statistics.staging = mDynamicUploader->GetMemoryStatistics();
+    }
+    GetBackendMemoryStatistics(&statistics);
+    return statistics;
+}
+
+void DeviceBase::GetBackendMemoryStatistics(DeviceMemoryStatistics* statistics) const {}
+
 bool DeviceBase::ReduceMemoryUsage() {
     DAWN_ASSERT(IsLockedByCurrentThreadIfNeeded());
     if (ConsumedError(GetQueue()->CheckPassedSerials())) {
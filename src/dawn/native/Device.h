@@ -347,6 +347,8 @@ class DeviceBase : public ErrorSink,
 
     size_t GetLazyClearCountForTesting();
     void IncrementLazyClearCountForTesting();
+    size_t GetIndirectDrawValidationDispatchCountForTesting();
+    void IncrementIndirectDrawValidationDispatchCountForTesting();
     void EmitWarningOnce(std::string_view message);
     void EmitCompilationLog(const ShaderModuleBase* module);
     void EmitLog(std::string_view message) override;
@@ -443,6 +445,8 @@ class DeviceBase : public ErrorSink,
     // TODO(chromium:397720827): Implement allocator memory tracking for D3D12.
     virtual AllocatorMemoryInfo GetAllocatorMemoryInfo() const;
 
+    DeviceMemoryStatistics GetMemoryStatistics() const;
+
     ResultOrError<Ref<BufferBase>> GetOrCreateTemporaryUniformBuffer(size_t size);
 
     bool HasFlexibleTextureViews() const;
@@ -526,6 +530,8 @@ class DeviceBase : public ErrorSink,
     virtual void SetLabelImpl();
     virtual bool ReduceMemoryUsageImpl();
     virtual void PerformIdleTasksImpl();
+    // Fills the members of `statistics` reported by the backend's resource allocator.
+    virtual void GetBackendMemoryStatistics(DeviceMemoryStatistics* statistics) const;
 
     virtual MaybeError TickImpl() = 0;
     void FlushCallbackTaskQueue();
@@ -605,6 +611,7 @@ class DeviceBase : public ErrorSink,
     TogglesState mToggles;
 
     std::atomic_uint64_t mLazyClearCountForTesting = 0;
+    std::atomic_uint64_t mIndirectDrawValidationDispatchCountForTesting = 0;
     std::atomic_uint64_t mNextPipelineCompatibilityToken;
 
     CombinedLimits mLimits;
@@ -27,25 +27,44 @@
 
 #include "dawn/native/DynamicUploader.h"
 
+#include <algorithm>
+#include <limits>
 #include <utility>
 
 #include "dawn/common/Math.h"
+#include "dawn/native/AllocatorStatistics.h"
 #include "dawn/native/Buffer.h"
 #include "dawn/native/Device.h"
 #include "dawn/native/Queue.h"
+#include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/tracing/TraceEvent.h"
 
 namespace dawn::native {
 
 namespace {
-constexpr uint64_t kRingBufferSize = 4 * 1024 * 1024;
+constexpr uint64_t kDefaultRingBufferSize = 4 * 1024 * 1024;
 }  // anonymous namespace
 
-DynamicUploader::DynamicUploader(DeviceBase* device) : mDevice(device) {}
+DynamicUploader::DynamicUploader(DeviceBase* device,
+                                 const DawnDeviceAllocatorControl* allocatorControl)
+    : mRingBufferSize(kDefaultRingBufferSize), mStagingMemoryBudget(0), mDevice(device) {
+    if (allocatorControl != nullptr) {
+        if (allocatorControl->stagingRingBufferSize > 0) {
+            mRingBufferSize = allocatorControl->stagingRingBufferSize;
+        }
+        mStagingMemoryBudget = allocatorControl->stagingMemoryBudget;
+    }
+    DAWN_ASSERT(mRingBufferSize % 4 == 0);
+}
 
 ResultOrError<UploadReservation> DynamicUploader::Reserve(uint64_t allocationSize,
                                                           uint64_t offsetAlignment) {
+    mStatistics.bytesStaged += allocationSize;
+    TRACE_COUNTER1(mDevice->GetPlatform(), General, "DynamicUploader::BytesStaged",
+                   mStatistics.bytesStaged);
+
     // Disable further sub-allocation should the request be too large.
-    if (allocationSize > kRingBufferSize) {
+    if (allocationSize > mRingBufferSize) {
         BufferDescriptor bufferDesc = {};
         bufferDesc.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::MapWrite;
         bufferDesc.size = Align(allocationSize, 4);
@@ -65,36 +84,34 @@ ResultOrError<UploadReservation> DynamicUploader::Reserve(uint64_t allocationSiz
 
     // Request is small, we sub-allocate transiently in one of our ring buffers. The reservation
     // will only be valid for the pending serial.
-    ExecutionSerial serial = mDevice->GetQueue()->GetPendingCommandSerial();
-
     if (mRingBuffers.empty()) {
         mRingBuffers.emplace_back(std::unique_ptr<RingBuffer>(
-            new RingBuffer{nullptr, RingBufferAllocator(kRingBufferSize)}));
+            new RingBuffer{nullptr, RingBufferAllocator(mRingBufferSize)}));
     }
 
-    // Note: Validation ensures size is already aligned.
-    // First-fit: find next buffer large enough to satisfy the allocation request.
     uint64_t startOffset = RingBufferAllocator::kInvalidOffset;
-    RingBuffer* targetRingBuffer = mRingBuffers.back().get();
-    for (auto& ringBuffer : mRingBuffers) {
-        RingBufferAllocator& ringBufferAllocator = ringBuffer->mAllocator;
-        // Prevent overflow.
-        DAWN_ASSERT(ringBufferAllocator.GetSize() >= ringBufferAllocator.GetUsedSize());
-        startOffset = ringBufferAllocator.Allocate(allocationSize, serial, offsetAlignment);
-        if (startOffset != RingBufferAllocator::kInvalidOffset) {
-            targetRingBuffer = ringBuffer.get();
+    RingBuffer* targetRingBuffer = SubAllocate(allocationSize, offsetAlignment, &startOffset);
+
+    // Rather than growing the ring buffers past the staging memory budget, apply back-pressure by
+    // waiting for the GPU to retire in-flight uploads and retrying.
+    while (targetRingBuffer == nullptr && IsRingBufferOverBudget()) {
+        bool waited;
+        DAWN_TRY_ASSIGN(waited, WaitForInFlightUploads());
+        if (!waited) {
             break;
         }
+        targetRingBuffer = SubAllocate(allocationSize, offsetAlignment, &startOffset);
     }
 
     // Upon failure, append a newly created ring buffer to fulfill the
     // request.
-    if (startOffset == RingBufferAllocator::kInvalidOffset) {
+    if (targetRingBuffer == nullptr) {
         mRingBuffers.emplace_back(std::unique_ptr<RingBuffer>(
-            new RingBuffer{nullptr, RingBufferAllocator(kRingBufferSize)}));
+            new RingBuffer{nullptr, RingBufferAllocator(mRingBufferSize)}));
 
         targetRingBuffer = mRingBuffers.back().get();
-        startOffset = targetRingBuffer->mAllocator.Allocate(allocationSize, serial);
+        startOffset = targetRingBuffer->mAllocator.Allocate(
+            allocationSize, mDevice->GetQueue()->GetPendingCommandSerial());
     }
 
     DAWN_ASSERT(startOffset != RingBufferAllocator::kInvalidOffset);
@@ -115,6 +132,7 @@ ResultOrError<UploadReservation> DynamicUploader::Reserve(uint64_t allocationSiz
     }
 
     DAWN_ASSERT(targetRingBuffer->mStagingBuffer != nullptr);
+    UpdatePeakMemoryStatistics();
 
     UploadReservation reservation;
     reservation.buffer = targetRingBuffer->mStagingBuffer;
@@ -125,6 +143,136 @@ ResultOrError<UploadReservation> DynamicUploader::Reserve(uint64_t allocationSiz
     return reservation;
 }
 
+DynamicUploader::RingBuffer* DynamicUploader::SubAllocate(uint64_t allocationSize,
+                                                          uint64_t offsetAlignment,
+                                                          uint64_t* startOffset) {
+    ExecutionSerial serial = mDevice->GetQueue()->GetPendingCommandSerial();
+
+    // Note: Validation ensures size is already aligned.
+    // First-fit: find next buffer large enough to satisfy the allocation request.
+    for (auto& ringBuffer : mRingBuffers) {
+        RingBufferAllocator& ringBufferAllocator = ringBuffer->mAllocator;
+        // Prevent overflow.
+        DAWN_ASSERT(ringBufferAllocator.GetSize() >= ringBufferAllocator.GetUsedSize());
+        *startOffset = ringBufferAllocator.Allocate(allocationSize, serial, offsetAlignment);
+        if (*startOffset != RingBufferAllocator::kInvalidOffset) {
+            return ringBuffer.get();
+        }
+    }
+    return nullptr;
+}
+
+bool DynamicUploader::IsRingBufferOverBudget() const {
+    return mStagingMemoryBudget != 0 &&
+           (mRingBuffers.size() + 1) * mRingBufferSize > mStagingMemoryBudget;
+}
+
+ResultOrError<bool> DynamicUploader::WaitForInFlightUploads() {
+    QueueBase* queue = mDevice->GetQueue();
+
+    // Submitting or waiting could reenter the submit in progress, fall back to growing instead.
+    if (queue->mInSubmit) {
+        return false;
+    }
+
+    ExecutionSerial completedSerial = queue->GetCompletedCommandSerial();
+    if (completedSerial == queue->GetLastSubmittedCommandSerial()) {
+        // All the uploads in the ring buffers are pending submission, submit them so that they
+        // can be waited on.
+        queue->ForceEventualFlushOfCommands();
+        DAWN_TRY(queue->SubmitPendingCommands());
+        if (completedSerial == queue->GetLastSubmittedCommandSerial()) {
+            return false;
+        }
+    }
+
+    ExecutionSerial waitSerial = ExecutionSerial(uint64_t(completedSerial) + 1);
+    bool waited;
+    DAWN_TRY_ASSIGN(waited,
+                    queue->WaitForQueueSerial(waitSerial, std::numeric_limits<Nanoseconds>::max()));
+    if (!waited) {
+        return false;
+    }
+
+    mStatistics.budgetWaits++;
+    TRACE_COUNTER1(mDevice->GetPlatform(), General, "DynamicUploader::BudgetWaits",
+                   mStatistics.budgetWaits);
+
+    Deallocate(queue->GetCompletedCommandSerial());
+    return true;
+}
+
+MaybeError DynamicUploader::CopyToBuffer(const UploadReservation& reservation,
+                                         BufferBase* destination,
+                                         uint64_t destinationOffset,
+                                         uint64_t size) {
+    QueueBase* queue = mDevice->GetQueue();
+
+    // Copies recorded during a submit must be part of it, so they are never held back.
+    if (!mDevice->IsToggleEnabled(Toggle::CoalesceWriteBuffers) || queue->mInSubmit) {
+        DAWN_ASSERT(mCombinedWrite.destination == nullptr);
+        mStatistics.bufferCopies++;
+        TRACE_COUNTER1(mDevice->GetPlatform(), General, "DynamicUploader::BufferCopies",
+                       mStatistics.bufferCopies);
+        return mDevice->CopyFromStagingToBuffer(reservation.buffer.Get(),
+                                                reservation.offsetInBuffer, destination,
+                                                destinationOffset, size);
+    }
+
+    ExecutionSerial pendingSerial = queue->GetPendingCommandSerial();
+    if (mCombinedWrite.destination.Get() == destination &&
+        mCombinedWrite.source == reservation.buffer && mCombinedWrite.serial == pendingSerial &&
+        mCombinedWrite.sourceOffset + mCombinedWrite.size == reservation.offsetInBuffer &&
+        mCombinedWrite.destinationOffset + mCombinedWrite.size == destinationOffset) {
+        mCombinedWrite.size += size;
+        mStatistics.coalescedWrites++;
+        TRACE_COUNTER1(mDevice->GetPlatform(), General, "DynamicUploader::CoalescedWrites",
+                       mStatistics.coalescedWrites);
+        return {};
+    }
+
+    DAWN_TRY(FlushCombinedWrite());
+    mCombinedWrite.source = reservation.buffer;
+    mCombinedWrite.sourceOffset = reservation.offsetInBuffer;
+    mCombinedWrite.destination = destination;
+    mCombinedWrite.destinationOffset = destinationOffset;
+    mCombinedWrite.size = size;
+    mCombinedWrite.serial = pendingSerial;
+    return {};
+}
+
+MaybeError DynamicUploader::FlushCombinedWrite() {
+    if (mCombinedWrite.destination == nullptr) {
+        return {};
+    }
+
+    CombinedWrite write = std::move(mCombinedWrite);
+    mCombinedWrite = {};
+
+    // The copy doesn't matter anymore if the device is being destroyed.
+    if (mDevice->GetState() != DeviceBase::State::Alive) {
+        return {};
+    }
+
+    // The staging memory is only reserved until |write.serial| completes so the copy must be
+    // recorded before that serial is submitted.
+    DAWN_ASSERT(write.serial == mDevice->GetQueue()->GetPendingCommandSerial());
+
+    mStatistics.bufferCopies++;
+    TRACE_COUNTER1(mDevice->GetPlatform(), General, "DynamicUploader::BufferCopies",
+                   mStatistics.bufferCopies);
+    return mDevice->CopyFromStagingToBuffer(write.source.Get(), write.sourceOffset,
+                                            write.destination.Get(), write.destinationOffset,
+                                            write.size);
+}
+
+MaybeError DynamicUploader::FlushCombinedWriteTo(const BufferBase* destination) {
+    if (mCombinedWrite.destination.Get() != destination) {
+        return {};
+    }
+    return FlushCombinedWrite();
+}
+
 MaybeError DynamicUploader::OnStagingMemoryFreePendingOnSubmit(uint64_t size) {
     QueueBase* queue = mDevice->GetQueue();
 
@@ -136,12 +284,18 @@ MaybeError DynamicUploader::OnStagingMemoryFreePendingOnSubmit(uint64_t size) {
         mLastPendingSerialSeen = pendingSerial;
     }
 
+    // Larger ring buffers are configured to hold more uploads per submit, so only force a submit
+    // once a full ring buffer is pending.
     constexpr uint64_t kPendingMemorySubmitThreshold = 16 * 1024 * 1024;
     mMemoryPendingSubmit += size;
-    if (mMemoryPendingSubmit < kPendingMemorySubmitThreshold) {
+    if (mMemoryPendingSubmit < std::max(kPendingMemorySubmitThreshold, mRingBufferSize)) {
         return {};
     }
 
+    mStatistics.forcedSubmits++;
+    TRACE_COUNTER1(mDevice->GetPlatform(), General, "DynamicUploader::ForcedSubmits",
+                   mStatistics.forcedSubmits);
+
     // TODO(crbug.com/42240396): Consider blocking when there is too much memory in flight for
     // freeing, which could cause OOM even if we eagerly flush when too much memory is pending.
     queue->ForceEventualFlushOfCommands();
@@ -166,4 +320,30 @@ void DynamicUploader::Deallocate(ExecutionSerial lastCompletedSerial, bool freeA
     }
 }
 
+const DynamicUploader::Statistics& DynamicUploader::GetStatistics() const {
+    return mStatistics;
+}
+
+MemoryAllocatorStatistics DynamicUploader::GetMemoryStatistics() const {
+    MemoryAllocatorStatistics statistics;
+    for (const auto& ringBuffer : mRingBuffers) {
+        AccumulateAllocatorStatistics(&statistics, ringBuffer->mAllocator.GetStatistics());
+    }
+    // Ring buffers come and go so the sum of their peaks isn't the peak of the uploader.
+    statistics.peakUsedSize = mPeakUsedSize;
+    statistics.peakReservedSize = mPeakReservedSize;
+    return statistics;
+}
+
+void DynamicUploader::UpdatePeakMemoryStatistics() {
+    uint64_t usedSize = 0;
+    uint64_t reservedSize = 0;
+    for (const auto& ringBuffer : mRingBuffers) {
+        usedSize += ringBuffer->mAllocator.GetUsedSize();
+        reservedSize += ringBuffer->mAllocator.GetSize();
+    }
+    mPeakUsedSize = std::max(mPeakUsedSize, usedSize);
+    mPeakReservedSize = std::max(mPeakReservedSize, reservedSize);
+}
+
 }  // namespace dawn::native
@@ -33,10 +33,12 @@
 
 #include "dawn/common/NonMovable.h"
 #include "dawn/common/Ref.h"
+#include "dawn/native/DawnNative.h"
 #include "dawn/native/Error.h"
 #include "dawn/native/Forward.h"
 #include "dawn/native/IntegerTypes.h"
 #include "dawn/native/RingBufferAllocator.h"
+#include "dawn/native/dawn_platform.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 
 // DynamicUploader is the front-end implementation used to manage multiple ring buffers for upload
@@ -53,7 +55,23 @@ struct UploadReservation {
 
 class DynamicUploader : NonMovable {
   public:
-    explicit DynamicUploader(DeviceBase* device);
+    struct Statistics {
+        // Number of bytes written to staging memory.
+        uint64_t bytesStaged = 0;
+        // Number of copies recorded from staging memory to a destination buffer.
+        uint64_t bufferCopies = 0;
+        // Number of WriteBuffers merged into the copy of the WriteBuffer preceding them.
+        uint64_t coalescedWrites = 0;
+        // Number of early submits forced because too much staging memory was pending submit.
+        uint64_t forcedSubmits = 0;
+        // Number of times an upload waited on the GPU to stay within the staging memory budget.
+        uint64_t budgetWaits = 0;
+    };
+
+    // |allocatorControl| optionally overrides the size of the ring buffers and sets a budget for
+    // the total size of the ring buffers.
+    explicit DynamicUploader(DeviceBase* device,
+                             const DawnDeviceAllocatorControl* allocatorControl = nullptr);
     ~DynamicUploader() = default;
 
     // Transiently makes a reservation for an upload area for the functor passed in argument.
@@ -69,16 +87,57 @@ class DynamicUploader : NonMovable {
     // submit. The dynamic uploader may take some action in this case, like forcing an early submit.
     MaybeError OnStagingMemoryFreePendingOnSubmit(uint64_t size);
 
+    // Records a copy of |size| bytes from |reservation| to |destination|. With the
+    // CoalesceWriteBuffers toggle the copy is held back so that a copy of the following bytes of
+    // the reservation to the following bytes of |destination| can be merged into it. Held back
+    // copies are recorded by FlushCombinedWrite() which must be called before any other queue
+    // operation.
+    MaybeError CopyToBuffer(const UploadReservation& reservation,
+                            BufferBase* destination,
+                            uint64_t destinationOffset,
+                            uint64_t size);
+    MaybeError FlushCombinedWrite();
+    MaybeError FlushCombinedWriteTo(const BufferBase* destination);
+
     void Deallocate(ExecutionSerial lastCompletedSerial, bool freeAll = false);
 
-  private:
-    ResultOrError<UploadReservation> Reserve(uint64_t size, uint64_t offsetAlignment);
+    const Statistics& GetStatistics() const;
+    // Returns the memory statistics of the ring buffers. Staging buffers created for uploads that
+    // don't fit in a ring buffer aren't included.
+    MemoryAllocatorStatistics GetMemoryStatistics() const;
 
+  private:
     struct RingBuffer {
         Ref<BufferBase> mStagingBuffer;
         RingBufferAllocator mAllocator;
     };
+
+    ResultOrError<UploadReservation> Reserve(uint64_t size, uint64_t offsetAlignment);
+    RingBuffer* SubAllocate(uint64_t size, uint64_t offsetAlignment, uint64_t* startOffset);
+    bool IsRingBufferOverBudget() const;
+    void UpdatePeakMemoryStatistics();
+    // Blocks until the oldest in-flight uploads complete and reclaims their ring buffer memory.
+    // Returns false if there was nothing that could be waited on.
+    ResultOrError<bool> WaitForInFlightUploads();
+
     std::vector<std::unique_ptr<RingBuffer>> mRingBuffers;
+    uint64_t mRingBufferSize;
+    uint64_t mStagingMemoryBudget;
+
+    // The copy held back by CopyToBuffer, if |destination| is not null.
+    struct CombinedWrite {
+        Ref<BufferBase> source;
+        uint64_t sourceOffset = 0;
+        Ref<BufferBase> destination;
+        uint64_t destinationOffset = 0;
+        uint64_t size = 0;
+        ExecutionSerial serial = kBeginningOfGPUTime;
+    };
+    CombinedWrite mCombinedWrite;
+
+    Statistics mStatistics;
+    uint64_t mPeakUsedSize = 0;
+    uint64_t mPeakReservedSize = 0;
 
     // Serial used to track when a serial has been scheduled and the corresponding pending memory
     // will be freed in finite time.
@@ -28,6 +28,7 @@
 #include "dawn/native/EncodingContext.h"
 
 #include "dawn/common/Assert.h"
+#include "dawn/native/Buffer.h"
 #include "dawn/native/CommandEncoder.h"
 #include "dawn/native/Commands.h"
 #include "dawn/native/Device.h"
@@ -135,7 +136,13 @@ MaybeError EncodingContext::ExitRenderPass(const ApiObjectBase* passEncoder,
 
     mCurrentEncoder = mTopLevelEncoder;
 
-    if (mDevice->IsValidationEnabled() || mDevice->MayRequireDuplicationOfIndirectParameters()) {
+    if ((mDevice->IsValidationEnabled() || mDevice->MayRequireDuplicationOfIndirectParameters()) &&
+        CanDeferIndirectDrawValidationToSubmit(commandEncoder, &indirectDrawMetadata)) {
+        // The render commands are left in mPendingCommands, and the indirect draws are
+        // validated together with the ones of the other render passes in the same submit.
+        indirectDrawMetadata.SetValidationDeferredToSubmit();
+    } else if (mDevice->IsValidationEnabled() ||
+               mDevice->MayRequireDuplicationOfIndirectParameters()) {
         // With validation enabled, commands were committed just before BeginRenderPassCmd was
         // encoded by our RenderPassEncoder (see WillBeginRenderPass above). This means
         // mPendingCommands contains only the commands from BeginRenderPassCmd to
@@ -168,6 +175,58 @@ MaybeError EncodingContext::ExitRenderPass(const ApiObjectBase* passEncoder,
     return {};
 }
 
+bool EncodingContext::CanDeferIndirectDrawValidationToSubmit(
+    const CommandEncoder* commandEncoder,
+    IndirectDrawMetadata* indirectDrawMetadata) const {
+    if (!mDevice->IsToggleEnabled(Toggle::BatchIndirectDrawValidationPerSubmit)) {
+        return false;
+    }
+
+    // Multi-draws are validated with a dedicated dispatch each so there is nothing to batch.
+    // Commands from render bundles are shared with other render passes that might not defer
+    // their validation.
+    if (!indirectDrawMetadata->GetIndirectMultiDraws().empty() ||
+        indirectDrawMetadata->HasIndirectDrawsFromRenderBundles()) {
+        return false;
+    }
+
+    IndirectDrawMetadata::IndexedIndirectBufferValidationInfoMap& bufferInfoMap =
+        *indirectDrawMetadata->GetIndexedIndirectBufferValidationInfo();
+    if (bufferInfoMap.empty()) {
+        return false;
+    }
+
+    auto IsWrittenInSyncScope = [](const SyncScopeResourceUsage& usage, BufferBase* buffer) {
+        for (size_t i = 0; i < usage.buffers.size(); ++i) {
+            if (usage.buffers[i] == buffer &&
+                (usage.bufferSyncInfos[i].usage & ~kReadOnlyBufferUsages) != 0) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    for (const auto& [config, validationInfo] : bufferInfoMap) {
+        BufferBase* indirectBuffer = validationInfo.GetIndirectBuffer();
+        if (commandEncoder->IsBufferUsedOutsideOfPasses(indirectBuffer)) {
+            return false;
+        }
+        for (const RenderPassResourceUsage& usage : mRenderPassUsages) {
+            if (IsWrittenInSyncScope(usage, indirectBuffer)) {
+                return false;
+            }
+        }
+        for (const ComputePassResourceUsage& pass : mComputePassUsages) {
+            for (const SyncScopeResourceUsage& usage : pass.dispatchUsages) {
+                if (IsWrittenInSyncScope(usage, indirectBuffer)) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
 void EncodingContext::ExitComputePass(const ApiObjectBase* passEncoder,
                                       ComputePassResourceUsage usages) {
     DAWN_ASSERT(mCurrentEncoder != mTopLevelEncoder);
@@ -192,6 +192,12 @@ class EncodingContext {
     void CommitCommands(CommandAllocator allocator);
     void CloseWithStatus(Status status);
 
+    // Whether the indirect draw validation of a render pass can be deferred to Queue::Submit.
+    // This requires that none of its indirect buffers may have been written by the commands
+    // encoded before it, since the validation will run before all of them.
+    bool CanDeferIndirectDrawValidationToSubmit(const CommandEncoder* commandEncoder,
+                                                IndirectDrawMetadata* indirectDrawMetadata) const;
+
     raw_ptr<DeviceBase> mDevice;
 
     // There can only be two levels of encoders. Top-level and render/compute pass.
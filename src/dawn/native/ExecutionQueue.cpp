@@ -127,6 +127,8 @@ MaybeError ExecutionQueueBase::SubmitPendingCommands() {
         return {};
     }
 
+    DAWN_TRY(RecordDeferredCommands());
+
     mInSubmit = true;
     auto result = SubmitPendingCommandsImpl();
     mInSubmit = false;
@@ -134,6 +136,10 @@ MaybeError ExecutionQueueBase::SubmitPendingCommands() {
     return result;
 }
 
+MaybeError ExecutionQueueBase::RecordDeferredCommands() {
+    return {};
+}
+
 void ExecutionQueueBase::AssumeCommandsComplete() {
     // Bump serials so any pending callbacks can be fired.
     // TODO(crbug.com/dawn/831): This is called during device destroy, which is not
@@ -77,6 +77,10 @@ class ExecutionQueueBase {
     // Submit any pending commands that are enqueued.
     MaybeError SubmitPendingCommands();
 
+    // Records the commands that the frontend held back in the hope of merging them, so that they
+    // are part of the next submit.
+    virtual MaybeError RecordDeferredCommands();
+
     // During shut down of device, some operations might have been started since the last submit
     // and waiting on a serial that doesn't have a corresponding fence enqueued. Fake serials to
     // make all commands look completed.
@@ -154,6 +154,11 @@ IndirectDrawMetadata::GetIndexedIndirectBufferValidationInfo() {
     return &mIndexedIndirectBufferValidationInfo;
 }
 
+const IndirectDrawMetadata::IndexedIndirectBufferValidationInfoMap*
+IndirectDrawMetadata::GetIndexedIndirectBufferValidationInfo() const {
+    return &mIndexedIndirectBufferValidationInfo;
+}
+
 const std::vector<IndirectDrawMetadata::IndirectMultiDraw>&
 IndirectDrawMetadata::GetIndirectMultiDraws() const {
     return mMultiDraws;
@@ -165,8 +170,15 @@ void IndirectDrawMetadata::AddBundle(RenderBundleBase* bundle) {
         return;
     }
 
-    for (const auto& [config, validationInfo] :
-         bundle->GetIndirectDrawMetadata().mIndexedIndirectBufferValidationInfo) {
+    const IndirectDrawMetadata& bundleMetadata = bundle->GetIndirectDrawMetadata();
+    if (!bundleMetadata.mIndexedIndirectBufferValidationInfo.empty()) {
+        mHasIndirectDrawsFromRenderBundles = true;
+    }
+    AddIndirectDrawsFrom(bundleMetadata);
+}
+
+void IndirectDrawMetadata::AddIndirectDrawsFrom(const IndirectDrawMetadata& other) {
+    for (const auto& [config, validationInfo] : other.mIndexedIndirectBufferValidationInfo) {
         auto it = mIndexedIndirectBufferValidationInfo.lower_bound(config);
         if (it != mIndexedIndirectBufferValidationInfo.end() && it->first == config) {
             // We already have batches for the same config. Merge the new ones in.
@@ -273,6 +285,18 @@ void IndirectDrawMetadata::AddMultiDrawIndexedIndirect(BufferBase* indexBuffer,
     mMultiDraws.push_back(multiDraw);
 }
 
+void IndirectDrawMetadata::SetValidationDeferredToSubmit() {
+    mValidationDeferredToSubmit = true;
+}
+
+bool IndirectDrawMetadata::IsValidationDeferredToSubmit() const {
+    return mValidationDeferredToSubmit;
+}
+
+bool IndirectDrawMetadata::HasIndirectDrawsFromRenderBundles() const {
+    return mHasIndirectDrawsFromRenderBundles;
+}
+
 bool IndirectDrawMetadata::IndexedIndirectConfig::operator<(
     const IndexedIndirectConfig& other) const {
     return std::tie(inputIndirectBufferPtr, duplicateBaseVertexInstance, drawType) <
@@ -155,8 +155,13 @@ class IndirectDrawMetadata : public NonCopyable {
     IndirectDrawMetadata& operator=(IndirectDrawMetadata&&);
 
     IndexedIndirectBufferValidationInfoMap* GetIndexedIndirectBufferValidationInfo();
+    const IndexedIndirectBufferValidationInfoMap* GetIndexedIndirectBufferValidationInfo() const;
 
     void AddBundle(RenderBundleBase* bundle);
+
+    // Merges the indexed and non-indexed indirect draws of `other` into this metadata so that
+    // they are validated together. Multi-draws are not merged.
+    void AddIndirectDrawsFrom(const IndirectDrawMetadata& other);
     void AddIndexedIndirectDraw(wgpu::IndexFormat indexFormat,
                                 uint64_t indexBufferSize,
                                 uint64_t indexBufferOffset,
@@ -186,6 +191,15 @@ class IndirectDrawMetadata : public NonCopyable {
 
     const std::vector<IndirectMultiDraw>& GetIndirectMultiDraws() const;
 
+    // Marks the indirect draws of this render pass as being validated at Queue::Submit instead
+    // of when the render pass ends. Until then, their commands have no indirect buffer set.
+    void SetValidationDeferredToSubmit();
+    bool IsValidationDeferredToSubmit() const;
+
+    // Whether some of the indirect draws come from executed render bundles. Their commands are
+    // shared with every other render pass executing the same bundles.
+    bool HasIndirectDrawsFromRenderBundles() const;
+
   private:
     IndexedIndirectBufferValidationInfoMap mIndexedIndirectBufferValidationInfo;
     absl::flat_hash_set<RenderBundleBase*> mAddedBundles;
@@ -194,6 +208,9 @@ class IndirectDrawMetadata : public NonCopyable {
 
     uint64_t mMaxBatchOffsetRange;
     uint32_t mMaxDrawCallsPerBatch;
+
+    bool mHasIndirectDrawsFromRenderBundles = false;
+    bool mValidationDeferredToSubmit = false;
 };
 
 }  // namespace dawn::native
@@ -35,10 +35,12 @@
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_set.h"
 #include "dawn/common/Constants.h"
 #include "dawn/common/Math.h"
 #include "dawn/native/BindGroup.h"
 #include "dawn/native/BindGroupLayout.h"
+#include "dawn/native/CommandBuffer.h"
 #include "dawn/native/CommandEncoder.h"
 #include "dawn/native/ComputePassEncoder.h"
 #include "dawn/native/ComputePipeline.h"
@@ -439,10 +441,39 @@ uint32_t ComputeMaxDrawCallsPerIndirectValidationBatch(const CombinedLimits& lim
                   uint64_t(std::numeric_limits<uint32_t>::max())}));
 }
 
-MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
-                                                CommandEncoder* commandEncoder,
-                                                RenderPassResourceUsageTracker* usageTracker,
-                                                IndirectDrawMetadata* indirectDrawMetadata) {
+namespace {
+
+// Conservatively adds to `writtenBuffers` all the buffers that may be written by a command
+// buffer with the given usages.
+void AddPossiblyWrittenBuffers(const CommandBufferResourceUsage& usages,
+                               absl::flat_hash_set<BufferBase*>* writtenBuffers) {
+    auto AddWrittenBuffersInSyncScope = [&](const SyncScopeResourceUsage& usage) {
+        for (size_t i = 0; i < usage.buffers.size(); ++i) {
+            if ((usage.bufferSyncInfos[i].usage & ~kReadOnlyBufferUsages) != 0) {
+                writtenBuffers->insert(usage.buffers[i]);
+            }
+        }
+    };
+    for (const RenderPassResourceUsage& usage : usages.renderPasses) {
+        AddWrittenBuffersInSyncScope(usage);
+    }
+    for (const ComputePassResourceUsage& pass : usages.computePasses) {
+        for (const SyncScopeResourceUsage& usage : pass.dispatchUsages) {
+            AddWrittenBuffersInSyncScope(usage);
+        }
+    }
+    // Buffers used outside of passes are copy sources or destinations. Don't bother telling
+    // them apart.
+    writtenBuffers->insert(usages.topLevelBuffers.begin(), usages.topLevelBuffers.end());
+}
+
+// `usageTracker` may only be null if there are no multi-draws. In that case the caller is
+// responsible for tracking the usage of `outputParamsBuffer` as an indirect buffer.
+MaybeError EncodeIndirectDrawValidationCommandsImpl(DeviceBase* device,
+                                                    CommandEncoder* commandEncoder,
+                                                    RenderPassResourceUsageTracker* usageTracker,
+                                                    IndirectDrawMetadata* indirectDrawMetadata,
+                                                    ScratchBuffer& outputParamsBuffer) {
     DAWN_ASSERT(device->IsLockedByCurrentThreadIfNeeded());
     // Since encoding validation commands may create new objects, verify that the device is alive.
     // TODO(dawn:1199): This check is obsolete if device loss causes device.destroy().
@@ -492,6 +523,7 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
     if (bufferInfoMap.empty() && multiDraws.empty()) {
         return {};
     }
+    DAWN_ASSERT(usageTracker != nullptr || multiDraws.empty());
 
     const uint64_t maxStorageBufferBindingSize = device->GetLimits().v1.maxStorageBufferBindingSize;
     const uint32_t minStorageBufferOffsetAlignment =
@@ -624,7 +656,6 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
     }
 
     auto* const store = device->GetInternalPipelineStore();
-    ScratchBuffer& outputParamsBuffer = store->scratchIndirectStorage;
     ScratchBuffer& batchDataBuffer = store->scratchStorage;
 
     uint64_t requiredBatchDataBufferSize = 0;
@@ -642,8 +673,10 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
     // We swap the indirect buffer used so we need to explicitly add the usage.
     // `outputParamsBuffer` is an internal buffer so we don't need to validate it against the
     // resource usage scope rules.
-    usageTracker->BufferUsedAs(outputParamsBuffer.GetBuffer(),
-                               kIndirectBufferForBackendResourceTracking);
+    if (usageTracker != nullptr) {
+        usageTracker->BufferUsedAs(outputParamsBuffer.GetBuffer(),
+                                   kIndirectBufferForBackendResourceTracking);
+    }
 
     // Now we allocate and populate host-side batch data to be copied to the GPU.
     for (Pass& pass : passes) {
@@ -740,6 +773,7 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
                     (batch.batchInfo->numDraws + kWorkgroupSize - 1) / kWorkgroupSize;
                 passEncoder->APISetBindGroup(0, bindGroup.Get());
                 passEncoder->APIDispatchWorkgroups(numDrawsRoundedUp);
+                device->IncrementIndirectDrawValidationDispatchCountForTesting();
             }
 
             passEncoder->APIEnd();
@@ -872,6 +906,7 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
             // Integer division rounds down so adding 1 if there is a remainder.
             workgroupCount += cmd->maxDrawCount % kWorkgroupSize == 0 ? 0 : 1;
             passEncoder->APIDispatchWorkgroups(workgroupCount);
+            device->IncrementIndirectDrawValidationDispatchCountForTesting();
             passEncoder->APIEnd();
 
             // Update the draw command to use the validated indirect buffer.
@@ -889,4 +924,108 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
 
     return {};
 }
+
+}  // namespace
+
+MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
+                                                CommandEncoder* commandEncoder,
+                                                RenderPassResourceUsageTracker* usageTracker,
+                                                IndirectDrawMetadata* indirectDrawMetadata) {
+    return EncodeIndirectDrawValidationCommandsImpl(
+        device, commandEncoder, usageTracker, indirectDrawMetadata,
+        device->GetInternalPipelineStore()->scratchIndirectStorage);
+}
+
+MaybeError EncodeDeferredIndirectDrawValidationCommands(
+    DeviceBase* device,
+    uint32_t commandCount,
+    CommandBufferBase* const* commands,
+    std::vector<Ref<CommandBufferBase>>* commandsToSubmit) {
+    DAWN_ASSERT(commandsToSubmit->empty());
+
+    auto HasDeferredValidation = [](CommandBufferBase* commandBuffer) {
+        return std::any_of(commandBuffer->GetIndirectDrawMetadata().begin(),
+                           commandBuffer->GetIndirectDrawMetadata().end(),
+                           [](const IndirectDrawMetadata& metadata) {
+                               return metadata.IsValidationDeferredToSubmit();
+                           });
+    };
+    if (std::none_of(commands, commands + commandCount, HasDeferredValidation)) {
+        return {};
+    }
+
+    ScratchBuffer& outputParamsBuffer =
+        device->GetInternalPipelineStore()->scratchDeferredIndirectStorage;
+
+    // The command buffers are split into runs. The deferred indirect draws of a run are merged
+    // together and validated by a single command buffer submitted before the run. A new run is
+    // started each time a command buffer may read indirect parameters written by an earlier
+    // command buffer of the current run.
+    std::vector<CommandBufferBase*> run;
+    IndirectDrawMetadata runMetadata(device->GetLimits());
+    absl::flat_hash_set<BufferBase*> buffersWrittenInRun;
+
+    auto FlushRun = [&]() -> MaybeError {
+        if (!runMetadata.GetIndexedIndirectBufferValidationInfo()->empty()) {
+            Ref<CommandEncoder> encoder;
+            DAWN_TRY_ASSIGN(encoder, device->CreateCommandEncoder());
+            DAWN_TRY(EncodeIndirectDrawValidationCommandsImpl(device, encoder.Get(), nullptr,
+                                                              &runMetadata, outputParamsBuffer));
+
+            Ref<CommandBufferBase> validationCommands;
+            DAWN_TRY_ASSIGN(validationCommands, encoder->Finish());
+            commandsToSubmit->push_back(std::move(validationCommands));
+
+            // The deferred indirect draws now use the validated parameters, so the render passes
+            // need to track the output buffer for the backends' barriers.
+            for (CommandBufferBase* commandBuffer : run) {
+                const std::vector<IndirectDrawMetadata>& passesMetadata =
+                    commandBuffer->GetIndirectDrawMetadata();
+                for (size_t i = 0; i < passesMetadata.size(); ++i) {
+                    if (passesMetadata[i].IsValidationDeferredToSubmit()) {
+                        commandBuffer->TrackRenderPassBufferUsage(
+                            i, outputParamsBuffer.GetBuffer(),
+                            kIndirectBufferForBackendResourceTracking);
+                    }
+                }
+            }
+        }
+
+        commandsToSubmit->insert(commandsToSubmit->end(), run.begin(), run.end());
+        run.clear();
+        runMetadata = IndirectDrawMetadata(device->GetLimits());
+        buffersWrittenInRun.clear();
+        return {};
+    };
+
+    for (uint32_t i = 0; i < commandCount; ++i) {
+        CommandBufferBase* commandBuffer = commands[i];
+
+        bool readsBufferWrittenInRun = false;
+        for (const IndirectDrawMetadata& metadata : commandBuffer->GetIndirectDrawMetadata()) {
+            if (!metadata.IsValidationDeferredToSubmit()) {
+                continue;
+            }
+            for (const auto& [config, validationInfo] :
+                 *metadata.GetIndexedIndirectBufferValidationInfo()) {
+                if (buffersWrittenInRun.contains(validationInfo.GetIndirectBuffer())) {
+                    readsBufferWrittenInRun = true;
+                }
+            }
+        }
+        if (readsBufferWrittenInRun) {
+            DAWN_TRY(FlushRun());
+        }
+
+        for (const IndirectDrawMetadata& metadata : commandBuffer->GetIndirectDrawMetadata()) {
+            if (metadata.IsValidationDeferredToSubmit()) {
+                runMetadata.AddIndirectDrawsFrom(metadata);
+            }
+        }
+        run.push_back(commandBuffer);
+        AddPossiblyWrittenBuffers(commandBuffer->GetResourceUsages(), &buffersWrittenInRun);
+    }
+    return FlushRun();
+}
+
 }  // namespace dawn::native
@@ -28,11 +28,15 @@
 #ifndef SRC_DAWN_NATIVE_INDIRECTDRAWVALIDATIONENCODER_H_
 #define SRC_DAWN_NATIVE_INDIRECTDRAWVALIDATIONENCODER_H_
 
+#include <vector>
+
+#include "dawn/common/Ref.h"
 #include "dawn/native/Error.h"
 #include "dawn/native/IndirectDrawMetadata.h"
 
 namespace dawn::native {
 
+class CommandBufferBase;
 class CommandEncoder;
 struct CombinedLimits;
 class DeviceBase;
@@ -48,6 +52,16 @@ MaybeError EncodeIndirectDrawValidationCommands(DeviceBase* device,
                                                 RenderPassResourceUsageTracker* usageTracker,
                                                 IndirectDrawMetadata* indirectDrawMetadata);
 
+// Validates the indirect draws of the render passes in `commands` whose validation was deferred
+// to Queue::Submit, merging them so that they need as few dispatches as possible. The command
+// buffers doing the validation are interleaved with `commands` in `commandsToSubmit`, which is
+// left empty if there is nothing to validate.
+MaybeError EncodeDeferredIndirectDrawValidationCommands(
+    DeviceBase* device,
+    uint32_t commandCount,
+    CommandBufferBase* const* commands,
+    std::vector<Ref<CommandBufferBase>>* commandsToSubmit);
+
 }  // namespace dawn::native
 
 #endif  // SRC_DAWN_NATIVE_INDIRECTDRAWVALIDATIONENCODER_H_
@@ -27,8 +27,11 @@
 
 #include "dawn/native/Instance.h"
 
+#include <atomic>
+#include <string>
 #include <utility>
 
+#include "absl/strings/str_format.h"
 #include "dawn/common/Assert.h"
 #include "dawn/common/FutureUtils.h"
 #include "dawn/common/GPUInfo.h"
@@ -44,6 +47,7 @@
 #include "dawn/native/Toggles.h"
 #include "dawn/native/ValidationUtils_autogen.h"
 #include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/tracing/JSONTracingPlatform.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 #include "tint/lang/wgsl/feature_status.h"
 
@@ -257,8 +261,26 @@ void InstanceBase::WillDropLastExternalRef() {
 
 // TODO(crbug.com/dawn/832): make the platform an initialization parameter of the instance.
 MaybeError InstanceBase::Initialize(const UnpackedPtr<InstanceDescriptor>& descriptor) {
-    // Initialize the platform to the default for now.
-    mDefaultPlatform = std::make_unique<dawn::platform::Platform>();
+    // Initialize the platform to the default for now. If DAWN_TRACE_EVENTS_FILE_BASE is set, the
+    // default platform writes the trace events to a JSON file so that Dawn can be profiled without
+    // an embedder that implements tracing.
+    if (auto [traceFileBase, traceFileBaseSet] = GetEnvironmentVar("DAWN_TRACE_EVENTS_FILE_BASE");
+        traceFileBaseSet) {
+        static std::atomic<uint32_t> sTraceFileCount = 0;
+        uint32_t count = sTraceFileCount.fetch_add(1, std::memory_order_relaxed);
+        std::string tracePath = absl::StrFormat("%s-i%03d.json", traceFileBase, count);
+
+        auto tracingPlatform =
+            std::make_unique<dawn::platform::tracing::JSONTracingPlatform>(tracePath);
+        if (tracingPlatform->IsValid()) {
+            mDefaultPlatform = std::move(tracingPlatform);
+        } else {
+            dawn::WarningLog() << "Could not open the trace events file " << tracePath;
+        }
+    }
+    if (mDefaultPlatform == nullptr) {
+        mDefaultPlatform = std::make_unique<dawn::platform::Platform>();
+    }
     SetPlatform(mDefaultPlatform.get());
 
     // Process DawnInstanceDescriptor
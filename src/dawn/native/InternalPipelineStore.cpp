@@ -40,6 +40,9 @@ class ShaderModuleBase;
 InternalPipelineStore::InternalPipelineStore(DeviceBase* device)
     : scratchStorage(device, wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::Storage),
       scratchIndirectStorage(
+          device,
+          wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::Indirect | wgpu::BufferUsage::Storage),
+      scratchDeferredIndirectStorage(
           device,
           wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::Indirect | wgpu::BufferUsage::Storage) {}
 
@@ -48,6 +51,7 @@ InternalPipelineStore::~InternalPipelineStore() = default;
 void InternalPipelineStore::ResetScratchBuffers() {
     scratchStorage.Reset();
     scratchIndirectStorage.Reset();
+    scratchDeferredIndirectStorage.Reset();
 }
 
 }  // namespace dawn::native
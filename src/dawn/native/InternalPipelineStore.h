@@ -73,6 +73,11 @@ struct InternalPipelineStore {
     // buffer for indirect dispatch or draw calls.
     ScratchBuffer scratchIndirectStorage;
 
+    // Same as scratchIndirectStorage, but holding the indirect parameters validated at
+    // Queue::Submit so that they are not overwritten by the validation of render passes encoded
+    // later.
+    ScratchBuffer scratchDeferredIndirectStorage;
+
     Ref<ShaderModuleBase> indirectDrawValidationShader;
     Ref<ComputePipelineBase> indirectDrawValidationPipeline;
     Ref<ComputePipelineBase> multiDrawValidationPipeline;
@@ -44,6 +44,7 @@ void PooledResourceMemoryAllocator::FreeRecycledAllocations() {
     for (auto& resourceHeap : mPool) {
         DAWN_ASSERT(resourceHeap != nullptr);
         mHeapAllocator->DeallocateResourceHeap(std::move(resourceHeap));
+        mStatistics.RemoveReservedMemory(mHeapSize);
     }
 
     mPool.clear();
@@ -60,9 +61,14 @@ PooledResourceMemoryAllocator::AllocateResourceHeap(uint64_t size) {
         mPool.pop_front();
     }
 
+    DAWN_ASSERT(mHeapSize == 0 || mHeapSize == size);
+    mHeapSize = size;
+
     if (memory == nullptr) {
         DAWN_TRY_ASSIGN(memory, mHeapAllocator->AllocateResourceHeap(size));
+        mStatistics.AddReservedMemory(size);
     }
+    mStatistics.AddAllocation(size);
 
     return std::move(memory);
 }
@@ -70,6 +76,11 @@ PooledResourceMemoryAllocator::AllocateResourceHeap(uint64_t size) {
 void PooledResourceMemoryAllocator::DeallocateResourceHeap(
     std::unique_ptr<ResourceHeapBase> allocation) {
     mPool.push_front(std::move(allocation));
+    mStatistics.RemoveAllocation(mHeapSize);
+}
+
+MemoryAllocatorStatistics PooledResourceMemoryAllocator::GetStatistics() const {
+    return mStatistics.Get();
 }
 
 uint64_t PooledResourceMemoryAllocator::GetPoolSizeForTesting() const {
@@ -32,6 +32,7 @@
 #include <memory>
 
 #include "dawn/common/SerialQueue.h"
+#include "dawn/native/AllocatorStatistics.h"
 #include "dawn/native/ResourceHeapAllocator.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 
@@ -53,6 +54,10 @@ class PooledResourceMemoryAllocator : public ResourceHeapAllocator {
 
     void FreeRecycledAllocations();
 
+    // The used size is the size of the heaps handed out and the reserved size also includes the
+    // heaps kept in the pool.
+    MemoryAllocatorStatistics GetStatistics() const;
+
     // For testing purposes.
     uint64_t GetPoolSizeForTesting() const;
 
@@ -60,6 +65,10 @@ class PooledResourceMemoryAllocator : public ResourceHeapAllocator {
     raw_ptr<ResourceHeapAllocator> mHeapAllocator = nullptr;
 
     std::deque<std::unique_ptr<ResourceHeapBase>> mPool;
+
+    // All the heaps of the pool have the same size.
+    uint64_t mHeapSize = 0;
+    AllocatorStatisticsTracker mStatistics;
 };
 
 }  // namespace dawn::native
@@ -51,6 +51,7 @@
 #include "dawn/native/DynamicUploader.h"
 #include "dawn/native/EventManager.h"
 #include "dawn/native/ExternalTexture.h"
+#include "dawn/native/IndirectDrawValidationEncoder.h"
 #include "dawn/native/Instance.h"
 #include "dawn/native/ObjectType_autogen.h"
 #include "dawn/native/QuerySet.h"
@@ -236,6 +237,9 @@ Future QueueBase::APIOnSubmittedWorkDone(const WGPUQueueWorkDoneCallbackInfo& ca
         } else if (GetDevice()->ConsumedError(ValidateOnSubmittedWorkDone())) {
             event =
                 AcquireRef(new WorkDoneEvent(callbackInfo, this, wgpu::QueueWorkDoneStatus::Error));
+        } else if (GetDevice()->ConsumedError(RecordDeferredCommands())) {
+            event =
+                AcquireRef(new WorkDoneEvent(callbackInfo, this, wgpu::QueueWorkDoneStatus::Error));
         } else {
             event = AcquireRef(new WorkDoneEvent(callbackInfo, this, GetScheduledWorkDoneSerial()));
         }
@@ -298,6 +302,14 @@ void QueueBase::Tick(ExecutionSerial finishedSerial) {
     }
 }
 
+MaybeError QueueBase::RecordDeferredCommands() {
+    DynamicUploader* uploader = GetDevice()->GetDynamicUploader();
+    if (uploader == nullptr) {
+        return {};
+    }
+    return uploader->FlushCombinedWrite();
+}
+
 void QueueBase::HandleDeviceLoss() {
     mTasksInFlight.Use([&](auto tasksInFlight) {
         for (auto& task : tasksInFlight->IterateAll()) {
@@ -322,6 +334,7 @@ MaybeError QueueBase::WriteBuffer(BufferBase* buffer,
                                   uint64_t bufferOffset,
                                   const void* data,
                                   size_t size) {
+    TRACE_EVENT0(GetDevice()->GetPlatform(), General, "Queue::WriteBuffer");
     DAWN_TRY(GetDevice()->ValidateIsAlive());
     DAWN_TRY(GetDevice()->ValidateObject(this));
     DAWN_TRY(ValidateWriteBuffer(GetDevice(), buffer, bufferOffset, size));
@@ -352,6 +365,7 @@ MaybeError QueueBase::WriteTextureInternal(const TexelCopyTextureInfo* destinati
                                            size_t dataSize,
                                            const TexelCopyBufferLayout& dataLayout,
                                            const Extent3D* writeSize) {
+    TRACE_EVENT0(GetDevice()->GetPlatform(), General, "Queue::WriteTexture");
     TexelCopyTextureInfo destination = destinationOrig->WithTrivialFrontendDefaults();
 
     DAWN_TRY(ValidateWriteTexture(&destination, dataSize, dataLayout, writeSize));
@@ -587,6 +601,23 @@ MaybeError QueueBase::SubmitInternal(uint32_t commandCount, CommandBufferBase* c
     }
     DAWN_ASSERT(!IsError());
 
+    // Render passes might have deferred the validation of their indirect draws until now, in
+    // which case additional command buffers are inserted to do it.
+    std::vector<Ref<CommandBufferBase>> commandsWithValidation;
+    DAWN_TRY(EncodeDeferredIndirectDrawValidationCommands(device, commandCount, commands,
+                                                          &commandsWithValidation));
+    std::vector<CommandBufferBase*> commandsToSubmit;
+    if (!commandsWithValidation.empty()) {
+        for (const Ref<CommandBufferBase>& commandBuffer : commandsWithValidation) {
+            commandsToSubmit.push_back(commandBuffer.Get());
+        }
+        commandCount = static_cast<uint32_t>(commandsToSubmit.size());
+        commands = commandsToSubmit.data();
+    }
+
+    // Writes held back for coalescing must execute before the submitted commands.
+    DAWN_TRY(RecordDeferredCommands());
+
     mInSubmit = true;
     DAWN_TRY(SubmitImpl(commandCount, commands));
     mInSubmit = false;
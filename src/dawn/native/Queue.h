@@ -111,6 +111,8 @@ class QueueBase : public ApiObjectBase,
     void Tick(ExecutionSerial finishedSerial);
     void HandleDeviceLoss();
 
+    MaybeError RecordDeferredCommands() override;
+
   protected:
     QueueBase(DeviceBase* device, const QueueDescriptor* descriptor);
     QueueBase(DeviceBase* device, ObjectBase::ErrorTag tag, StringView label);
@@ -59,6 +59,7 @@ RenderBundleBase::RenderBundleBase(RenderBundleEncoder* encoder,
 void RenderBundleBase::DestroyImpl() {
     mIndirectDrawMetadata.ClearIndexedIndirectBufferValidationInfo();
     FreeCommands(&mCommands);
+    mBackendData = nullptr;
 
     // Remove reference to the attachment state so that we don't have lingering references to
     // it preventing it from being uncached in the device.
@@ -132,4 +133,16 @@ const IndirectDrawMetadata& RenderBundleBase::GetIndirectDrawMetadata() {
     return mIndirectDrawMetadata;
 }
 
+RenderBundleBase::BackendData::~BackendData() = default;
+
+RenderBundleBase::BackendData* RenderBundleBase::GetBackendData() const {
+    DAWN_ASSERT(!IsError());
+    return mBackendData.get();
+}
+
+void RenderBundleBase::SetBackendData(std::unique_ptr<BackendData> data) {
+    DAWN_ASSERT(!IsError());
+    mBackendData = std::move(data);
+}
+
 }  // namespace dawn::native
@@ -29,6 +29,7 @@
 #define SRC_DAWN_NATIVE_RENDERBUNDLE_H_
 
 #include <bitset>
+#include <memory>
 #include <string>
 
 #include "dawn/common/Constants.h"
@@ -74,6 +75,16 @@ class RenderBundleBase final : public ApiObjectBase {
     const RenderPassResourceUsage& GetResourceUsage() const;
     const IndirectDrawMetadata& GetIndirectDrawMetadata();
 
+    // Backend-specific state that a backend can attach to the bundle the first time it is
+    // executed, e.g. pre-recorded native command buffers. It is released when the bundle is
+    // destroyed.
+    class BackendData {
+      public:
+        virtual ~BackendData();
+    };
+    BackendData* GetBackendData() const;
+    void SetBackendData(std::unique_ptr<BackendData> data);
+
   private:
     RenderBundleBase(DeviceBase* device, ErrorTag errorTag, StringView label);
 
@@ -87,6 +98,7 @@ class RenderBundleBase final : public ApiObjectBase {
     uint64_t mDrawCount;
     RenderPassResourceUsage mResourceUsage;
     std::string mEncoderLabel;
+    std::unique_ptr<BackendData> mBackendData;
 };
 
 }  // namespace dawn::native
@@ -44,6 +44,7 @@
 #include "dawn/native/RenderBundle.h"
 #include "dawn/native/RenderPipeline.h"
 #include "dawn/native/ValidationUtils.h"
+#include "dawn/platform/tracing/TraceEvent.h"
 
 namespace dawn::native {
 namespace {
@@ -167,6 +168,7 @@ void RenderPassEncoder::APIEnd() {
 
 void RenderPassEncoder::End() {
     DAWN_ASSERT(GetDevice()->IsLockedByCurrentThreadIfNeeded());
+    TRACE_EVENT0(GetDevice()->GetPlatform(), Recording, "RenderPassEncoder::End");
 
     if (mEnded && IsValidationEnabled()) {
         GetDevice()->HandleError(DAWN_VALIDATION_ERROR("%s was already ended.", this));
@@ -27,9 +27,11 @@
 
 #include "dawn/native/RingBufferAllocator.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "dawn/common/Math.h"
+#include "dawn/native/AllocatorStatistics.h"
 
 // Note: Current RingBufferAllocator implementation uses two indices (start and end) to implement a
 // circular queue. However, this approach defines a full queue when one element is still unused.
@@ -60,6 +62,7 @@ void RingBufferAllocator::Deallocate(ExecutionSerial lastCompletedSerial) {
     for (Request& request : mInflightRequests.IterateUpTo(lastCompletedSerial)) {
         mUsedStartOffset = request.endOffset;
         mUsedSize -= request.size;
+        mAllocationCount--;
     }
 
     // Dequeue previously recorded requests.
@@ -74,6 +77,17 @@ uint64_t RingBufferAllocator::GetUsedSize() const {
     return mUsedSize;
 }
 
+MemoryAllocatorStatistics RingBufferAllocator::GetStatistics() const {
+    MemoryAllocatorStatistics statistics;
+    statistics.usedSize = mUsedSize;
+    statistics.peakUsedSize = mPeakUsedSize;
+    statistics.reservedSize = mMaxBlockSize;
+    statistics.peakReservedSize = mMaxBlockSize;
+    statistics.allocationCount = mAllocationCount;
+    UpdateFragmentation(&statistics);
+    return statistics;
+}
+
 bool RingBufferAllocator::Empty() const {
     return mInflightRequests.Empty();
 }
@@ -142,6 +156,8 @@ uint64_t RingBufferAllocator::Allocate(uint64_t allocationSize,
         request.size = currentRequestSize;
 
         mInflightRequests.Enqueue(std::move(request), serial);
+        mAllocationCount++;
+        mPeakUsedSize = std::max(mPeakUsedSize, mUsedSize);
     }
 
     return startOffset;
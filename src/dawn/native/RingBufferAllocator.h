@@ -32,6 +32,7 @@
 #include <memory>
 
 #include "dawn/common/SerialQueue.h"
+#include "dawn/native/DawnNative.h"
 #include "dawn/native/IntegerTypes.h"
 
 // RingBufferAllocator is the front-end implementation used to manage a ring buffer in GPU memory.
@@ -54,6 +55,9 @@ class RingBufferAllocator {
     uint64_t GetSize() const;
     bool Empty() const;
     uint64_t GetUsedSize() const;
+    // The used size includes the space lost to alignment and wrapping around, and the reserved
+    // size is the size of the ring buffer.
+    MemoryAllocatorStatistics GetStatistics() const;
 
     static constexpr uint64_t kInvalidOffset = std::numeric_limits<uint64_t>::max();
 
@@ -70,6 +74,8 @@ class RingBufferAllocator {
     uint64_t mUsedStartOffset = 0;  // Head of used sub-alloc requests (in bytes).
     uint64_t mMaxBlockSize = 0;     // Max size of the ring buffer (in bytes).
     uint64_t mUsedSize = 0;         // Size of the sub-alloc requests (in bytes) of the ring buffer.
+    uint64_t mPeakUsedSize = 0;     // High-water mark of mUsedSize.
+    uint64_t mAllocationCount = 0;  // Number of sub-alloc requests in flight.
 };
 }  // namespace dawn::native
 
@@ -48,6 +48,8 @@
 #include "dawn/native/Sampler.h"
 #include "dawn/native/ShaderModuleParseRequest.h"
 #include "dawn/native/TintUtils.h"
+#include "dawn/platform/metrics/HistogramMacros.h"
+#include "dawn/platform/tracing/TraceEvent.h"
 
 #ifdef DAWN_ENABLE_SPIRV_VALIDATION
 #include "dawn/native/SpirvValidation.h"
@@ -55,6 +57,11 @@
 
 #include "tint/tint.h"
 
+#if TINT_BUILD_IR_BINARY
+#include "src/tint/lang/core/ir/binary/decode.h"
+#include "src/tint/lang/core/ir/binary/encode.h"
+#endif
+
 namespace dawn::native {
 
 namespace {
@@ -1389,6 +1396,111 @@ std::unique_ptr<ErrorData> CachedValidationError::ToErrorData() const {
     return error;
 }
 
+TintProgram::TintProgram(tint::Program program, std::unique_ptr<tint::Source::File> file)
+    : program(std::move(program)), file(std::move(file)) {}
+
+TintProgram::~TintProgram() = default;
+
+tint::Result<tint::core::ir::Module> TintProgram::CreateLoweredIR() const {
+    std::optional<tint::Result<tint::core::ir::Module>> firstResult;
+    std::call_once(mLoweredIROnce, [&] {
+        mLoweringCount++;
+        firstResult = tint::wgsl::reader::ProgramToLoweredIR(program);
+        if (*firstResult != tint::Success) {
+            mLoweringFailure = firstResult->Failure();
+            return;
+        }
+#if TINT_BUILD_IR_BINARY
+        auto encoded = tint::core::ir::binary::EncodeToBinary(firstResult->Get());
+        if (encoded == tint::Success) {
+            mEncodedLoweredIR = encoded.Move();
+        }
+#endif
+    });
+
+    // The caller that did the conversion gets the module that was just lowered.
+    if (firstResult.has_value()) {
+        return std::move(*firstResult);
+    }
+    if (mLoweringFailure.has_value()) {
+        return *mLoweringFailure;
+    }
+#if TINT_BUILD_IR_BINARY
+    if (!mEncodedLoweredIR.IsEmpty()) {
+        auto decoded = tint::core::ir::binary::Decode(mEncodedLoweredIR.Slice());
+        if (decoded == tint::Success) {
+            return decoded;
+        }
+    }
+#endif
+    mLoweringCount++;
+    return tint::wgsl::reader::ProgramToLoweredIR(program);
+}
+
+uint32_t TintProgram::GetLoweringCountForTesting() const {
+    return mLoweringCount;
+}
+
+ResultOrError<tint::core::ir::Module> TintProgram::CreatePreOverrideIR(
+    dawn::platform::Platform* platform,
+    std::string_view entryPointName) const {
+    tint::Result<tint::core::ir::Module> ir;
+    {
+        SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(platform, "ShaderModuleProgramToIR");
+#if TINT_BUILD_IR_BINARY
+        auto cached = mPreOverrideIRCache.Use(
+            [&](auto cache) -> std::shared_ptr<const tint::Vector<std::byte, 0>> {
+                auto it = cache->encodedModules.find(entryPointName);
+                return it != cache->encodedModules.end() ? it->second : nullptr;
+            });
+        if (cached != nullptr) {
+            auto decoded = tint::core::ir::binary::Decode(cached->Slice());
+            if (decoded == tint::Success) {
+                mPreOverrideIRCacheHitCount++;
+                return decoded.Move();
+            }
+        }
+#endif
+
+        ir = CreateLoweredIR();
+        DAWN_INVALID_IF(ir != tint::Success, "An error occurred while generating Tint IR\n%s",
+                        ir.Failure().reason);
+    }
+
+    {
+        SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(platform, "ShaderModuleSingleEntryPoint");
+        auto singleEntryPointResult =
+            tint::core::ir::transform::SingleEntryPoint(ir.Get(), entryPointName);
+        DAWN_INVALID_IF(singleEntryPointResult != tint::Success,
+                        "Pipeline single entry point (IR) failed:\n%s",
+                        singleEntryPointResult.Failure().reason);
+    }
+
+#if TINT_BUILD_IR_BINARY
+    auto encoded = tint::core::ir::binary::EncodeToBinary(ir.Get());
+    if (encoded == tint::Success) {
+        mPreOverrideIRCache.Use([&](auto cache) {
+            auto [it, inserted] = cache->encodedModules.try_emplace(
+                std::string(entryPointName),
+                std::make_shared<const tint::Vector<std::byte, 0>>(encoded.Move()));
+            if (!inserted) {
+                return;
+            }
+            cache->entryPoints.emplace_back(entryPointName);
+            if (cache->entryPoints.size() > kMaxPreOverrideIREntryPoints) {
+                cache->encodedModules.erase(cache->entryPoints.front());
+                cache->entryPoints.pop_front();
+            }
+        });
+    }
+#endif
+    return ir.Move();
+}
+
+uint32_t TintProgram::GetPreOverrideIRCacheHitCountForTesting() const {
+    return mPreOverrideIRCacheHitCount;
+}
+
 bool ShaderModuleParseResult::HasTintProgram() const {
     return tintProgram.UnsafeGetValue().has_value() &&
            tintProgram.UnsafeGetValue().value() != nullptr;
@@ -1438,6 +1550,7 @@ void DumpShaderFromDescriptor(LogEmitter* logEmitter,
 }
 
 ResultOrError<ShaderModuleParseResult> ParseShaderModule(ShaderModuleParseRequest req) {
+    TRACE_EVENT0(req.platform.UnsafeGetValue(), General, "ParseShaderModule");
     ShaderModuleParseResult outputParseResult;
 
     const ShaderModuleParseDeviceInfo& deviceInfo = req.deviceInfo;
@@ -1464,6 +1577,7 @@ ResultOrError<ShaderModuleParseResult> ParseShaderModule(ShaderModuleParseReques
 #endif  // DAWN_ENABLE_SPIRV_VALIDATION
         // Try parsing SpirV if no validation error.
         if (!outputParseResult.HasError()) {
+            TRACE_EVENT0(req.platform.UnsafeGetValue(), General, "tint::spirv::reader::Read()");
             DAWN_TRY(ParseSPIRV(spirvCode, deviceInfo.wgslAllowedFeatures, &outputParseResult,
                                 spirvDesc.allowNonUniformDerivatives));
         }
@@ -1482,12 +1596,14 @@ ResultOrError<ShaderModuleParseResult> ParseShaderModule(ShaderModuleParseReques
         const StringView& wgsl = wgslDesc.wgsl.UnsafeGetValue();
         auto tintFile = std::make_unique<tint::Source::File>("", wgsl);
 
+        TRACE_EVENT0(req.platform.UnsafeGetValue(), General, "tint::wgsl::reader::Parse()");
         DAWN_TRY(ParseWGSL(std::move(tintFile), deviceInfo.wgslAllowedFeatures, internalExtensions,
                            &outputParseResult));
     }
 
     // Generate reflection information if required and parsed succeed.
     if (outputParseResult.HasTintProgram() && req.needReflection) {
+        TRACE_EVENT0(req.platform.UnsafeGetValue(), General, "ReflectShaderUsingTint");
         ReflectShaderUsingTint(deviceInfo, &outputParseResult);
     }
 
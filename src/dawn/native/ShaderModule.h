@@ -28,10 +28,14 @@
 #ifndef SRC_DAWN_NATIVE_SHADERMODULE_H_
 #define SRC_DAWN_NATIVE_SHADERMODULE_H_
 
+#include <atomic>
 #include <bitset>
+#include <deque>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <variant>
@@ -68,6 +72,10 @@ class Program;
 
 }  // namespace tint
 
+namespace dawn::platform {
+class Platform;
+}  // namespace dawn::platform
+
 namespace dawn::native {
 
 struct EntryPointMetadata;
@@ -110,10 +118,47 @@ using EntryPointMetadataTable =
     absl::flat_hash_map<std::string, std::unique_ptr<EntryPointMetadata>>;
 
 struct TintProgram : public RefCounted {
-    TintProgram(tint::Program program, std::unique_ptr<tint::Source::File> file)
-        : program(std::move(program)), file(std::move(file)) {}
+    TintProgram(tint::Program program, std::unique_ptr<tint::Source::File> file);
+    ~TintProgram() override;
+
+    // Returns the program converted to lowered Tint IR, which the caller owns and may transform.
+    // The AST is only converted once per TintProgram: the lowered module is kept in its encoded
+    // form and the following calls decode a fresh copy of it.
+    tint::Result<tint::core::ir::Module> CreateLoweredIR() const;
+
+    // Returns the lowered Tint IR reduced to the single entry point `entryPointName`, with its
+    // overrides not yet substituted. Pipelines that only differ by their override constants share
+    // this work: the result is cached for the last kMaxPreOverrideIREntryPoints entry points, and
+    // the following calls decode a fresh copy.
+    ResultOrError<tint::core::ir::Module> CreatePreOverrideIR(
+        dawn::platform::Platform* platform,
+        std::string_view entryPointName) const;
+
+    // Returns how many times the AST was converted to IR by CreateLoweredIR.
+    uint32_t GetLoweringCountForTesting() const;
+    // Returns how many times CreatePreOverrideIR decoded a cached module.
+    uint32_t GetPreOverrideIRCacheHitCountForTesting() const;
+
+    static constexpr size_t kMaxPreOverrideIREntryPoints = 8;
+
     const tint::Program program;
     const std::unique_ptr<tint::Source::File> file;  // Keep the tint::Source::File alive
+
+  private:
+    mutable std::once_flag mLoweredIROnce;
+    // Empty if the lowered module could not be encoded, in which case it is lowered every time.
+    mutable tint::Vector<std::byte, 0> mEncodedLoweredIR;
+    mutable std::optional<tint::Failure> mLoweringFailure;
+    mutable std::atomic<uint32_t> mLoweringCount = 0;
+    // The encoded pre-override modules keyed by entry point name, and the names in insertion
+    // order so that the oldest entry is evicted first.
+    struct PreOverrideIRCache {
+        absl::flat_hash_map<std::string, std::shared_ptr<const tint::Vector<std::byte, 0>>>
+            encodedModules;
+        std::deque<std::string> entryPoints;
+    };
+    mutable MutexProtected<PreOverrideIRCache> mPreOverrideIRCache;
+    mutable std::atomic<uint32_t> mPreOverrideIRCacheHitCount = 0;
 };
 
 #define CACHED_VALIDATION_ERROR_MEMBER(X) \
@@ -60,6 +60,7 @@ ShaderModuleParseRequest BuildShaderModuleParseRequest(
     bool needReflection) {
     ShaderModuleParseRequest req;
     req.logEmitter = UnsafeUnserializedValue<LogEmitter*>(device);
+    req.platform = UnsafeUnserializedValue(device->GetPlatform());
     req.deviceInfo = {
         {.toggles = device->GetTogglesState().GetEnabledToggles(),
          .features = device->GetEnabledFeatures(),
@@ -35,6 +35,7 @@
 #include "dawn/native/Limits.h"
 #include "dawn/native/Serializable.h"
 #include "dawn/native/ShaderModule.h"
+#include "dawn/platform/DawnPlatform.h"
 
 namespace dawn::native {
 
@@ -82,11 +83,12 @@ DAWN_SERIALIZABLE(struct,
 using ShaderModuleParseDescriptionVariant =
     std::variant<ShaderModuleParseSpirvDescription, ShaderModuleParseWGSLDescription>;
 
-#define SHADER_MODULE_PARSE_REQUEST_MEMBER(X)                 \
-    X(UnsafeUnserializedValue<LogEmitter*>, logEmitter)       \
-    X(ShaderModuleParseDeviceInfo, deviceInfo)                \
-    X(ShaderModuleBase::ShaderModuleHash, shaderModuleHash)   \
-    X(ShaderModuleParseDescriptionVariant, shaderDescription) \
+#define SHADER_MODULE_PARSE_REQUEST_MEMBER(X)                       \
+    X(UnsafeUnserializedValue<LogEmitter*>, logEmitter)             \
+    X(UnsafeUnserializedValue<dawn::platform::Platform*>, platform) \
+    X(ShaderModuleParseDeviceInfo, deviceInfo)                      \
+    X(ShaderModuleBase::ShaderModuleHash, shaderModuleHash)         \
+    X(ShaderModuleParseDescriptionVariant, shaderDescription)       \
     X(bool, needReflection)
 
 DAWN_MAKE_CACHE_REQUEST(ShaderModuleParseRequest, SHADER_MODULE_PARSE_REQUEST_MEMBER);
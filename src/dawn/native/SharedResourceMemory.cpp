@@ -273,6 +273,8 @@ MaybeError SharedResourceMemory::EndAccess(Resource* resource, EndAccessState* s
         DAWN_INVALID_IF(mExclusiveAccess != resource,
                         "Cannot end access with %s on %s which is currently accessed by %s.",
                         resource, this, mExclusiveAccess.Get());
+        // A write to the buffer held back for coalescing is part of the access being ended.
+        DAWN_TRY(GetDevice()->GetQueue()->RecordDeferredCommands());
         mContents->mSharedResourceAccessState = SharedResourceAccessState::NotAccessed;
         mExclusiveAccess = nullptr;
     }
@@ -101,6 +101,10 @@ namespace dawn::native {
 // SubresourceStorage contains an inline array that contains the per-aspect compressed data
 // and only allocates a per-subresource on aspect decompression.
 //
+// The most common textures (render targets, most sampled textures) have a single array layer
+// and a single mip level. For them every aspect is always compressed and Update() and Merge()
+// skip the range computations entirely to act directly on the inline per-aspect data.
+//
 // T must be a copyable type that supports equality comparison with ==.
 //
 // The implementation of functions in this file can have a lot of control flow and corner cases
@@ -203,6 +207,7 @@ class SubresourceStorage {
     uint32_t GetMipLevelCountForTesting() const;
     bool IsAspectCompressedForTesting(Aspect aspect) const;
     bool IsLayerCompressedForTesting(Aspect aspect, uint32_t layer) const;
+    bool IsSingleSubresourceForTesting() const;
 
   private:
     template <typename U>
@@ -216,6 +221,12 @@ class SubresourceStorage {
 
     SubresourceRange GetFullLayerRange(Aspect aspect, uint32_t layer) const;
 
+    // The implementation of Update() for storages with more than one subresource per aspect.
+    // Merge() calls it directly so that its per-aspect and per-layer loops don't check
+    // mIsSingleSubresource again.
+    template <typename F>
+    void UpdateMultipleSubresources(const SubresourceRange& range, F&& updateFunc);
+
     // LayerCompressed should never be called when the aspect is compressed otherwise it would
     // need to check that mLayerCompressed is not null before indexing it.
     bool& LayerCompressed(uint32_t aspectIndex, uint32_t layerIndex);
@@ -232,6 +243,10 @@ class SubresourceStorage {
     uint8_t mMipLevelCount;
     uint16_t mArrayLayerCount;
 
+    // Whether there is a single subresource per aspect, in which case all aspects stay
+    // compressed for the lifetime of the storage and mData is never allocated.
+    bool mIsSingleSubresource;
+
     // Invariant: if an aspect is marked compressed, then all it's layers are marked as
     // compressed.
     static constexpr size_t kMaxAspects = 3;
@@ -252,7 +267,10 @@ SubresourceStorage<T>::SubresourceStorage(Aspect aspects,
                                           uint32_t arrayLayerCount,
                                           uint32_t mipLevelCount,
                                           const T& initialValue)
-    : mAspects(aspects), mMipLevelCount(mipLevelCount), mArrayLayerCount(arrayLayerCount) {
+    : mAspects(aspects),
+      mMipLevelCount(mipLevelCount),
+      mArrayLayerCount(arrayLayerCount),
+      mIsSingleSubresource(arrayLayerCount == 1 && mipLevelCount == 1) {
     DAWN_ASSERT(arrayLayerCount <= std::numeric_limits<decltype(mArrayLayerCount)>::max());
     DAWN_ASSERT(mipLevelCount <= std::numeric_limits<decltype(mMipLevelCount)>::max());
 
@@ -278,6 +296,24 @@ void SubresourceStorage<T>::Update(const SubresourceRange& range, F&& updateFunc
     DAWN_ASSERT(range.baseMipLevel < mMipLevelCount &&
                 range.baseMipLevel + range.levelCount <= mMipLevelCount);
 
+    // Fastest path, every aspect is compressed and any valid range covers whole aspects.
+    if (mIsSingleSubresource) {
+        for (Aspect aspect : IterateEnumMask(range.aspects)) {
+            updateFunc(SubresourceRange::MakeSingle(aspect, 0, 0),
+                       &DataInline(GetAspectIndex(aspect)));
+        }
+        return;
+    }
+
+    UpdateMultipleSubresources(range, updateFunc);
+}
+
+template <typename T>
+template <typename F>
+void SubresourceStorage<T>::UpdateMultipleSubresources(const SubresourceRange& range,
+                                                       F&& updateFunc) {
+    DAWN_ASSERT(!mIsSingleSubresource);
+
     bool fullLayers = range.baseMipLevel == 0 && range.levelCount == mMipLevelCount;
     bool fullAspects =
         range.baseArrayLayer == 0 && range.layerCount == mArrayLayerCount && fullLayers;
@@ -340,6 +376,16 @@ void SubresourceStorage<T>::Merge(const SubresourceStorage<U>& other, F&& mergeF
     DAWN_ASSERT(mArrayLayerCount == other.mArrayLayerCount);
     DAWN_ASSERT(mMipLevelCount == other.mMipLevelCount);
 
+    // Fastest path, both storages only have inline data so merge it aspect by aspect.
+    if (mIsSingleSubresource) {
+        for (Aspect aspect : IterateEnumMask(mAspects)) {
+            uint32_t aspectIndex = GetAspectIndex(aspect);
+            mergeFunc(SubresourceRange::MakeSingle(aspect, 0, 0), &DataInline(aspectIndex),
+                      other.DataInline(aspectIndex));
+        }
+        return;
+    }
+
     for (Aspect aspect : IterateEnumMask(mAspects)) {
         uint32_t aspectIndex = GetAspectIndex(aspect);
 
@@ -348,10 +394,11 @@ void SubresourceStorage<T>::Merge(const SubresourceStorage<U>& other, F&& mergeF
         // the aspect. For code simplicity this can be done with a call to Update().
         if (other.mAspectCompressed[aspectIndex]) {
             const U& otherData = other.DataInline(aspectIndex);
-            Update(SubresourceRange::MakeFull(aspect, mArrayLayerCount, mMipLevelCount),
-                   [&](const SubresourceRange& subrange, T* data) {
-                       mergeFunc(subrange, data, otherData);
-                   });
+            UpdateMultipleSubresources(
+                SubresourceRange::MakeFull(aspect, mArrayLayerCount, mMipLevelCount),
+                [&](const SubresourceRange& subrange, T* data) {
+                    mergeFunc(subrange, data, otherData);
+                });
             continue;
         }
 
@@ -364,10 +411,10 @@ void SubresourceStorage<T>::Merge(const SubresourceStorage<U>& other, F&& mergeF
             // Similarly to above, use a fast path if other's layer is compressed.
             if (other.LayerCompressed(aspectIndex, layer)) {
                 const U& otherData = other.Data(aspectIndex, layer);
-                Update(GetFullLayerRange(aspect, layer),
-                       [&](const SubresourceRange& subrange, T* data) {
-                           mergeFunc(subrange, data, otherData);
-                       });
+                UpdateMultipleSubresources(GetFullLayerRange(aspect, layer),
+                                           [&](const SubresourceRange& subrange, T* data) {
+                                               mergeFunc(subrange, data, otherData);
+                                           });
                 continue;
             }
 
@@ -485,8 +532,14 @@ bool SubresourceStorage<T>::IsLayerCompressedForTesting(Aspect aspect, uint32_t
            mLayerCompressed[GetAspectIndex(aspect) * mArrayLayerCount + layer];
 }
 
+template <typename T>
+bool SubresourceStorage<T>::IsSingleSubresourceForTesting() const {
+    return mIsSingleSubresource;
+}
+
 template <typename T>
 void SubresourceStorage<T>::DecompressAspect(uint32_t aspectIndex) {
+    DAWN_ASSERT(!mIsSingleSubresource);
     DAWN_ASSERT(mAspectCompressed[aspectIndex]);
     const T& aspectData = DataInline(aspectIndex);
     mAspectCompressed[aspectIndex] = false;
@@ -671,6 +671,59 @@ static constexpr ToggleEnumAndInfoList kToggleNameAndInfoList = {{
     {Toggle::EnableShaderPrint,
      {"enable_shader_print", "Enable print functions to produce output on supported devices.",
       "https://crbug.com/433534277", ToggleStage::Device}},
+    {Toggle::VulkanRecordRenderBundlesInSecondaryCommandBuffers,
+     {"vulkan_record_render_bundles_in_secondary_command_buffers",
+      "Record each render bundle once into a cached secondary VkCommandBuffer and replay it with "
+      "vkCmdExecuteCommands instead of re-encoding the bundle's commands on every execution. Only "
+      "render passes that contain nothing but ExecuteBundles of bundles without validated "
+      "indirect draws use the secondary command buffers.",
+      "https://registry.khronos.org/vulkan/specs/latest/man/html/vkCmdExecuteCommands.html",
+      ToggleStage::Device}},
+    {Toggle::BatchIndirectDrawValidationPerSubmit,
+     {"batch_indirect_draw_validation_per_submit",
+      "Defer the validation of indirect draw parameters from the end of each render pass to "
+      "Queue::Submit, where the draws of all the submitted render passes are validated together "
+      "in as few compute dispatches as possible. Render passes using multi-draws, or whose "
+      "indirect buffers may have been written earlier in the same command encoder, are still "
+      "validated when they end.",
+      "https://crbug.com/dawn/1108", ToggleStage::Device}},
+    {Toggle::VulkanBatchLazyClearsPerSubmit,
+     {"vulkan_batch_lazy_clears_per_submit",
+      "Lazily clear all the uninitialized texture subresources used in the passes of a submit up "
+      "front, coalesced per texture and behind a single barrier, instead of clearing them one "
+      "range at a time as each pass is recorded. Subresources written in the submit, and textures "
+      "used by copies in the submit, are still cleared as each pass is recorded.",
+      "https://crbug.com/dawn/851", ToggleStage::Device}},
+    {Toggle::CoalesceWriteBuffers,
+     {"coalesce_write_buffers",
+      "Hold back the staging copy of a Queue::WriteBuffer until the next queue operation so that "
+      "following WriteBuffers to the adjacent range of the same buffer can be merged into a single "
+      "copy.",
+      "https://crbug.com/42240396", ToggleStage::Device}},
+    {Toggle::VulkanAliasTransientAttachmentMemory,
+     {"vulkan_alias_transient_attachment_memory",
+      "Sub-allocate the memory of TransientAttachment textures from dedicated heaps and return it "
+      "to them as soon as the texture is destroyed, so that a transient attachment used in a later "
+      "submit can alias the memory of one that is destroyed after its submit, even while that "
+      "submit is still executing. The first use of each subresource of such a texture waits on "
+      "all previous GPU work. Has no effect when lazily allocated memory is available.",
+      "https://dawn.googlesource.com/dawn/+/refs/heads/main/docs/dawn/features/"
+      "transient_attachments.md",
+      ToggleStage::Device}},
+    {Toggle::TraceGPUPassDurations,
+     {"trace_gpu_pass_durations",
+      "Write timestamps around each render and compute pass and report the GPU duration of the "
+      "passes as GPUWork trace events once they have completed. Only takes effect if the GPUWork "
+      "trace category is enabled when the device is created. Currently only implemented on Vulkan.",
+      "https://dawn.googlesource.com/dawn/+/refs/heads/main/docs/dawn/debugging.md",
+      ToggleStage::Device}},
+    {Toggle::DisableIRConstantPropagation,
+     {"disable_ir_constant_propagation",
+      "Skip the constant propagation that folds the values made constant by the pipeline's "
+      "overridable constants before the shader is translated to the backend language. Used to "
+      "rule out the pass when diagnosing shader translation issues.",
+      "https://dawn.googlesource.com/dawn/+/refs/heads/main/docs/dawn/debugging.md",
+      ToggleStage::Device}},
     {Toggle::NoWorkaroundSampleMaskBecomesZeroForAllButLastColorTarget,
      {"no_workaround_sample_mask_becomes_zero_for_all_but_last_color_target",
       "MacOS 12.0+ Intel has a bug where the sample mask is only applied for the last color "
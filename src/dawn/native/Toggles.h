@@ -160,6 +160,13 @@ enum class Toggle {
     UseSpirv14,
     MetalUseArgumentBuffers,
     EnableShaderPrint,
+    VulkanRecordRenderBundlesInSecondaryCommandBuffers,
+    BatchIndirectDrawValidationPerSubmit,
+    VulkanBatchLazyClearsPerSubmit,
+    CoalesceWriteBuffers,
+    VulkanAliasTransientAttachmentMemory,
+    TraceGPUPassDurations,
+    DisableIRConstantPropagation,
 
     // Unresolved issues.
     NoWorkaroundSampleMaskBecomesZeroForAllButLastColorTarget,
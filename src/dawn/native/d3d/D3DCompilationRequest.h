@@ -78,6 +78,7 @@ using SubstituteOverrideConfig = std::unordered_map<tint::OverrideId, double>;
     X(UnsafeUnserializedValue<LimitsForCompilationRequest>, adapterSupportedLimits)  \
     X(uint32_t, maxSubgroupSize)                                                     \
     X(bool, disableSymbolRenaming)                                                   \
+    X(bool, disableConstantPropagation)                                              \
     X(bool, dumpShaders)                                                             \
     X(bool, dumpShadersOnFailure)
 
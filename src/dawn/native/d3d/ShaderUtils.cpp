@@ -216,29 +216,15 @@ MaybeError TranslateToHLSL(d3d::HlslCompilationRequest r,
 
     TRACE_EVENT0(tracePlatform.UnsafeGetValue(), General, "tint::hlsl::writer::Generate");
 
-    // Convert the AST program to an IR module.
+    // Get the lowered IR module reduced to the entry point, with its overrides not yet
+    // substituted. This is shared by the pipelines using the same entry point.
     tint::Result<tint::core::ir::Module> ir;
     {
-        SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(tracePlatform.UnsafeGetValue(),
-                                           "ShaderModuleProgramToIR");
-
         // Requires Tint Program here right before actual using.
         auto inputProgram = r.inputProgram.UnsafeGetValue()->GetTintProgram();
-        const tint::Program* tintInputProgram = &(inputProgram->program);
 
-        ir = tint::wgsl::reader::ProgramToLoweredIR(*tintInputProgram);
-        DAWN_INVALID_IF(ir != tint::Success, "An error occurred while generating Tint IR\n%s",
-                        ir.Failure().reason);
-    }
-
-    {
-        SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(tracePlatform.UnsafeGetValue(),
-                                           "ShaderModuleSingleEntryPoint");
-        auto singleEntryPointResult =
-            tint::core::ir::transform::SingleEntryPoint(ir.Get(), r.entryPointName);
-        DAWN_INVALID_IF(singleEntryPointResult != tint::Success,
-                        "Pipeline single entry point (IR) failed:\n%s",
-                        singleEntryPointResult.Failure().reason);
+        DAWN_TRY_ASSIGN(ir, inputProgram->CreatePreOverrideIR(tracePlatform.UnsafeGetValue(),
+                                                              r.entryPointName));
     }
 
     // this needs to run after SingleEntryPoint transform which removes unused
@@ -256,6 +242,18 @@ MaybeError TranslateToHLSL(d3d::HlslCompilationRequest r,
                         substituteOverridesResult.Failure().reason);
     }
 
+    if (!r.disableConstantPropagation) {
+        SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(tracePlatform.UnsafeGetValue(),
+                                           "ShaderModuleConstantPropagation");
+        // Fold the values that became constant when the overrides were substituted,
+        // removing the branches that this pipeline can never take.
+        auto constantPropagationResult =
+            tint::core::ir::transform::ConstantPropagation(ir.Get());
+        DAWN_INVALID_IF(constantPropagationResult != tint::Success,
+                        "Pipeline constant propagation (IR) failed:\n%s",
+                        constantPropagationResult.Failure().reason);
+    }
+
     tint::Result<tint::hlsl::writer::Output> result;
     {
         SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(tracePlatform.UnsafeGetValue(),
@@ -265,6 +263,10 @@ MaybeError TranslateToHLSL(d3d::HlslCompilationRequest r,
                         result.Failure().reason);
     }
 
+    // The writer lowers the module in place, so its arena is now at its peak size.
+    DAWN_HISTOGRAM_CUSTOM_COUNTS(tracePlatform.UnsafeGetValue(), "ShaderModuleIRArenaKB",
+                                 ir.Get().ArenaBytesReserved() / 1024, 1, 500'000, 50);
+
     // Workgroup validation has to come after `Generate` because it may require overrides to
     // have been substituted.
     if (r.stage == SingleShaderStage::Compute) {
@@ -72,6 +72,7 @@ class Buffer final : public BufferBase {
     void* GetMappedPointerImpl() override;
     bool IsCPUWritableAtCreation() const override;
     MaybeError MapAtCreationImpl() override;
+    MaybeError UploadData(uint64_t bufferOffset, const void* data, size_t size) override;
 
     void InitializeToZero(CommandRecordingContext* commandContext);
     void ClearBuffer(CommandRecordingContext* commandContext,
@@ -32,11 +32,13 @@
 #include "dawn/native/CallbackTaskManager.h"
 #include "dawn/native/ChainUtils.h"
 #include "dawn/native/CommandBuffer.h"
+#include "dawn/native/DynamicUploader.h"
 #include "dawn/native/metal/CommandRecordingContext.h"
 #include "dawn/native/metal/DeviceMTL.h"
 #include "dawn/native/metal/QueueMTL.h"
 #include "dawn/native/metal/UtilsMetal.h"
 
+#include <cstring>
 #include <limits>
 
 namespace dawn::native::metal {
@@ -208,6 +210,33 @@ void Buffer::UnmapImpl() {
     // Nothing to do, Metal StorageModeShared buffers are always mapped.
 }
 
+MaybeError Buffer::UploadData(uint64_t bufferOffset, const void* data, size_t size) {
+    if (size == 0) {
+        return {};
+    }
+
+    // A write to this buffer held back for coalescing must be recorded before checking whether the
+    // buffer is in use.
+    DAWN_TRY(GetDevice()->GetDynamicUploader()->FlushCombinedWriteTo(this));
+
+    // StorageModeShared buffers are coherent and visible to the CPU. When no pending GPU work uses
+    // the buffer, write the contents directly instead of copying them from a scratch buffer.
+    const bool isInUse =
+        GetLastUsageSerial() > GetDevice()->GetQueue()->GetCompletedCommandSerial();
+    if (isInUse || !(GetInternalUsage() & kMappableBufferUsages)) {
+        return BufferBase::UploadData(bufferOffset, data, size);
+    }
+
+    uint8_t* memory = static_cast<uint8_t*>([*mMtlBuffer contents]);
+    if (NeedsInitialization()) {
+        memset(memory, 0, GetAllocatedSize());
+        GetDevice()->IncrementLazyClearCountForTesting();
+        SetInitialized(true);
+    }
+    memcpy(memory + bufferOffset, data, size);
+    return {};
+}
+
 void Buffer::DestroyImpl() {
     // TODO(crbug.com/dawn/831): DestroyImpl is called from two places.
     // - It may be called if the buffer is explicitly destroyed with APIDestroy.
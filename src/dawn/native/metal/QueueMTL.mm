@@ -137,6 +137,9 @@ void Queue::WaitForCommandsToBeScheduled() {
     if (!IsAlive()) {
         return;
     }
+    if (GetDevice()->ConsumedError(RecordDeferredCommands())) {
+        return;
+    }
     if (GetDevice()->ConsumedError(SubmitPendingCommandBuffer())) {
         return;
     }
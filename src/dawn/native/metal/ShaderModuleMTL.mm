@@ -67,6 +67,7 @@ using SubstituteOverrideConfig = std::unordered_map<tint::OverrideId, double>;
     X(bool, usesSubgroupMatrix)                                                      \
     X(bool, useStrictMath)                                                           \
     X(bool, disableSymbolRenaming)                                                   \
+    X(bool, disableConstantPropagation)                                              \
     X(tint::msl::writer::Options, tintOptions)                                       \
     X(UnsafeUnserializedValue<dawn::platform::Platform*>, platform)
 
@@ -291,6 +292,7 @@ ResultOrError<CacheResult<MslCompilation>> TranslateToMSL(
     req.substituteOverrideConfig = BuildSubstituteOverridesTransformConfig(programmableStage);
     req.entryPointName = programmableStage.entryPoint.c_str();
     req.disableSymbolRenaming = device->IsToggleEnabled(Toggle::DisableSymbolRenaming);
+    req.disableConstantPropagation = device->IsToggleEnabled(Toggle::DisableIRConstantPropagation);
     req.usesSubgroupMatrix = programmableStage.metadata->usesSubgroupMatrix;
     req.platform = UnsafeUnserializedValue(device->GetPlatform());
     req.useStrictMath = useStrictMath;
@@ -331,27 +333,11 @@ ResultOrError<CacheResult<MslCompilation>> TranslateToMSL(
             TRACE_EVENT0(r.platform.UnsafeGetValue(), General, "tint::msl::writer::Generate");
             // Requires Tint Program here right before actual using.
             auto inputProgram = r.inputProgram.UnsafeGetValue()->GetTintProgram();
-            const tint::Program* tintInputProgram = &(inputProgram->program);
-            // Convert the AST program to an IR module.
+            // Get the lowered IR module reduced to the entry point, with its overrides not yet
+            // substituted. This is shared by the pipelines using the same entry point.
             tint::Result<tint::core::ir::Module> ir;
-            {
-                SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
-                                                   "ShaderModuleProgramToIR");
-                ir = tint::wgsl::reader::ProgramToLoweredIR(*tintInputProgram);
-                DAWN_INVALID_IF(ir != tint::Success,
-                                "An error occurred while generating Tint IR\n%s",
-                                ir.Failure().reason);
-            }
-
-            {
-                SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
-                                                   "ShaderModuleSingleEntryPoint");
-                auto singleEntryPointResult =
-                    tint::core::ir::transform::SingleEntryPoint(ir.Get(), r.entryPointName);
-                DAWN_INVALID_IF(singleEntryPointResult != tint::Success,
-                                "Pipeline single entry point (IR) failed:\n%s",
-                                singleEntryPointResult.Failure().reason);
-            }
+            DAWN_TRY_ASSIGN(ir, inputProgram->CreatePreOverrideIR(r.platform.UnsafeGetValue(),
+                                                                  r.entryPointName));
 
             // this needs to run after SingleEntryPoint transform which removes unused
             // overrides for the current entry point.
@@ -367,6 +353,18 @@ ResultOrError<CacheResult<MslCompilation>> TranslateToMSL(
                                 substituteOverridesResult.Failure().reason);
             }
 
+            if (!r.disableConstantPropagation) {
+                SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
+                                                   "ShaderModuleConstantPropagation");
+                // Fold the values that became constant when the overrides were substituted,
+                // removing the branches that this pipeline can never take.
+                auto constantPropagationResult =
+                    tint::core::ir::transform::ConstantPropagation(ir.Get());
+                DAWN_INVALID_IF(constantPropagationResult != tint::Success,
+                                "Pipeline constant propagation (IR) failed:\n%s",
+                                constantPropagationResult.Failure().reason);
+            }
+
             // Generate MSL.
             tint::Result<tint::msl::writer::Output> result;
             {
@@ -378,6 +376,10 @@ ResultOrError<CacheResult<MslCompilation>> TranslateToMSL(
                                 result.Failure().reason);
             }
 
+            // The writer lowers the module in place, so its arena is now at its peak size.
+            DAWN_HISTOGRAM_CUSTOM_COUNTS(r.platform.UnsafeGetValue(), "ShaderModuleIRArenaKB",
+                                         ir.Get().ArenaBytesReserved() / 1024, 1, 500'000, 50);
+
             // Workgroup validation has to come after `Generate` because it may require
             // overrides to have been substituted.
             Extent3D localSize{0, 0, 0};
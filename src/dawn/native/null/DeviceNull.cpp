@@ -38,6 +38,7 @@
 #include "dawn/native/Instance.h"
 #include "dawn/native/Surface.h"
 #include "dawn/native/TintUtils.h"
+#include "dawn/platform/tracing/TraceEvent.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 
 #include "tint/tint.h"
@@ -326,6 +327,8 @@ void Device::AddPendingOperation(std::unique_ptr<PendingOperation> operation) {
 }
 
 MaybeError Device::SubmitPendingOperations() {
+    TRACE_EVENT1(GetPlatform(), Recording, "DeviceNull::SubmitPendingOperations", "count",
+                 static_cast<uint64_t>(mPendingOperations.size()));
     for (auto& operation : mPendingOperations) {
         operation->Execute();
     }
@@ -433,7 +436,9 @@ Queue::Queue(Device* device, const QueueDescriptor* descriptor) : QueueBase(devi
 
 Queue::~Queue() {}
 
-MaybeError Queue::SubmitImpl(uint32_t, CommandBufferBase* const*) {
+MaybeError Queue::SubmitImpl(uint32_t commandCount, CommandBufferBase* const*) {
+    TRACE_EVENT1(GetDevice()->GetPlatform(), Recording, "QueueNull::SubmitImpl", "commandCount",
+                 commandCount);
     Device* device = ToBackend(GetDevice());
 
     DAWN_TRY(device->SubmitPendingOperations());
@@ -477,17 +482,11 @@ MaybeError Queue::WaitForIdleForDestruction() {
 MaybeError ComputePipeline::InitializeImpl() {
     const ProgrammableStage& computeStage = GetStage(SingleShaderStage::Compute);
 
-    // Convert the AST program to an IR module.
-    auto ir =
-        tint::wgsl::reader::ProgramToLoweredIR(computeStage.module->GetTintProgram()->program);
-    DAWN_INVALID_IF(ir != tint::Success, "An error occurred while generating Tint IR\n%s",
-                    ir.Failure().reason);
-
-    auto singleEntryPointResult =
-        tint::core::ir::transform::SingleEntryPoint(ir.Get(), computeStage.entryPoint.c_str());
-    DAWN_INVALID_IF(singleEntryPointResult != tint::Success,
-                    "Pipeline single entry point (IR) failed:\n%s",
-                    singleEntryPointResult.Failure().reason);
+    // Get the lowered IR module reduced to the entry point, with its overrides not yet
+    // substituted. This is shared by the pipelines using the same entry point.
+    tint::Result<tint::core::ir::Module> ir;
+    DAWN_TRY_ASSIGN(ir, computeStage.module->GetTintProgram()->CreatePreOverrideIR(
+                            GetDevice()->GetPlatform(), computeStage.entryPoint));
 
     // this needs to run after SingleEntryPoint transform which removes unused
     // overrides for the current entry point.
@@ -62,6 +62,7 @@ using SubstituteOverrideConfig = std::unordered_map<tint::OverrideId, double>;
     X(LimitsForCompilationRequest, limits)                                           \
     X(UnsafeUnserializedValue<LimitsForCompilationRequest>, adapterSupportedLimits)  \
     X(bool, disableSymbolRenaming)                                                   \
+    X(bool, disableConstantPropagation)                                              \
     X(std::vector<InterstageLocationAndName>, interstageVariables)                   \
     X(tint::glsl::writer::Options, tintOptions)                                      \
     X(UnsafeUnserializedValue<dawn::platform::Platform*>, platform)
@@ -525,6 +526,8 @@ ResultOrError<GLuint> ShaderModule::CompileShader(
     }
 
     req.tintOptions.strip_all_names = !GetDevice()->IsToggleEnabled(Toggle::DisableSymbolRenaming);
+    req.disableConstantPropagation =
+        GetDevice()->IsToggleEnabled(Toggle::DisableIRConstantPropagation);
 
     req.interstageVariables = {};
     for (size_t i = 0; i < entryPointMetaData.interStageVariables.size(); i++) {
@@ -547,27 +550,11 @@ ResultOrError<GLuint> ShaderModule::CompileShader(
         [](GLSLCompilationRequest r) -> ResultOrError<GLSLCompilation> {
             // Requires Tint Program here right before actual using.
             auto inputProgram = r.inputProgram.UnsafeGetValue()->GetTintProgram();
-            const tint::Program* tintInputProgram = &(inputProgram->program);
-            // Convert the AST program to an IR module.
+            // Get the lowered IR module reduced to the entry point, with its overrides not yet
+            // substituted. This is shared by the pipelines using the same entry point.
             tint::Result<tint::core::ir::Module> ir;
-            {
-                SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
-                                                   "ShaderModuleProgramToIR");
-                ir = tint::wgsl::reader::ProgramToLoweredIR(*tintInputProgram);
-                DAWN_INVALID_IF(ir != tint::Success,
-                                "An error occurred while generating Tint IR\n%s",
-                                ir.Failure().reason);
-            }
-
-            {
-                SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
-                                                   "ShaderModuleSingleEntryPoint");
-                auto singleEntryPointResult =
-                    tint::core::ir::transform::SingleEntryPoint(ir.Get(), r.entryPointName);
-                DAWN_INVALID_IF(singleEntryPointResult != tint::Success,
-                                "Pipeline single entry point (IR) failed:\n%s",
-                                singleEntryPointResult.Failure().reason);
-            }
+            DAWN_TRY_ASSIGN(ir, inputProgram->CreatePreOverrideIR(r.platform.UnsafeGetValue(),
+                                                                  r.entryPointName));
 
             // this needs to run after SingleEntryPoint transform which removes unused
             // overrides for the current entry point.
@@ -584,6 +571,18 @@ ResultOrError<GLuint> ShaderModule::CompileShader(
                                 substituteOverridesResult.Failure().reason);
             }
 
+            if (!r.disableConstantPropagation) {
+                SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
+                                                   "ShaderModuleConstantPropagation");
+                // Fold the values that became constant when the overrides were substituted,
+                // removing the branches that this pipeline can never take.
+                auto constantPropagationResult =
+                    tint::core::ir::transform::ConstantPropagation(ir.Get());
+                DAWN_INVALID_IF(constantPropagationResult != tint::Success,
+                                "Pipeline constant propagation (IR) failed:\n%s",
+                                constantPropagationResult.Failure().reason);
+            }
+
             tint::Result<tint::glsl::writer::Output> result;
             {
                 SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
@@ -595,6 +594,10 @@ ResultOrError<GLuint> ShaderModule::CompileShader(
                                 result.Failure().reason);
             }
 
+            // The writer lowers the module in place, so its arena is now at its peak size.
+            DAWN_HISTOGRAM_CUSTOM_COUNTS(r.platform.UnsafeGetValue(), "ShaderModuleIRArenaKB",
+                                         ir.Get().ArenaBytesReserved() / 1024, 1, 500'000, 50);
+
             // Workgroup validation has to come after `Generate` because it may require
             // overrides to have been substituted.
             if (r.stage == SingleShaderStage::Compute) {
@@ -37,6 +37,7 @@
 #include "dawn/common/GPUInfo.h"
 #include "dawn/native/ChainUtils.h"
 #include "dawn/native/CommandBuffer.h"
+#include "dawn/native/DynamicUploader.h"
 #include "dawn/native/PhysicalDevice.h"
 #include "dawn/native/Queue.h"
 #include "dawn/native/vulkan/DeviceVk.h"
@@ -554,6 +555,10 @@ MaybeError Buffer::UploadData(uint64_t bufferOffset, const void* data, size_t si
 
     Device* device = ToBackend(GetDevice());
 
+    // A write to this buffer held back for coalescing must be recorded before checking whether the
+    // buffer is in use.
+    DAWN_TRY(device->GetDynamicUploader()->FlushCombinedWriteTo(this));
+
     const bool isInUse = GetLastUsageSerial() > device->GetQueue()->GetCompletedCommandSerial();
     const bool isMappable = GetInternalUsage() & kMappableBufferUsages;
     // Get if buffer has pending writes on the GPU. Even if the write workload has finished, the
@@ -561,34 +566,30 @@ MaybeError Buffer::UploadData(uint64_t bufferOffset, const void* data, size_t si
     const bool hasPendingWrites = !IsSubset(mLastWriteUsage, wgpu::BufferUsage::MapWrite);
 
     if (!isInUse && !hasPendingWrites && mHostVisible) {
-        // Buffer does not have any pending uses and is CPU writable. We can map the buffer directly
-        // and write the contents, skipping the scratch buffer.
+        // Buffer does not have any pending uses and is CPU writable. We can write the contents
+        // directly, skipping the scratch buffer, the copy and its barrier.
         VkDeviceMemory deviceMemory = ToBackend(mMemoryAllocation.GetResourceHeap())->GetMemory();
         uint8_t* memory;
-        uint64_t realOffset = bufferOffset;
-        if (!isMappable) {
-            // TODO(crbug.com/dawn/774): Persistently map frequently updated buffers instead of
-            // mapping/unmapping each time.
-
-            VkDeviceSize offset = mMemoryAllocation.GetOffset();
-            VkDeviceSize mapSize = mAllocatedSize;
-            if (!NeedsInitialization() && mHostCoherent) {
-                // We can map only the part of the buffer we need to upload the data.
-                // We avoid this for non-coherent memory as the mapping needs to be aligned to
-                // nonCoherentAtomSize.
-                offset += bufferOffset;
-                mapSize = size;
-                realOffset = 0;
-            }
-
-            void* mappedPointer;
-            DAWN_TRY(CheckVkSuccess(device->fn.MapMemory(device->GetVkDevice(), deviceMemory,
-                                                         offset, mapSize, 0, &mappedPointer),
-                                    "vkMapMemory"));
-            memory = static_cast<uint8_t*>(mappedPointer);
-        } else {
+        if (isMappable) {
             // Mappable buffers are already persistently mapped.
             memory = mMemoryAllocation.GetMappedPointer();
+        } else if (mHostCoherent) {
+            // Coherent memory needs no flushes, so the heap is kept mapped for the following
+            // uploads instead of being mapped and unmapped for each of them.
+            uint8_t* heapPointer;
+            DAWN_TRY_ASSIGN(heapPointer, ToBackend(mMemoryAllocation.GetResourceHeap())
+                                             ->GetPersistentlyMappedPointer(device));
+            memory = heapPointer + mMemoryAllocation.GetOffset();
+        } else {
+            // Non-coherent memory is mapped for the whole buffer as the flushes need to be aligned
+            // to nonCoherentAtomSize.
+            void* mappedPointer;
+            DAWN_TRY(CheckVkSuccess(
+                device->fn.MapMemory(device->GetVkDevice(), deviceMemory,
+                                     mMemoryAllocation.GetOffset(), mAllocatedSize, 0,
+                                     &mappedPointer),
+                "vkMapMemory"));
+            memory = static_cast<uint8_t*>(mappedPointer);
         }
 
         VkMappedMemoryRange mappedMemoryRange = {};
@@ -609,17 +610,16 @@ MaybeError Buffer::UploadData(uint64_t bufferOffset, const void* data, size_t si
         }
 
         // Copy data.
-        memcpy(memory + realOffset, data, size);
+        memcpy(memory + bufferOffset, data, size);
 
         if (!mHostCoherent) {
             // For non-coherent memory we need to explicitly flush the memory range to make the host
             // write visible.
             // TODO(crbug.com/dawn/774): Batch the flush calls instead of doing one per writeBuffer.
             device->fn.FlushMappedMemoryRanges(device->GetVkDevice(), 1, &mappedMemoryRange);
-        }
-
-        if (!isMappable) {
-            device->fn.UnmapMemory(device->GetVkDevice(), deviceMemory);
+            if (!isMappable) {
+                device->fn.UnmapMemory(device->GetVkDevice(), deviceMemory);
+            }
         }
         return {};
     }
@@ -631,7 +631,11 @@ MaybeError Buffer::UploadData(uint64_t bufferOffset, const void* data, size_t si
         // Transition to MapWrite so the next time we try to upload data to this buffer, we can take
         // the fast path. This avoids the issue where the first write will take the slow path due to
         // zero initialization. Only attempt this once to avoid transitioning a buffer many times
-        // despite never getting the fast path.
+        // despite never getting the fast path. A copy to this buffer held back for coalescing
+        // must be recorded before the transition.
+        if (error.IsSuccess()) {
+            error = device->GetDynamicUploader()->FlushCombinedWriteTo(this);
+        }
         CommandRecordingContext* recordingContext =
             ToBackend(device->GetQueue())->GetPendingRecordingContext();
         TransitionUsageNow(recordingContext, wgpu::BufferUsage::MapWrite);
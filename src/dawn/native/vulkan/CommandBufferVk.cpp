@@ -29,6 +29,9 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include "dawn/native/BindGroupTracker.h"
@@ -46,6 +49,7 @@
 #include "dawn/native/vulkan/DeviceVk.h"
 #include "dawn/native/vulkan/FencedDeleter.h"
 #include "dawn/native/vulkan/FramebufferCache.h"
+#include "dawn/native/vulkan/GPUPassTimer.h"
 #include "dawn/native/vulkan/PhysicalDeviceVk.h"
 #include "dawn/native/vulkan/PipelineLayoutVk.h"
 #include "dawn/native/vulkan/QuerySetVk.h"
@@ -56,6 +60,8 @@
 #include "dawn/native/vulkan/TextureVk.h"
 #include "dawn/native/vulkan/UtilsVulkan.h"
 #include "dawn/native/vulkan/VulkanError.h"
+#include "dawn/platform/tracing/TraceEvent.h"
+#include "partition_alloc/pointers/raw_ptr.h"
 
 namespace dawn::native::vulkan {
 
@@ -170,16 +176,14 @@ class DescriptorSetTracker : public BindGroupTrackerBase<true, uint32_t> {
         mImmediateConstantSize = pipeline->GetImmediateConstantSize();
     }
 
-    void Apply(Device* device,
-               CommandRecordingContext* recordingContext,
-               VkPipelineBindPoint bindPoint) {
+    void Apply(Device* device, VkCommandBuffer commands, VkPipelineBindPoint bindPoint) {
         BeforeApply();
         for (BindGroupIndex dirtyIndex : mDirtyBindGroupsObjectChangedOrIsDynamic) {
             VkDescriptorSet set = ToBackend(mBindGroups[dirtyIndex])->GetHandle();
             const auto dynamicOffsetSpan = GetDynamicOffsets(dirtyIndex);
             uint32_t count = static_cast<uint32_t>(dynamicOffsetSpan.size());
             const uint32_t* dynamicOffset = count > 0 ? dynamicOffsetSpan.data() : nullptr;
-            device->fn.CmdBindDescriptorSets(recordingContext->commandBuffer, bindPoint, mVkLayout,
+            device->fn.CmdBindDescriptorSets(commands, bindPoint, mVkLayout,
                                              static_cast<uint32_t>(dirtyIndex), 1, &*set, count,
                                              dynamicOffset);
         }
@@ -409,11 +413,486 @@ void RecordResolveQuerySetCmd(VkCommandBuffer commands,
     }
 }
 
+// The state tracked while encoding the commands that can be recorded both in render passes and in
+// render bundles.
+struct RenderCommandState {
+    DescriptorSetTracker descriptorSets = {};
+    ImmediateConstantTracker<RenderImmediateConstantsTrackerBase> immediates = {};
+
+    // Tracks the number of commands that do significant GPU work (a draw or query write).
+    uint32_t workCommandCount = 0;
+};
+
+void EncodeRenderBundleCommand(Device* device,
+                               VkCommandBuffer commands,
+                               RenderCommandState* state,
+                               CommandIterator* iter,
+                               Command type) {
+    switch (type) {
+        case Command::Draw: {
+            state->workCommandCount++;
+            DrawCmd* draw = iter->NextCommand<DrawCmd>();
+
+            state->descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_GRAPHICS);
+            state->immediates.Apply(device, commands);
+            device->fn.CmdDraw(commands, draw->vertexCount, draw->instanceCount, draw->firstVertex,
+                               draw->firstInstance);
+            break;
+        }
+
+        case Command::DrawIndexed: {
+            state->workCommandCount++;
+            DrawIndexedCmd* draw = iter->NextCommand<DrawIndexedCmd>();
+
+            state->descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_GRAPHICS);
+            state->immediates.Apply(device, commands);
+            device->fn.CmdDrawIndexed(commands, draw->indexCount, draw->instanceCount,
+                                      draw->firstIndex, draw->baseVertex, draw->firstInstance);
+            break;
+        }
+
+        case Command::DrawIndirect: {
+            state->workCommandCount++;
+            DrawIndirectCmd* draw = iter->NextCommand<DrawIndirectCmd>();
+            Buffer* buffer = ToBackend(draw->indirectBuffer.Get());
+
+            state->descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_GRAPHICS);
+            state->immediates.Apply(device, commands);
+            device->fn.CmdDrawIndirect(commands, buffer->GetHandle(),
+                                       static_cast<VkDeviceSize>(draw->indirectOffset), 1, 0);
+            break;
+        }
+
+        case Command::DrawIndexedIndirect: {
+            state->workCommandCount++;
+            DrawIndexedIndirectCmd* draw = iter->NextCommand<DrawIndexedIndirectCmd>();
+            Buffer* buffer = ToBackend(draw->indirectBuffer.Get());
+            DAWN_ASSERT(buffer != nullptr);
+
+            state->descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_GRAPHICS);
+            state->immediates.Apply(device, commands);
+            device->fn.CmdDrawIndexedIndirect(commands, buffer->GetHandle(),
+                                              static_cast<VkDeviceSize>(draw->indirectOffset), 1,
+                                              0);
+            break;
+        }
+
+        case Command::MultiDrawIndirect: {
+            state->workCommandCount++;
+            MultiDrawIndirectCmd* cmd = iter->NextCommand<MultiDrawIndirectCmd>();
+
+            Buffer* indirectBuffer = ToBackend(cmd->indirectBuffer.Get());
+            DAWN_ASSERT(indirectBuffer != nullptr);
+
+            // Count buffer is optional
+            Buffer* countBuffer = ToBackend(cmd->drawCountBuffer.Get());
+
+            state->descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_GRAPHICS);
+            state->immediates.Apply(device, commands);
+
+            if (countBuffer == nullptr) {
+                device->fn.CmdDrawIndirect(commands, indirectBuffer->GetHandle(),
+                                           static_cast<VkDeviceSize>(cmd->indirectOffset),
+                                           cmd->maxDrawCount, kDrawIndirectSize);
+            } else {
+                device->fn.CmdDrawIndirectCountKHR(
+                    commands, indirectBuffer->GetHandle(),
+                    static_cast<VkDeviceSize>(cmd->indirectOffset), countBuffer->GetHandle(),
+                    static_cast<VkDeviceSize>(cmd->drawCountOffset), cmd->maxDrawCount,
+                    kDrawIndirectSize);
+            }
+            break;
+        }
+        case Command::MultiDrawIndexedIndirect: {
+            state->workCommandCount++;
+            MultiDrawIndexedIndirectCmd* cmd = iter->NextCommand<MultiDrawIndexedIndirectCmd>();
+
+            Buffer* indirectBuffer = ToBackend(cmd->indirectBuffer.Get());
+            DAWN_ASSERT(indirectBuffer != nullptr);
+
+            // Count buffer is optional
+            Buffer* countBuffer = ToBackend(cmd->drawCountBuffer.Get());
+
+            state->descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_GRAPHICS);
+            state->immediates.Apply(device, commands);
+
+            if (countBuffer == nullptr) {
+                device->fn.CmdDrawIndexedIndirect(
+                    commands, indirectBuffer->GetHandle(),
+                    static_cast<VkDeviceSize>(cmd->indirectOffset), cmd->maxDrawCount,
+                    kDrawIndexedIndirectSize);
+            } else {
+                device->fn.CmdDrawIndexedIndirectCountKHR(
+                    commands, indirectBuffer->GetHandle(),
+                    static_cast<VkDeviceSize>(cmd->indirectOffset), countBuffer->GetHandle(),
+                    static_cast<VkDeviceSize>(cmd->drawCountOffset), cmd->maxDrawCount,
+                    kDrawIndexedIndirectSize);
+            }
+
+            break;
+        }
+
+        case Command::InsertDebugMarker: {
+            if (device->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
+                InsertDebugMarkerCmd* cmd = iter->NextCommand<InsertDebugMarkerCmd>();
+                const char* label = iter->NextData<char>(cmd->length + 1);
+                VkDebugUtilsLabelEXT utilsLabel;
+                utilsLabel.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
+                utilsLabel.pNext = nullptr;
+                utilsLabel.pLabelName = label;
+                // Default color to black
+                utilsLabel.color[0] = 0.0;
+                utilsLabel.color[1] = 0.0;
+                utilsLabel.color[2] = 0.0;
+                utilsLabel.color[3] = 1.0;
+                device->fn.CmdInsertDebugUtilsLabelEXT(commands, &utilsLabel);
+            } else {
+                SkipCommand(iter, Command::InsertDebugMarker);
+            }
+            break;
+        }
+
+        case Command::PopDebugGroup: {
+            if (device->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
+                iter->NextCommand<PopDebugGroupCmd>();
+                device->fn.CmdEndDebugUtilsLabelEXT(commands);
+            } else {
+                SkipCommand(iter, Command::PopDebugGroup);
+            }
+            break;
+        }
+
+        case Command::PushDebugGroup: {
+            if (device->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
+                PushDebugGroupCmd* cmd = iter->NextCommand<PushDebugGroupCmd>();
+                const char* label = iter->NextData<char>(cmd->length + 1);
+                VkDebugUtilsLabelEXT utilsLabel;
+                utilsLabel.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
+                utilsLabel.pNext = nullptr;
+                utilsLabel.pLabelName = label;
+                // Default color to black
+                utilsLabel.color[0] = 0.0;
+                utilsLabel.color[1] = 0.0;
+                utilsLabel.color[2] = 0.0;
+                utilsLabel.color[3] = 1.0;
+                device->fn.CmdBeginDebugUtilsLabelEXT(commands, &utilsLabel);
+            } else {
+                SkipCommand(iter, Command::PushDebugGroup);
+            }
+            break;
+        }
+
+        case Command::SetBindGroup: {
+            SetBindGroupCmd* cmd = iter->NextCommand<SetBindGroupCmd>();
+            BindGroup* bindGroup = ToBackend(cmd->group.Get());
+            uint32_t* dynamicOffsets = nullptr;
+            if (cmd->dynamicOffsetCount > 0) {
+                dynamicOffsets = iter->NextData<uint32_t>(cmd->dynamicOffsetCount);
+            }
+
+            state->descriptorSets.OnSetBindGroup(cmd->index, bindGroup, cmd->dynamicOffsetCount,
+                                          dynamicOffsets);
+            break;
+        }
+
+        case Command::SetIndexBuffer: {
+            SetIndexBufferCmd* cmd = iter->NextCommand<SetIndexBufferCmd>();
+            VkBuffer indexBuffer = ToBackend(cmd->buffer)->GetHandle();
+
+            device->fn.CmdBindIndexBuffer(commands, indexBuffer, cmd->offset,
+                                          VulkanIndexType(cmd->format));
+            break;
+        }
+
+        case Command::SetRenderPipeline: {
+            SetRenderPipelineCmd* cmd = iter->NextCommand<SetRenderPipelineCmd>();
+            RenderPipeline* pipeline = ToBackend(cmd->pipeline).Get();
+
+            device->fn.CmdBindPipeline(commands, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                       pipeline->GetHandle());
+
+            state->descriptorSets.OnSetPipeline<RenderPipeline>(pipeline);
+            state->immediates.OnSetPipeline(pipeline);
+            break;
+        }
+
+        case Command::SetVertexBuffer: {
+            SetVertexBufferCmd* cmd = iter->NextCommand<SetVertexBufferCmd>();
+            VkBuffer buffer = ToBackend(cmd->buffer)->GetHandle();
+            VkDeviceSize offset = static_cast<VkDeviceSize>(cmd->offset);
+
+            device->fn.CmdBindVertexBuffers(commands, static_cast<uint8_t>(cmd->slot), 1, &*buffer,
+                                            &offset);
+            break;
+        }
+
+        case Command::SetImmediateData: {
+            SetImmediateDataCmd* cmd = iter->NextCommand<SetImmediateDataCmd>();
+            DAWN_ASSERT(cmd->size > 0);
+            uint8_t* value = nullptr;
+            value = iter->NextData<uint8_t>(cmd->size);
+            state->immediates.SetImmediateData(cmd->offset, value, cmd->size);
+            break;
+        }
+
+        default:
+            DAWN_UNREACHABLE();
+            break;
+    }
+}
+
+// Sets the default value for the dynamic state at the start of a render pass.
+void RecordDefaultDynamicState(Device* device,
+                               VkCommandBuffer commands,
+                               uint32_t width,
+                               uint32_t height) {
+    device->fn.CmdSetLineWidth(commands, 1.0f);
+    device->fn.CmdSetDepthBounds(commands, 0.0f, 1.0f);
+
+    device->fn.CmdSetStencilReference(commands, VK_STENCIL_FRONT_AND_BACK, 0);
+
+    float blendConstants[4] = {
+        0.0f,
+        0.0f,
+        0.0f,
+        0.0f,
+    };
+    device->fn.CmdSetBlendConstants(commands, blendConstants);
+
+    // The viewport and scissor default to cover all of the attachments
+    VkViewport viewport;
+    viewport.x = 0.0f;
+    viewport.y = static_cast<float>(height);
+    viewport.width = static_cast<float>(width);
+    viewport.height = -static_cast<float>(height);
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+    device->fn.CmdSetViewport(commands, 0, 1, &viewport);
+
+    VkRect2D scissorRect;
+    scissorRect.offset.x = 0;
+    scissorRect.offset.y = 0;
+    scissorRect.extent.width = width;
+    scissorRect.extent.height = height;
+    device->fn.CmdSetScissor(commands, 0, 1, &scissorRect);
+}
+
+// Returns whether some indirect draws of `bundle` are validated before they are executed. The
+// validation rewrites the indirect buffer and offset of their commands to point into the scratch
+// buffer of the command buffer that executes the bundle, so they must be re-encoded every time.
+bool HasValidatedIndirectDraws(RenderBundleBase* bundle) {
+    const IndirectDrawMetadata& metadata = bundle->GetIndirectDrawMetadata();
+    return !metadata.GetIndexedIndirectBufferValidationInfo()->empty() ||
+           !metadata.GetIndirectMultiDraws().empty();
+}
+
+// Returns, for each render pass in `commands`, whether the pass contains nothing but
+// ExecuteBundles. Only such passes can replay their bundles from secondary command buffers, since
+// a subpass begun with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS cannot contain inline
+// commands. Passes without any draw are excluded so that the workarounds for empty passes can
+// still record their inline work. So are passes executing bundles with validated indirect draws.
+std::vector<bool> FindRenderPassesOnlyExecutingBundles(CommandIterator* commands) {
+    std::vector<bool> onlyExecutesBundles;
+    bool inRenderPass = false;
+    uint64_t drawCount = 0;
+
+    Command type;
+    while (commands->NextCommandId(&type)) {
+        switch (type) {
+            case Command::BeginRenderPass: {
+                commands->NextCommand<BeginRenderPassCmd>();
+                onlyExecutesBundles.push_back(true);
+                inRenderPass = true;
+                drawCount = 0;
+                break;
+            }
+
+            case Command::ExecuteBundles: {
+                ExecuteBundlesCmd* cmd = commands->NextCommand<ExecuteBundlesCmd>();
+                auto bundles = commands->NextData<Ref<RenderBundleBase>>(cmd->count);
+                for (uint32_t i = 0; i < cmd->count; ++i) {
+                    drawCount += bundles[i]->GetDrawCount();
+                    if (HasValidatedIndirectDraws(bundles[i].Get())) {
+                        onlyExecutesBundles.back() = false;
+                    }
+                }
+                break;
+            }
+
+            case Command::EndRenderPass: {
+                commands->NextCommand<EndRenderPassCmd>();
+                onlyExecutesBundles.back() = onlyExecutesBundles.back() && drawCount > 0;
+                inRenderPass = false;
+                break;
+            }
+
+            default: {
+                if (inRenderPass) {
+                    onlyExecutesBundles.back() = false;
+                }
+                SkipCommand(commands, type);
+                break;
+            }
+        }
+    }
+    commands->Reset();
+
+    return onlyExecutesBundles;
+}
+
+// Returns a render pass compatible with the one begun by `renderPass`, that is one that only
+// differs in its load and store operations. Secondary command buffers recorded against it can be
+// executed in any of the render passes that use the same attachments.
+ResultOrError<RenderPassCache::RenderPassInfo> GetCompatibleRenderPass(
+    Device* device,
+    const BeginRenderPassCmd* renderPass) {
+    RenderPassCacheQuery query;
+
+    for (auto i : renderPass->attachmentState->GetColorAttachmentsMask()) {
+        const auto& attachmentInfo = renderPass->colorAttachments[i];
+        bool hasResolveTarget = attachmentInfo.resolveTarget != nullptr;
+
+        query.SetColor(i, attachmentInfo.view->GetFormat().format, wgpu::LoadOp::Load,
+                       wgpu::StoreOp::Store, hasResolveTarget);
+    }
+
+    if (renderPass->attachmentState->HasDepthStencilAttachment()) {
+        const auto& attachmentInfo = renderPass->depthStencilAttachment;
+
+        query.SetDepthStencil(attachmentInfo.view->GetTexture()->GetFormat().format,
+                              wgpu::LoadOp::Load, wgpu::StoreOp::Store,
+                              attachmentInfo.depthReadOnly, wgpu::LoadOp::Load,
+                              wgpu::StoreOp::Store, attachmentInfo.stencilReadOnly);
+    }
+
+    query.SetSampleCount(renderPass->attachmentState->GetSampleCount());
+
+    return device->GetRenderPassCache()->GetRenderPass(query);
+}
+
+// The secondary command buffers pre-recorded for a render bundle when
+// Toggle::VulkanRecordRenderBundlesInSecondaryCommandBuffers is enabled. There is one per
+// compatible render pass and render size the bundle is executed with, since the default viewport
+// and scissor are part of the recorded commands. They are all allocated from a command pool owned
+// by the bundle, and are released along with the rest of the bundle's state when it is destroyed.
+// Bundles with validated indirect draws never use them, see HasValidatedIndirectDraws.
+class RenderBundleSecondaryCommandBuffers final : public RenderBundleBase::BackendData {
+  public:
+    RenderBundleSecondaryCommandBuffers(Device* device, RenderBundleBase* bundle)
+        : mDevice(device), mBundle(bundle) {
+        DAWN_ASSERT(!HasValidatedIndirectDraws(bundle));
+    }
+
+    ~RenderBundleSecondaryCommandBuffers() override {
+        // The command buffers might still be used by pending submits. They are freed along with
+        // the pool once those complete.
+        if (mPool != VK_NULL_HANDLE) {
+            mDevice->GetFencedDeleter()->DeleteWhenUnused(mPool);
+        }
+    }
+
+    MaybeError GetOrRecord(const RenderPassCache::RenderPassInfo& renderPass,
+                           uint32_t width,
+                           uint32_t height,
+                           VkCommandBuffer* commandBuffer) {
+        for (const Entry& entry : mEntries) {
+            if (entry.renderPassId == renderPass.uniqueId && entry.width == width &&
+                entry.height == height) {
+                *commandBuffer = entry.commandBuffer;
+                return {};
+            }
+        }
+
+        Device* device = mDevice;
+        VkDevice vkDevice = device->GetVkDevice();
+
+        if (mPool == VK_NULL_HANDLE) {
+            VkCommandPoolCreateInfo createInfo;
+            createInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            createInfo.pNext = nullptr;
+            createInfo.flags = 0;
+            createInfo.queueFamilyIndex = device->GetGraphicsQueueFamily();
+
+            DAWN_TRY(CheckVkSuccess(
+                device->fn.CreateCommandPool(vkDevice, &createInfo, nullptr, &*mPool),
+                "vkCreateCommandPool"));
+        }
+
+        VkCommandBufferAllocateInfo allocateInfo;
+        allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocateInfo.pNext = nullptr;
+        allocateInfo.commandPool = mPool;
+        allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+        allocateInfo.commandBufferCount = 1;
+
+        VkCommandBuffer commands = VK_NULL_HANDLE;
+        DAWN_TRY(CheckVkSuccess(
+            device->fn.AllocateCommandBuffers(vkDevice, &allocateInfo, &commands),
+            "vkAllocateCommandBuffers"));
+
+        // The framebuffer isn't specified since the command buffer is executed with many of them.
+        VkCommandBufferInheritanceInfo inheritanceInfo;
+        inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritanceInfo.pNext = nullptr;
+        inheritanceInfo.renderPass = renderPass.renderPass;
+        inheritanceInfo.subpass = renderPass.mainSubpass;
+        inheritanceInfo.framebuffer = VK_NULL_HANDLE;
+        inheritanceInfo.occlusionQueryEnable = VK_FALSE;
+        inheritanceInfo.queryFlags = 0;
+        inheritanceInfo.pipelineStatistics = 0;
+
+        // The same bundle can be executed by several command buffers that are pending at once.
+        VkCommandBufferBeginInfo beginInfo;
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.pNext = nullptr;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT |
+                          VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+        beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+        DAWN_TRY(CheckVkSuccess(device->fn.BeginCommandBuffer(commands, &beginInfo),
+                                "vkBeginCommandBuffer"));
+
+        // Dynamic state isn't inherited by secondary command buffers. The render pass only
+        // executes bundles so it always uses the default state.
+        RecordDefaultDynamicState(device, commands, width, height);
+        RenderCommandState state;
+        state.immediates.SetClampFragDepth(0.0, 1.0);
+
+        CommandIterator* iter = mBundle->GetCommands();
+        iter->Reset();
+        Command type;
+        while (iter->NextCommandId(&type)) {
+            EncodeRenderBundleCommand(device, commands, &state, iter, type);
+        }
+
+        DAWN_TRY(CheckVkSuccess(device->fn.EndCommandBuffer(commands), "vkEndCommandBuffer"));
+
+        mEntries.push_back({renderPass.uniqueId, width, height, commands});
+        *commandBuffer = commands;
+        return {};
+    }
+
+  private:
+    struct Entry {
+        uint64_t renderPassId;
+        uint32_t width;
+        uint32_t height;
+        VkCommandBuffer commandBuffer;
+    };
+
+    raw_ptr<Device> mDevice;
+    // The bundle that owns this object.
+    raw_ptr<RenderBundleBase> mBundle;
+    VkCommandPool mPool = VK_NULL_HANDLE;
+    std::vector<Entry> mEntries;
+};
+
 }  // anonymous namespace
 
 MaybeError RecordBeginRenderPass(CommandRecordingContext* recordingContext,
                                  Device* device,
-                                 BeginRenderPassCmd* renderPass) {
+                                 BeginRenderPassCmd* renderPass,
+                                 VkSubpassContents contents) {
     VkCommandBuffer commands = recordingContext->commandBuffer;
 
     // Query a VkRenderPass from the cache
@@ -551,10 +1030,11 @@ MaybeError RecordBeginRenderPass(CommandRecordingContext* recordingContext,
     beginInfo.pClearValues = framebufferQuery.clearValues.data();
 
     if (renderPass->attachmentState->GetExpandResolveInfo().attachmentsToExpandResolve.any()) {
+        DAWN_ASSERT(contents == VK_SUBPASS_CONTENTS_INLINE);
         DAWN_TRY(BeginRenderPassAndExpandResolveTextureWithDraw(device, recordingContext,
                                                                 renderPass, beginInfo));
     } else {
-        device->fn.CmdBeginRenderPass(commands, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
+        device->fn.CmdBeginRenderPass(commands, &beginInfo, contents);
     }
 
     return {};
@@ -652,6 +1132,11 @@ MaybeError CommandBuffer::RecordCommands(CommandRecordingContext* recordingConte
     size_t nextComputePassNumber = 0;
     size_t nextRenderPassNumber = 0;
 
+    std::vector<bool> renderPassesOnlyExecutingBundles;
+    if (device->IsToggleEnabled(Toggle::VulkanRecordRenderBundlesInSecondaryCommandBuffers)) {
+        renderPassesOnlyExecutingBundles = FindRenderPassesOnlyExecutingBundles(&mCommands);
+    }
+
     Command type;
     while (mCommands.NextCommandId(&type)) {
         switch (type) {
@@ -867,7 +1352,18 @@ MaybeError CommandBuffer::RecordCommands(CommandRecordingContext* recordingConte
                     GetResourceUsages().renderPasses[nextRenderPassNumber]));
 
                 LazyClearRenderPassAttachments(cmd);
-                DAWN_TRY(RecordRenderPass(recordingContext, cmd));
+                bool useSecondaryCommandBuffers =
+                    nextRenderPassNumber < renderPassesOnlyExecutingBundles.size() &&
+                    renderPassesOnlyExecutingBundles[nextRenderPassNumber];
+                GPUPassTimer* passTimer = device->GetGPUPassTimer();
+                std::optional<uint32_t> timedPass;
+                if (passTimer != nullptr) {
+                    timedPass = passTimer->BeginPass(recordingContext, "RenderPass");
+                }
+                DAWN_TRY(RecordRenderPass(recordingContext, cmd, useSecondaryCommandBuffers));
+                if (timedPass.has_value()) {
+                    passTimer->EndPass(recordingContext, *timedPass);
+                }
 
                 recordingContext->hasRecordedRenderPass = true;
                 nextRenderPassNumber++;
@@ -888,9 +1384,17 @@ MaybeError CommandBuffer::RecordCommands(CommandRecordingContext* recordingConte
                     commands = recordingContext->commandBuffer;
                 }
 
+                GPUPassTimer* passTimer = device->GetGPUPassTimer();
+                std::optional<uint32_t> timedPass;
+                if (passTimer != nullptr) {
+                    timedPass = passTimer->BeginPass(recordingContext, "ComputePass");
+                }
                 DAWN_TRY(
                     RecordComputePass(recordingContext, cmd,
                                       GetResourceUsages().computePasses[nextComputePassNumber]));
+                if (timedPass.has_value()) {
+                    passTimer->EndPass(recordingContext, *timedPass);
+                }
 
                 nextComputePassNumber++;
                 break;
@@ -1033,6 +1537,7 @@ MaybeError CommandBuffer::RecordComputePass(CommandRecordingContext* recordingCo
                                             BeginComputePassCmd* computePassCmd,
                                             const ComputePassResourceUsage& resourceUsages) {
     Device* device = ToBackend(GetDevice());
+    TRACE_EVENT0(device->GetPlatform(), Recording, "CommandBufferVk::RecordComputePass");
 
     // Write timestamp at the beginning of compute pass if it's set
     if (computePassCmd->timestampWrites.beginningOfPassWriteIndex !=
@@ -1071,7 +1576,7 @@ MaybeError CommandBuffer::RecordComputePass(CommandRecordingContext* recordingCo
 
                 DAWN_TRY(TransitionAndClearForSyncScope(
                     device, recordingContext, resourceUsages.dispatchUsages[currentDispatch]));
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_COMPUTE);
+                descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_COMPUTE);
                 immediates.Apply(device, commands);
                 device->fn.CmdDispatch(commands, dispatch->x, dispatch->y, dispatch->z);
                 currentDispatch++;
@@ -1084,7 +1589,7 @@ MaybeError CommandBuffer::RecordComputePass(CommandRecordingContext* recordingCo
 
                 DAWN_TRY(TransitionAndClearForSyncScope(
                     device, recordingContext, resourceUsages.dispatchUsages[currentDispatch]));
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_COMPUTE);
+                descriptorSets.Apply(device, commands, VK_PIPELINE_BIND_POINT_COMPUTE);
                 immediates.Apply(device, commands);
                 device->fn.CmdDispatchIndirect(commands, indirectBuffer,
                                                static_cast<VkDeviceSize>(dispatch->indirectOffset));
@@ -1194,8 +1699,10 @@ MaybeError CommandBuffer::RecordComputePass(CommandRecordingContext* recordingCo
 }
 
 MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingContext,
-                                           BeginRenderPassCmd* renderPassCmd) {
+                                           BeginRenderPassCmd* renderPassCmd,
+                                           bool useSecondaryCommandBuffers) {
     Device* device = ToBackend(GetDevice());
+    TRACE_EVENT0(device->GetPlatform(), Recording, "CommandBufferVk::RecordRenderPass");
     VkCommandBuffer commands = recordingContext->commandBuffer;
 
     // Write timestamp at the beginning of render pass if it's set.
@@ -1208,266 +1715,31 @@ MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingCon
                                 VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
     }
 
-    DAWN_TRY(RecordBeginRenderPass(recordingContext, device, renderPassCmd));
+    // Passes that expand resolve textures begin with an inline draw in a separate subpass, so
+    // they always re-encode their bundles.
+    useSecondaryCommandBuffers =
+        useSecondaryCommandBuffers &&
+        !renderPassCmd->attachmentState->GetExpandResolveInfo().attachmentsToExpandResolve.any();
+
+    RenderPassCache::RenderPassInfo compatibleRenderPass;
+    if (useSecondaryCommandBuffers) {
+        DAWN_TRY_ASSIGN(compatibleRenderPass, GetCompatibleRenderPass(device, renderPassCmd));
+        DAWN_TRY(RecordBeginRenderPass(recordingContext, device, renderPassCmd,
+                                       VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS));
+    } else {
+        DAWN_TRY(RecordBeginRenderPass(recordingContext, device, renderPassCmd));
+    }
 
-    ImmediateConstantTracker<RenderImmediateConstantsTrackerBase> immediates = {};
-    // Set the default value for the dynamic state
-    {
-        device->fn.CmdSetLineWidth(commands, 1.0f);
-        device->fn.CmdSetDepthBounds(commands, 0.0f, 1.0f);
-
-        device->fn.CmdSetStencilReference(commands, VK_STENCIL_FRONT_AND_BACK, 0);
-
-        float blendConstants[4] = {
-            0.0f,
-            0.0f,
-            0.0f,
-            0.0f,
-        };
-        device->fn.CmdSetBlendConstants(commands, blendConstants);
-
-        // The viewport and scissor default to cover all of the attachments
-        VkViewport viewport;
-        viewport.x = 0.0f;
-        viewport.y = static_cast<float>(renderPassCmd->height);
-        viewport.width = static_cast<float>(renderPassCmd->width);
-        viewport.height = -static_cast<float>(renderPassCmd->height);
-        viewport.minDepth = 0.0f;
-        viewport.maxDepth = 1.0f;
-        device->fn.CmdSetViewport(commands, 0, 1, &viewport);
-
-        VkRect2D scissorRect;
-        scissorRect.offset.x = 0;
-        scissorRect.offset.y = 0;
-        scissorRect.extent.width = renderPassCmd->width;
-        scissorRect.extent.height = renderPassCmd->height;
-        device->fn.CmdSetScissor(commands, 0, 1, &scissorRect);
+    RenderCommandState state;
+    // Set the default value for the dynamic state. The secondary command buffers set their own
+    // since it is not inherited.
+    if (!useSecondaryCommandBuffers) {
+        RecordDefaultDynamicState(device, commands, renderPassCmd->width, renderPassCmd->height);
 
         // Apply default frag depth
-        immediates.SetClampFragDepth(0.0, 1.0);
+        state.immediates.SetClampFragDepth(0.0, 1.0);
     }
 
-    DescriptorSetTracker descriptorSets = {};
-    RenderPipeline* lastPipeline = nullptr;
-
-    // Tracks the number of commands that do significant GPU work (a draw or query write) this pass.
-    uint32_t workCommandCount = 0;
-
-    auto EncodeRenderBundleCommand = [&](CommandIterator* iter, Command type) {
-        switch (type) {
-            case Command::Draw: {
-                workCommandCount++;
-                DrawCmd* draw = iter->NextCommand<DrawCmd>();
-
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
-                immediates.Apply(device, commands);
-                device->fn.CmdDraw(commands, draw->vertexCount, draw->instanceCount,
-                                   draw->firstVertex, draw->firstInstance);
-                break;
-            }
-
-            case Command::DrawIndexed: {
-                workCommandCount++;
-                DrawIndexedCmd* draw = iter->NextCommand<DrawIndexedCmd>();
-
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
-                immediates.Apply(device, commands);
-                device->fn.CmdDrawIndexed(commands, draw->indexCount, draw->instanceCount,
-                                          draw->firstIndex, draw->baseVertex, draw->firstInstance);
-                break;
-            }
-
-            case Command::DrawIndirect: {
-                workCommandCount++;
-                DrawIndirectCmd* draw = iter->NextCommand<DrawIndirectCmd>();
-                Buffer* buffer = ToBackend(draw->indirectBuffer.Get());
-
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
-                immediates.Apply(device, commands);
-                device->fn.CmdDrawIndirect(commands, buffer->GetHandle(),
-                                           static_cast<VkDeviceSize>(draw->indirectOffset), 1, 0);
-                break;
-            }
-
-            case Command::DrawIndexedIndirect: {
-                workCommandCount++;
-                DrawIndexedIndirectCmd* draw = iter->NextCommand<DrawIndexedIndirectCmd>();
-                Buffer* buffer = ToBackend(draw->indirectBuffer.Get());
-                DAWN_ASSERT(buffer != nullptr);
-
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
-                immediates.Apply(device, commands);
-                device->fn.CmdDrawIndexedIndirect(commands, buffer->GetHandle(),
-                                                  static_cast<VkDeviceSize>(draw->indirectOffset),
-                                                  1, 0);
-                break;
-            }
-
-            case Command::MultiDrawIndirect: {
-                workCommandCount++;
-                MultiDrawIndirectCmd* cmd = iter->NextCommand<MultiDrawIndirectCmd>();
-
-                Buffer* indirectBuffer = ToBackend(cmd->indirectBuffer.Get());
-                DAWN_ASSERT(indirectBuffer != nullptr);
-
-                // Count buffer is optional
-                Buffer* countBuffer = ToBackend(cmd->drawCountBuffer.Get());
-
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
-                immediates.Apply(device, commands);
-
-                if (countBuffer == nullptr) {
-                    device->fn.CmdDrawIndirect(commands, indirectBuffer->GetHandle(),
-                                               static_cast<VkDeviceSize>(cmd->indirectOffset),
-                                               cmd->maxDrawCount, kDrawIndirectSize);
-                } else {
-                    device->fn.CmdDrawIndirectCountKHR(
-                        commands, indirectBuffer->GetHandle(),
-                        static_cast<VkDeviceSize>(cmd->indirectOffset), countBuffer->GetHandle(),
-                        static_cast<VkDeviceSize>(cmd->drawCountOffset), cmd->maxDrawCount,
-                        kDrawIndirectSize);
-                }
-                break;
-            }
-            case Command::MultiDrawIndexedIndirect: {
-                workCommandCount++;
-                MultiDrawIndexedIndirectCmd* cmd = iter->NextCommand<MultiDrawIndexedIndirectCmd>();
-
-                Buffer* indirectBuffer = ToBackend(cmd->indirectBuffer.Get());
-                DAWN_ASSERT(indirectBuffer != nullptr);
-
-                // Count buffer is optional
-                Buffer* countBuffer = ToBackend(cmd->drawCountBuffer.Get());
-
-                descriptorSets.Apply(device, recordingContext, VK_PIPELINE_BIND_POINT_GRAPHICS);
-                immediates.Apply(device, commands);
-
-                if (countBuffer == nullptr) {
-                    device->fn.CmdDrawIndexedIndirect(
-                        commands, indirectBuffer->GetHandle(),
-                        static_cast<VkDeviceSize>(cmd->indirectOffset), cmd->maxDrawCount,
-                        kDrawIndexedIndirectSize);
-                } else {
-                    device->fn.CmdDrawIndexedIndirectCountKHR(
-                        commands, indirectBuffer->GetHandle(),
-                        static_cast<VkDeviceSize>(cmd->indirectOffset), countBuffer->GetHandle(),
-                        static_cast<VkDeviceSize>(cmd->drawCountOffset), cmd->maxDrawCount,
-                        kDrawIndexedIndirectSize);
-                }
-
-                break;
-            }
-
-            case Command::InsertDebugMarker: {
-                if (device->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
-                    InsertDebugMarkerCmd* cmd = iter->NextCommand<InsertDebugMarkerCmd>();
-                    const char* label = iter->NextData<char>(cmd->length + 1);
-                    VkDebugUtilsLabelEXT utilsLabel;
-                    utilsLabel.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
-                    utilsLabel.pNext = nullptr;
-                    utilsLabel.pLabelName = label;
-                    // Default color to black
-                    utilsLabel.color[0] = 0.0;
-                    utilsLabel.color[1] = 0.0;
-                    utilsLabel.color[2] = 0.0;
-                    utilsLabel.color[3] = 1.0;
-                    device->fn.CmdInsertDebugUtilsLabelEXT(commands, &utilsLabel);
-                } else {
-                    SkipCommand(iter, Command::InsertDebugMarker);
-                }
-                break;
-            }
-
-            case Command::PopDebugGroup: {
-                if (device->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
-                    iter->NextCommand<PopDebugGroupCmd>();
-                    device->fn.CmdEndDebugUtilsLabelEXT(commands);
-                } else {
-                    SkipCommand(iter, Command::PopDebugGroup);
-                }
-                break;
-            }
-
-            case Command::PushDebugGroup: {
-                if (device->GetGlobalInfo().HasExt(InstanceExt::DebugUtils)) {
-                    PushDebugGroupCmd* cmd = iter->NextCommand<PushDebugGroupCmd>();
-                    const char* label = iter->NextData<char>(cmd->length + 1);
-                    VkDebugUtilsLabelEXT utilsLabel;
-                    utilsLabel.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
-                    utilsLabel.pNext = nullptr;
-                    utilsLabel.pLabelName = label;
-                    // Default color to black
-                    utilsLabel.color[0] = 0.0;
-                    utilsLabel.color[1] = 0.0;
-                    utilsLabel.color[2] = 0.0;
-                    utilsLabel.color[3] = 1.0;
-                    device->fn.CmdBeginDebugUtilsLabelEXT(commands, &utilsLabel);
-                } else {
-                    SkipCommand(iter, Command::PushDebugGroup);
-                }
-                break;
-            }
-
-            case Command::SetBindGroup: {
-                SetBindGroupCmd* cmd = iter->NextCommand<SetBindGroupCmd>();
-                BindGroup* bindGroup = ToBackend(cmd->group.Get());
-                uint32_t* dynamicOffsets = nullptr;
-                if (cmd->dynamicOffsetCount > 0) {
-                    dynamicOffsets = iter->NextData<uint32_t>(cmd->dynamicOffsetCount);
-                }
-
-                descriptorSets.OnSetBindGroup(cmd->index, bindGroup, cmd->dynamicOffsetCount,
-                                              dynamicOffsets);
-                break;
-            }
-
-            case Command::SetIndexBuffer: {
-                SetIndexBufferCmd* cmd = iter->NextCommand<SetIndexBufferCmd>();
-                VkBuffer indexBuffer = ToBackend(cmd->buffer)->GetHandle();
-
-                device->fn.CmdBindIndexBuffer(commands, indexBuffer, cmd->offset,
-                                              VulkanIndexType(cmd->format));
-                break;
-            }
-
-            case Command::SetRenderPipeline: {
-                SetRenderPipelineCmd* cmd = iter->NextCommand<SetRenderPipelineCmd>();
-                RenderPipeline* pipeline = ToBackend(cmd->pipeline).Get();
-
-                device->fn.CmdBindPipeline(commands, VK_PIPELINE_BIND_POINT_GRAPHICS,
-                                           pipeline->GetHandle());
-                lastPipeline = pipeline;
-
-                descriptorSets.OnSetPipeline<RenderPipeline>(pipeline);
-                immediates.OnSetPipeline(pipeline);
-                break;
-            }
-
-            case Command::SetVertexBuffer: {
-                SetVertexBufferCmd* cmd = iter->NextCommand<SetVertexBufferCmd>();
-                VkBuffer buffer = ToBackend(cmd->buffer)->GetHandle();
-                VkDeviceSize offset = static_cast<VkDeviceSize>(cmd->offset);
-
-                device->fn.CmdBindVertexBuffers(commands, static_cast<uint8_t>(cmd->slot), 1,
-                                                &*buffer, &offset);
-                break;
-            }
-
-            case Command::SetImmediateData: {
-                SetImmediateDataCmd* cmd = mCommands.NextCommand<SetImmediateDataCmd>();
-                DAWN_ASSERT(cmd->size > 0);
-                uint8_t* value = nullptr;
-                value = mCommands.NextData<uint8_t>(cmd->size);
-                immediates.SetImmediateData(cmd->offset, value, cmd->size);
-                break;
-            }
-
-            default:
-                DAWN_UNREACHABLE();
-                break;
-        }
-    };
-
     Command type;
     while (mCommands.NextCommandId(&type)) {
         switch (type) {
@@ -1478,7 +1750,7 @@ MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingCon
                 // VulkanAddWorkToEmptyResolvePass toggle is enabled, add a small amount of work
                 // in the form of performing an occlusion query before ending the pass. This avoids
                 // a driver bug that fails to resolve render targets in empty passes.
-                if (workCommandCount == 0 &&
+                if (state.workCommandCount == 0 &&
                     device->IsToggleEnabled(Toggle::VulkanAddWorkToEmptyResolvePass)) {
                     QuerySetBase* querySet = device->GetEmptyPassQuerySet();
                     device->fn.CmdBeginQuery(commands, ToBackend(querySet)->GetHandle(), 0, 0);
@@ -1539,7 +1811,7 @@ MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingCon
 
                 // Try applying the immediate data that contain min/maxDepth immediately. This can
                 // be deferred if no pipeline is currently bound.
-                immediates.SetClampFragDepth(viewport.minDepth, viewport.maxDepth);
+                state.immediates.SetClampFragDepth(viewport.minDepth, viewport.maxDepth);
                 break;
             }
 
@@ -1559,18 +1831,42 @@ MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingCon
                 ExecuteBundlesCmd* cmd = mCommands.NextCommand<ExecuteBundlesCmd>();
                 auto bundles = mCommands.NextData<Ref<RenderBundleBase>>(cmd->count);
 
+                if (useSecondaryCommandBuffers) {
+                    std::vector<VkCommandBuffer> secondaryCommandBuffers(cmd->count);
+                    for (uint32_t i = 0; i < cmd->count; ++i) {
+                        RenderBundleBase* bundle = bundles[i].Get();
+                        auto* bundleCommandBuffers =
+                            static_cast<RenderBundleSecondaryCommandBuffers*>(
+                                bundle->GetBackendData());
+                        if (bundleCommandBuffers == nullptr) {
+                            auto newCommandBuffers =
+                                std::make_unique<RenderBundleSecondaryCommandBuffers>(device,
+                                                                                      bundle);
+                            bundleCommandBuffers = newCommandBuffers.get();
+                            bundle->SetBackendData(std::move(newCommandBuffers));
+                        }
+                        DAWN_TRY(bundleCommandBuffers->GetOrRecord(
+                            compatibleRenderPass, renderPassCmd->width, renderPassCmd->height,
+                            &secondaryCommandBuffers[i]));
+                        state.workCommandCount += bundle->GetDrawCount();
+                    }
+                    device->fn.CmdExecuteCommands(commands, cmd->count,
+                                                  secondaryCommandBuffers.data());
+                    break;
+                }
+
                 for (uint32_t i = 0; i < cmd->count; ++i) {
                     CommandIterator* iter = bundles[i]->GetCommands();
                     iter->Reset();
                     while (iter->NextCommandId(&type)) {
-                        EncodeRenderBundleCommand(iter, type);
+                        EncodeRenderBundleCommand(device, commands, &state, iter, type);
                     }
                 }
                 break;
             }
 
             case Command::BeginOcclusionQuery: {
-                workCommandCount++;
+                state.workCommandCount++;
                 BeginOcclusionQueryCmd* cmd = mCommands.NextCommand<BeginOcclusionQueryCmd>();
 
                 device->fn.CmdBeginQuery(commands, ToBackend(cmd->querySet.Get())->GetHandle(),
@@ -1579,7 +1875,7 @@ MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingCon
             }
 
             case Command::EndOcclusionQuery: {
-                workCommandCount++;
+                state.workCommandCount++;
                 EndOcclusionQueryCmd* cmd = mCommands.NextCommand<EndOcclusionQueryCmd>();
 
                 device->fn.CmdEndQuery(commands, ToBackend(cmd->querySet.Get())->GetHandle(),
@@ -1588,7 +1884,7 @@ MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingCon
             }
 
             case Command::WriteTimestamp: {
-                workCommandCount++;
+                state.workCommandCount++;
                 WriteTimestampCmd* cmd = mCommands.NextCommand<WriteTimestampCmd>();
 
                 RecordWriteTimestampCmd(recordingContext, device, cmd->querySet.Get(),
@@ -1597,7 +1893,7 @@ MaybeError CommandBuffer::RecordRenderPass(CommandRecordingContext* recordingCon
             }
 
             default: {
-                EncodeRenderBundleCommand(&mCommands, type);
+                EncodeRenderBundleCommand(device, commands, &state, &mCommands, type);
                 break;
             }
         }
@@ -48,7 +48,8 @@ class Device;
 
 MaybeError RecordBeginRenderPass(CommandRecordingContext* recordingContext,
                                  Device* device,
-                                 BeginRenderPassCmd* renderPass);
+                                 BeginRenderPassCmd* renderPass,
+                                 VkSubpassContents contents = VK_SUBPASS_CONTENTS_INLINE);
 
 class CommandBuffer final : public CommandBufferBase {
   public:
@@ -64,7 +65,8 @@ class CommandBuffer final : public CommandBufferBase {
                                  BeginComputePassCmd* computePass,
                                  const ComputePassResourceUsage& resourceUsages);
     MaybeError RecordRenderPass(CommandRecordingContext* recordingContext,
-                                BeginRenderPassCmd* renderPass);
+                                BeginRenderPassCmd* renderPass,
+                                bool useSecondaryCommandBuffers);
     MaybeError RecordCopyImageWithTemporaryBuffer(CommandRecordingContext* recordingContext,
                                                   const TextureCopy& srcCopy,
                                                   const TextureCopy& dstCopy,
@@ -41,6 +41,7 @@
 #include "dawn/native/vulkan/UtilsVulkan.h"
 #include "dawn/native/vulkan/VulkanError.h"
 #include "dawn/platform/metrics/HistogramMacros.h"
+#include "dawn/platform/tracing/TraceEvent.h"
 
 namespace dawn::native::vulkan {
 
@@ -125,10 +126,13 @@ MaybeError ComputePipeline::InitializeImpl() {
     // Try to see if we have anything in the blob cache.
     platform::metrics::DawnHistogramTimer cacheTimer(GetDevice()->GetPlatform());
     Ref<PipelineCache> cache = ToBackend(GetDevice()->GetOrCreatePipelineCache(GetCacheKey()));
-    DAWN_TRY(
-        CheckVkSuccess(device->fn.CreateComputePipelines(device->GetVkDevice(), cache->GetHandle(),
-                                                         1, &createInfo, nullptr, &*mHandle),
-                       "CreateComputePipelines"));
+    {
+        TRACE_EVENT0(GetDevice()->GetPlatform(), General, "vkCreateComputePipelines");
+        DAWN_TRY(CheckVkSuccess(device->fn.CreateComputePipelines(device->GetVkDevice(),
+                                                                  cache->GetHandle(), 1,
+                                                                  &createInfo, nullptr, &*mHandle),
+                                "CreateComputePipelines"));
+    }
     cacheTimer.RecordMicroseconds(cache->CacheHit() ? "Vulkan.CreateComputePipelines.CacheHit"
                                                     : "Vulkan.CreateComputePipelines.CacheMiss");
 
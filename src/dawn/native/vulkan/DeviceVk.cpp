@@ -51,6 +51,7 @@
 #include "dawn/native/vulkan/ComputePipelineVk.h"
 #include "dawn/native/vulkan/FencedDeleter.h"
 #include "dawn/native/vulkan/FramebufferCache.h"
+#include "dawn/native/vulkan/GPUPassTimer.h"
 #include "dawn/native/vulkan/PhysicalDeviceVk.h"
 #include "dawn/native/vulkan/PipelineCacheVk.h"
 #include "dawn/native/vulkan/PipelineLayoutVk.h"
@@ -67,6 +68,8 @@
 #include "dawn/native/vulkan/TextureVk.h"
 #include "dawn/native/vulkan/UtilsVulkan.h"
 #include "dawn/native/vulkan/VulkanError.h"
+#include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/tracing/EventTracer.h"
 
 namespace dawn::native::vulkan {
 namespace {
@@ -143,6 +146,13 @@ MaybeError Device::Initialize(const UnpackedPtr<DeviceDescriptor>& descriptor) {
     mFramebufferCache = std::make_unique<FramebufferCache>(this);
     mRenderPassCache = std::make_unique<RenderPassCache>(this);
 
+    if (IsToggleEnabled(Toggle::TraceGPUPassDurations) &&
+        mDeviceInfo.properties.limits.timestampComputeAndGraphics == VK_TRUE &&
+        *platform::tracing::GetTraceCategoryEnabledFlag(GetPlatform(),
+                                                        platform::TraceCategory::GPUWork)) {
+        DAWN_TRY_ASSIGN(mGPUPassTimer, GPUPassTimer::Create(this));
+    }
+
     VkDeviceSize heapBlockSize =
         ResourceMemoryAllocator::GetHeapBlockSize(descriptor.Get<DawnDeviceAllocatorControl>());
     mResourceMemoryAllocator =
@@ -356,6 +366,9 @@ MaybeError Device::TickImpl() {
         pending->ClearUpTo(completedSerial);
     });
 
+    if (mGPUPassTimer != nullptr) {
+        mGPUPassTimer->Tick(completedSerial);
+    }
     GetResourceMemoryAllocator()->Tick(completedSerial);
     GetFencedDeleter()->Tick(completedSerial);
 
@@ -396,6 +409,10 @@ RenderPassCache* Device::GetRenderPassCache() const {
     return mRenderPassCache.get();
 }
 
+GPUPassTimer* Device::GetGPUPassTimer() const {
+    return mGPUPassTimer.get();
+}
+
 MutexProtected<ResourceMemoryAllocator>& Device::GetResourceMemoryAllocator() const {
     return *mResourceMemoryAllocator;
 }
@@ -958,6 +975,11 @@ void Device::DestroyImpl() {
         pending->ClearUpTo(kMaxExecutionSerial);
     });
 
+    if (mGPUPassTimer != nullptr) {
+        mGPUPassTimer->Destroy();
+        mGPUPassTimer = nullptr;
+    }
+
     // Releasing the uploader enqueues buffers to be released.
     // Call Tick() again to clear them before releasing the deleter.
     GetResourceMemoryAllocator()->Tick(kMaxExecutionSerial);
@@ -1060,9 +1082,16 @@ AllocatorMemoryInfo Device::GetAllocatorMemoryInfo() const {
     info.totalUsedMemory = GetResourceMemoryAllocator()->GetTotalUsedMemory();
     info.totalLazyAllocatedMemory = GetResourceMemoryAllocator()->GetTotalLazyAllocatedMemory();
     info.totalLazyUsedMemory = GetResourceMemoryAllocator()->GetTotalLazyUsedMemory();
+    info.peakAliasedTransientMemory =
+        GetResourceMemoryAllocator()->GetPeakAliasedTransientMemory();
     return info;
 }
 
+void Device::GetBackendMemoryStatistics(DeviceMemoryStatistics* statistics) const {
+    DAWN_ASSERT(IsLockedByCurrentThreadIfNeeded());
+    GetResourceMemoryAllocator()->GetStatistics(statistics);
+}
+
 void Device::SetLabelImpl() {
     SetDebugName(this, VK_OBJECT_TYPE_DEVICE, mVkDevice, "Dawn_Device", GetLabel());
 }
@@ -54,6 +54,7 @@ namespace dawn::native::vulkan {
 class BufferUploader;
 class FencedDeleter;
 class FramebufferCache;
+class GPUPassTimer;
 class RenderPassCache;
 class ResourceMemoryAllocator;
 
@@ -79,6 +80,8 @@ class Device final : public DeviceBase {
     MutexProtected<FencedDeleter>& GetFencedDeleter() const;
     FramebufferCache* GetFramebufferCache() const;
     RenderPassCache* GetRenderPassCache() const;
+    // Returns nullptr unless the GPU duration of passes is being traced.
+    GPUPassTimer* GetGPUPassTimer() const;
     MutexProtected<ResourceMemoryAllocator>& GetResourceMemoryAllocator() const;
     external_semaphore::Service* GetExternalSemaphoreService() const;
 
@@ -121,6 +124,7 @@ class Device final : public DeviceBase {
     float GetTimestampPeriodInNS() const override;
 
     AllocatorMemoryInfo GetAllocatorMemoryInfo() const override;
+    void GetBackendMemoryStatistics(DeviceMemoryStatistics* statistics) const override;
 
     void SetLabelImpl() override;
     bool ReduceMemoryUsageImpl() override;
@@ -205,6 +209,7 @@ class Device final : public DeviceBase {
     std::unique_ptr<MutexProtected<ResourceMemoryAllocator>> mResourceMemoryAllocator;
     std::unique_ptr<FramebufferCache> mFramebufferCache;
     std::unique_ptr<RenderPassCache> mRenderPassCache;
+    std::unique_ptr<GPUPassTimer> mGPUPassTimer;
 
     std::unique_ptr<external_memory::Service> mExternalMemoryService;
     std::unique_ptr<external_semaphore::Service> mExternalSemaphoreService;
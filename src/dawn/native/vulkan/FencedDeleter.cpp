@@ -38,6 +38,7 @@ FencedDeleter::FencedDeleter(Device* device) : mDevice(device) {}
 
 FencedDeleter::~FencedDeleter() {
     DAWN_ASSERT(mBuffersToDelete.Empty());
+    DAWN_ASSERT(mCommandPoolsToDelete.Empty());
     DAWN_ASSERT(mDescriptorPoolsToDelete.Empty());
     DAWN_ASSERT(mFencesToDelete.Empty());
     DAWN_ASSERT(mFramebuffersToDelete.Empty());
@@ -59,6 +60,10 @@ void FencedDeleter::DeleteWhenUnused(VkBuffer buffer) {
     mBuffersToDelete.Enqueue(buffer, GetCurrentDeletionSerial());
 }
 
+void FencedDeleter::DeleteWhenUnused(VkCommandPool pool) {
+    mCommandPoolsToDelete.Enqueue(pool, GetCurrentDeletionSerial());
+}
+
 void FencedDeleter::DeleteWhenUnused(VkDescriptorPool pool) {
     mDescriptorPoolsToDelete.Enqueue(pool, GetCurrentDeletionSerial());
 }
@@ -128,6 +133,7 @@ ExecutionSerial FencedDeleter::GetLastPendingDeletionSerial() {
     };
 
     GetLastSubmitted(mBuffersToDelete);
+    GetLastSubmitted(mCommandPoolsToDelete);
     GetLastSubmitted(mDescriptorPoolsToDelete);
     GetLastSubmitted(mFencesToDelete);
     GetLastSubmitted(mFramebuffersToDelete);
@@ -221,6 +227,12 @@ void FencedDeleter::Tick(ExecutionSerial completedSerial) {
     }
     mDescriptorPoolsToDelete.ClearUpTo(completedSerial);
 
+    // Destroying a command pool frees all the command buffers allocated from it.
+    for (VkCommandPool pool : mCommandPoolsToDelete.IterateUpTo(completedSerial)) {
+        mDevice->fn.DestroyCommandPool(vkDevice, pool, nullptr);
+    }
+    mCommandPoolsToDelete.ClearUpTo(completedSerial);
+
     for (VkQueryPool pool : mQueryPoolsToDelete.IterateUpTo(completedSerial)) {
         mDevice->fn.DestroyQueryPool(vkDevice, pool, nullptr);
     }
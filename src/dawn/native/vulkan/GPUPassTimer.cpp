@@ -0,0 +1,158 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/native/vulkan/GPUPassTimer.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "dawn/native/vulkan/CommandRecordingContextVk.h"
+#include "dawn/native/vulkan/DeviceVk.h"
+#include "dawn/native/vulkan/FencedDeleter.h"
+#include "dawn/native/vulkan/VulkanError.h"
+#include "dawn/platform/tracing/TraceEvent.h"
+
+namespace dawn::native::vulkan {
+
+namespace {
+
+// Each timed pass uses two queries, one for its beginning and one for its end.
+constexpr uint32_t kMaxTimedPassesInFlight = 256;
+
+}  // anonymous namespace
+
+// static
+ResultOrError<std::unique_ptr<GPUPassTimer>> GPUPassTimer::Create(Device* device) {
+    VkQueryPoolCreateInfo createInfo;
+    createInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    createInfo.pNext = nullptr;
+    createInfo.flags = 0;
+    createInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    createInfo.queryCount = 2 * kMaxTimedPassesInFlight;
+    createInfo.pipelineStatistics = 0;
+
+    VkQueryPool queryPool = VK_NULL_HANDLE;
+    DAWN_TRY(CheckVkOOMThenSuccess(
+        device->fn.CreateQueryPool(device->GetVkDevice(), &createInfo, nullptr, &*queryPool),
+        "vkCreateQueryPool"));
+
+    return std::unique_ptr<GPUPassTimer>(new GPUPassTimer(device, queryPool));
+}
+
+GPUPassTimer::GPUPassTimer(Device* device, VkQueryPool queryPool)
+    : mDevice(device), mQueryPool(queryPool) {
+    mFreePassIndices.reserve(kMaxTimedPassesInFlight);
+    for (uint32_t i = kMaxTimedPassesInFlight; i > 0; --i) {
+        mFreePassIndices.push_back(i - 1);
+    }
+}
+
+GPUPassTimer::~GPUPassTimer() {
+    DAWN_ASSERT(mQueryPool == VK_NULL_HANDLE);
+}
+
+std::optional<uint32_t> GPUPassTimer::BeginPass(CommandRecordingContext* recordingContext,
+                                                const char* name) {
+    if (mFreePassIndices.empty()) {
+        return std::nullopt;
+    }
+    uint32_t passIndex = mFreePassIndices.back();
+    mFreePassIndices.pop_back();
+
+    VkCommandBuffer commands = recordingContext->commandBuffer;
+    mDevice->fn.CmdResetQueryPool(commands, mQueryPool, 2 * passIndex, 2);
+    mDevice->fn.CmdWriteTimestamp(commands, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, mQueryPool,
+                                  2 * passIndex);
+
+    mPassesPendingSubmit.push_back(TimedPass{passIndex, name});
+    return passIndex;
+}
+
+void GPUPassTimer::EndPass(CommandRecordingContext* recordingContext, uint32_t passIndex) {
+    mDevice->fn.CmdWriteTimestamp(recordingContext->commandBuffer,
+                                  VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, mQueryPool,
+                                  2 * passIndex + 1);
+
+    auto pass = std::find_if(mPassesPendingSubmit.rbegin(), mPassesPendingSubmit.rend(),
+                             [&](const TimedPass& p) { return p.passIndex == passIndex; });
+    DAWN_ASSERT(pass != mPassesPendingSubmit.rend());
+    pass->ended = true;
+}
+
+void GPUPassTimer::OnCommandsSubmitted(ExecutionSerial submittedSerial) {
+    // The queries of passes that never ended are reset but never written, so they are never
+    // available. They still have to wait for the submit to complete before their queries are
+    // reused.
+    for (TimedPass& pass : mPassesPendingSubmit) {
+        mTimedPasses.Enqueue(std::move(pass), submittedSerial);
+    }
+    mPassesPendingSubmit.clear();
+}
+
+void GPUPassTimer::Tick(ExecutionSerial completedSerial) {
+    const VkQueueFamilyProperties& queueFamily =
+        mDevice->GetDeviceInfo().queueFamilies[mDevice->GetGraphicsQueueFamily()];
+    uint32_t validBits = queueFamily.timestampValidBits;
+    uint64_t validMask = validBits >= 64 ? ~uint64_t(0) : (uint64_t(1) << validBits) - 1;
+    double nsPerTick = mDevice->GetTimestampPeriodInNS();
+
+    for (const TimedPass& pass : mTimedPasses.IterateUpTo(completedSerial)) {
+        mFreePassIndices.push_back(pass.passIndex);
+        if (!pass.ended) {
+            continue;
+        }
+
+        uint64_t timestamps[2];
+        VkResult result = VkResult::WrapUnsafe(mDevice->fn.GetQueryPoolResults(
+            mDevice->GetVkDevice(), mQueryPool, 2 * pass.passIndex, 2, sizeof(timestamps),
+            timestamps, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT));
+        // The results are not available if the device was lost while running the commands.
+        if (result != VK_SUCCESS) {
+            continue;
+        }
+        double durationUs = ((timestamps[1] - timestamps[0]) & validMask) * nsPerTick / 1000.0;
+        TRACE_EVENT_INSTANT1(mDevice->GetPlatform(), GPUWork, pass.name, "gpuDurationUs",
+                             durationUs);
+    }
+    mTimedPasses.ClearUpTo(completedSerial);
+}
+
+void GPUPassTimer::Destroy() {
+    if (mQueryPool != VK_NULL_HANDLE) {
+        mDevice->GetFencedDeleter()->DeleteWhenUnused(mQueryPool);
+        mQueryPool = VK_NULL_HANDLE;
+    }
+    mPassesPendingSubmit.clear();
+    mTimedPasses.Clear();
+    mFreePassIndices.clear();
+}
+
+size_t GPUPassTimer::GetFreePassCountForTesting() const {
+    return mFreePassIndices.size();
+}
+
+}  // namespace dawn::native::vulkan
@@ -0,0 +1,95 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_NATIVE_VULKAN_GPUPASSTIMER_H_
+#define SRC_DAWN_NATIVE_VULKAN_GPUPASSTIMER_H_
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "dawn/common/SerialQueue.h"
+#include "dawn/common/vulkan_platform.h"
+#include "dawn/native/Error.h"
+#include "dawn/native/IntegerTypes.h"
+#include "partition_alloc/pointers/raw_ptr.h"
+
+namespace dawn::native::vulkan {
+
+struct CommandRecordingContext;
+class Device;
+
+// Measures the GPU duration of render and compute passes with timestamps written into an internal
+// query pool, and reports them as GPUWork trace events once the commands that contain them have
+// completed. Used when the TraceGPUPassDurations toggle is enabled.
+class GPUPassTimer {
+  public:
+    static ResultOrError<std::unique_ptr<GPUPassTimer>> Create(Device* device);
+    ~GPUPassTimer();
+
+    // Writes the timestamp for the start of a pass named `name`, which must be a string literal.
+    // Returns the index to pass to EndPass, or std::nullopt if too many passes are in flight to
+    // time this one. Must be called outside of a render pass.
+    std::optional<uint32_t> BeginPass(CommandRecordingContext* recordingContext,
+                                      const char* name);
+    // Writes the timestamp for the end of the pass. Must be called outside of a render pass.
+    void EndPass(CommandRecordingContext* recordingContext, uint32_t passIndex);
+
+    // Called when the pending recording context is submitted as `submittedSerial`. Only the
+    // passes recorded in submitted commands have had their queries reset, so only those are read
+    // back in Tick. Passes that were never ended because recording failed are released without
+    // being read back.
+    void OnCommandsSubmitted(ExecutionSerial submittedSerial);
+
+    // Reports the durations of the passes that completed at `completedSerial`.
+    void Tick(ExecutionSerial completedSerial);
+
+    size_t GetFreePassCountForTesting() const;
+
+    // Releases the query pool once the GPU is done with it.
+    void Destroy();
+
+  private:
+    struct TimedPass {
+        uint32_t passIndex;
+        const char* name;
+        bool ended = false;
+    };
+
+    GPUPassTimer(Device* device, VkQueryPool queryPool);
+
+    raw_ptr<Device> mDevice;
+    VkQueryPool mQueryPool = VK_NULL_HANDLE;
+    std::vector<uint32_t> mFreePassIndices;
+    // Passes recorded in the pending recording context, which may never be submitted.
+    std::vector<TimedPass> mPassesPendingSubmit;
+    SerialQueue<ExecutionSerial, TimedPass> mTimedPasses;
+};
+
+}  // namespace dawn::native::vulkan
+
+#endif  // SRC_DAWN_NATIVE_VULKAN_GPUPASSTIMER_H_
@@ -30,16 +30,22 @@
 #include <limits>
 #include <optional>
 #include <utility>
+#include <vector>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
 #include "dawn/common/Math.h"
 #include "dawn/native/Buffer.h"
 #include "dawn/native/CommandValidation.h"
 #include "dawn/native/Commands.h"
 #include "dawn/native/DynamicUploader.h"
+#include "dawn/native/PassResourceUsage.h"
+#include "dawn/native/SubresourceStorage.h"
 #include "dawn/native/vulkan/CommandBufferVk.h"
 #include "dawn/native/vulkan/CommandRecordingContextVk.h"
 #include "dawn/native/vulkan/DeviceVk.h"
 #include "dawn/native/vulkan/FencedDeleter.h"
+#include "dawn/native/vulkan/GPUPassTimer.h"
 #include "dawn/native/vulkan/TextureVk.h"
 #include "dawn/native/vulkan/UniqueVkHandle.h"
 #include "dawn/native/vulkan/UtilsVulkan.h"
@@ -69,6 +75,88 @@ void DestroyCommandPoolAndBuffer(const VulkanFunctions& fn,
     }
 }
 
+// How the passes of a submit use a subresource of a texture.
+struct SubresourcePassUsage {
+    bool read = false;
+    bool written = false;
+
+    bool operator==(const SubresourcePassUsage& other) const = default;
+};
+
+// Lazily clears, before recording `commands`, the uninitialized subresources that would be cleared
+// when recording their passes, as long as nothing else in the submit can initialize them first:
+// subresources that some pass writes, and textures used by commands outside of passes (e.g.
+// copies), are left to be cleared when their commands are recorded. Since the rest are only read,
+// clearing them up front gives the same result as clearing them in submit order. They are
+// coalesced per texture and transitioned with a single barrier.
+MaybeError ClearSubresourcesUsedInPasses(Device* device,
+                                         CommandRecordingContext* recordingContext,
+                                         uint32_t commandCount,
+                                         CommandBufferBase* const* commands) {
+    absl::flat_hash_set<TextureBase*> texturesUsedOutsidePasses;
+    for (uint32_t i = 0; i < commandCount; ++i) {
+        const CommandBufferResourceUsage& usages = commands[i]->GetResourceUsages();
+        texturesUsedOutsidePasses.insert(usages.topLevelTextures.begin(),
+                                         usages.topLevelTextures.end());
+    }
+
+    absl::flat_hash_map<Texture*, SubresourceStorage<SubresourcePassUsage>> passUsages;
+    auto AddSyncScope = [&](const SyncScopeResourceUsage& scope) {
+        for (size_t i = 0; i < scope.textures.size(); ++i) {
+            Texture* texture = ToBackend(scope.textures[i]);
+            if (texturesUsedOutsidePasses.contains(texture) ||
+                texture->IsSubresourceContentInitialized(texture->GetAllSubresources())) {
+                continue;
+            }
+
+            auto it = passUsages.find(texture);
+            if (it == passUsages.end()) {
+                it = passUsages
+                         .try_emplace(texture, texture->GetFormat().aspects,
+                                      texture->GetArrayLayers(), texture->GetNumMipLevels())
+                         .first;
+            }
+            scope.textureSyncInfos[i].Iterate(
+                [&](const SubresourceRange& range, const TextureSyncInfo& syncInfo) {
+                    it->second.Update(range, [&](const SubresourceRange&,
+                                                 SubresourcePassUsage* usage) {
+                        usage->read |= (syncInfo.usage & ~wgpu::TextureUsage::RenderAttachment) !=
+                                       wgpu::TextureUsage::None;
+                        usage->written |= (syncInfo.usage & ~kReadOnlyTextureUsages) !=
+                                          wgpu::TextureUsage::None;
+                    });
+                });
+        }
+    };
+
+    for (uint32_t i = 0; i < commandCount; ++i) {
+        const CommandBufferResourceUsage& usages = commands[i]->GetResourceUsages();
+        for (const RenderPassResourceUsage& usage : usages.renderPasses) {
+            AddSyncScope(usage);
+        }
+        for (const ComputePassResourceUsage& pass : usages.computePasses) {
+            for (const SyncScopeResourceUsage& usage : pass.dispatchUsages) {
+                AddSyncScope(usage);
+            }
+        }
+    }
+
+    std::vector<std::pair<Texture*, SubresourceRange>> ranges;
+    for (const auto& [texture, usages] : passUsages) {
+        usages.Iterate([&](const SubresourceRange& range, const SubresourcePassUsage& usage) {
+            if (usage.read && !usage.written) {
+                ranges.emplace_back(texture, range);
+            }
+        });
+    }
+
+    uint32_t clearCount;
+    DAWN_TRY_ASSIGN(clearCount,
+                    Texture::EnsureSubresourceContentInitializedBatched(recordingContext, ranges));
+    TRACE_COUNTER1(device->GetPlatform(), General, "Vulkan::LazyClearsPerSubmit", clearCount);
+    return {};
+}
+
 }  // anonymous namespace
 
 // static
@@ -98,6 +186,11 @@ MaybeError Queue::Initialize() {
 MaybeError Queue::SubmitImpl(uint32_t commandCount, CommandBufferBase* const* commands) {
     TRACE_EVENT_BEGIN0(GetDevice()->GetPlatform(), Recording, "CommandBufferVk::RecordCommands");
     CommandRecordingContext* recordingContext = GetPendingRecordingContext();
+    Device* device = ToBackend(GetDevice());
+    if (device->IsToggleEnabled(Toggle::LazyClearResourceOnFirstUse) &&
+        device->IsToggleEnabled(Toggle::VulkanBatchLazyClearsPerSubmit)) {
+        DAWN_TRY(ClearSubresourcesUsedInPasses(device, recordingContext, commandCount, commands));
+    }
     for (uint32_t i = 0; i < commandCount; ++i) {
         DAWN_TRY(ToBackend(commands[i])->RecordCommands(recordingContext));
     }
@@ -375,6 +468,10 @@ MaybeError Queue::SubmitPendingCommandsImpl() {
     IncrementLastSubmittedCommandSerial();
     ExecutionSerial lastSubmittedSerial = GetLastSubmittedCommandSerial();
     mFencesInFlight->emplace_back(fence, lastSubmittedSerial);
+    GPUPassTimer* passTimer = device->GetGPUPassTimer();
+    if (passTimer != nullptr) {
+        passTimer->OnCommandsSubmitted(lastSubmittedSerial);
+    }
 
     for (size_t i = 0; i < mRecordingContext.commandBufferList.size(); ++i) {
         CommandPoolAndBuffer submittedCommands = {mRecordingContext.commandPoolList[i],
@@ -27,6 +27,9 @@
 
 #include "dawn/native/vulkan/ResourceHeapVk.h"
 
+#include "dawn/native/vulkan/DeviceVk.h"
+#include "dawn/native/vulkan/VulkanError.h"
+
 namespace dawn::native::vulkan {
 
 ResourceHeap::ResourceHeap(VkDeviceMemory memory, size_t memoryType, VkDeviceSize size)
@@ -44,4 +47,15 @@ VkDeviceSize ResourceHeap::GetSize() const {
     return mSize;
 }
 
+ResultOrError<uint8_t*> ResourceHeap::GetPersistentlyMappedPointer(Device* device) {
+    if (mPersistentlyMappedPointer == nullptr) {
+        void* mappedPointer;
+        DAWN_TRY(CheckVkSuccess(device->fn.MapMemory(device->GetVkDevice(), mMemory, 0,
+                                                     VK_WHOLE_SIZE, 0, &mappedPointer),
+                                "vkMapMemory"));
+        mPersistentlyMappedPointer = static_cast<uint8_t*>(mappedPointer);
+    }
+    return mPersistentlyMappedPointer;
+}
+
 }  // namespace dawn::native::vulkan
@@ -29,10 +29,13 @@
 #define SRC_DAWN_NATIVE_VULKAN_RESOURCEHEAPVK_H_
 
 #include "dawn/common/vulkan_platform.h"
+#include "dawn/native/Error.h"
 #include "dawn/native/ResourceHeap.h"
 
 namespace dawn::native::vulkan {
 
+class Device;
+
 // Wrapper for physical memory used with or without a resource object.
 class ResourceHeap : public ResourceHeapBase {
   public:
@@ -43,10 +46,16 @@ class ResourceHeap : public ResourceHeapBase {
     size_t GetMemoryType() const;
     VkDeviceSize GetSize() const;
 
+    // Returns a pointer to the start of the heap, mapping all of it the first time this is called.
+    // The mapping lasts until the memory is freed. Only valid for host-visible heaps that are not
+    // otherwise mapped, i.e. heaps of non-mappable resources.
+    ResultOrError<uint8_t*> GetPersistentlyMappedPointer(Device* device);
+
   private:
     VkDeviceMemory mMemory = VK_NULL_HANDLE;
     size_t mMemoryType = 0;
     VkDeviceSize mSize = 0;
+    uint8_t* mPersistentlyMappedPointer = nullptr;
 };
 
 }  // namespace dawn::native::vulkan
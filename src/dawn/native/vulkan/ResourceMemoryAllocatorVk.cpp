@@ -31,6 +31,7 @@
 #include <utility>
 
 #include "dawn/common/Math.h"
+#include "dawn/native/AllocatorStatistics.h"
 #include "dawn/native/BuddyMemoryAllocator.h"
 #include "dawn/native/Queue.h"
 #include "dawn/native/ResourceHeapAllocator.h"
@@ -147,6 +148,11 @@ class ResourceMemoryAllocator::SingleTypeAllocator : public ResourceHeapAllocato
                                                          mIsLazyMemoryType);
     }
 
+    MemoryAllocatorStatistics GetBuddyStatistics() const { return mBuddySystem.GetStatistics(); }
+    MemoryAllocatorStatistics GetPoolStatistics() const {
+        return mPooledMemoryAllocator.GetStatistics();
+    }
+
   private:
     raw_ptr<Device> mDevice;
     raw_ptr<ResourceMemoryAllocator> mResourceMemoryAllocator;
@@ -159,6 +165,7 @@ class ResourceMemoryAllocator::SingleTypeAllocator : public ResourceHeapAllocato
 
 void ResourceMemoryAllocator::AllocationSizeTracker::Increment(VkDeviceSize incrementSize) {
     mTotalSize += incrementSize;
+    mPeakSize = std::max(mPeakSize, mTotalSize);
 }
 
 void ResourceMemoryAllocator::AllocationSizeTracker::Decrement(ExecutionSerial currentSerial,
@@ -167,6 +174,11 @@ void ResourceMemoryAllocator::AllocationSizeTracker::Decrement(ExecutionSerial c
     mMemoryToDecrement[currentSerial] += decrementSize;
 }
 
+void ResourceMemoryAllocator::AllocationSizeTracker::DecrementNow(VkDeviceSize decrementSize) {
+    DAWN_ASSERT(mTotalSize >= decrementSize);
+    mTotalSize -= decrementSize;
+}
+
 void ResourceMemoryAllocator::AllocationSizeTracker::Tick(ExecutionSerial completedSerial) {
     auto it = mMemoryToDecrement.begin();
     while (it != mMemoryToDecrement.end() && it->first <= completedSerial) {
@@ -199,6 +211,7 @@ ResourceMemoryAllocator::ResourceMemoryAllocator(Device* device, VkDeviceSize he
         info, kMapExtendedUsageMemoryPropertyFlags | VK_MEMORY_PROPERTY_HOST_CACHED_BIT);
 
     mAllocatorsPerType.reserve(info.memoryTypes.size());
+    mTransientAllocatorsPerType.reserve(info.memoryTypes.size());
     for (size_t i = 0; i < info.memoryTypes.size(); i++) {
         const auto& memoryType = info.memoryTypes[i];
         bool isLazyMemoryType =
@@ -206,6 +219,9 @@ ResourceMemoryAllocator::ResourceMemoryAllocator(Device* device, VkDeviceSize he
         mAllocatorsPerType.emplace_back(std::make_unique<SingleTypeAllocator>(
             mDevice, i, isLazyMemoryType, info.memoryHeaps[memoryType.heapIndex].size,
             heapBlockSize, this));
+        mTransientAllocatorsPerType.emplace_back(std::make_unique<SingleTypeAllocator>(
+            mDevice, i, isLazyMemoryType, info.memoryHeaps[memoryType.heapIndex].size,
+            heapBlockSize, this));
     }
 }
 
@@ -257,6 +273,7 @@ ResultOrError<ResourceMemoryAllocation> ResourceMemoryAllocator::Allocate(
         if (subAllocation.GetInfo().mMethod != AllocationMethod::kInvalid) {
             mUsedMemory.Increment(requirements.size);
             mLazyUsedMemory.Increment(isLazyMemoryType ? requirements.size : 0);
+            mAllocationCount++;
             return subAllocation;
         }
     }
@@ -277,6 +294,7 @@ ResultOrError<ResourceMemoryAllocation> ResourceMemoryAllocator::Allocate(
 
     mUsedMemory.Increment(size);
     mLazyUsedMemory.Increment(isLazyMemoryType ? size : 0);
+    mAllocationCount++;
 
     AllocationInfo info;
     info.mMethod = AllocationMethod::kDirect;
@@ -307,6 +325,7 @@ void ResourceMemoryAllocator::Deallocate(ResourceMemoryAllocation* allocation) {
             allocation->Invalidate();
             DeallocateResourceHeap(heap, info.mIsLazyAllocated);
             delete heap;
+            mAllocationCount--;
             break;
         }
 
@@ -323,6 +342,7 @@ void ResourceMemoryAllocator::Deallocate(ResourceMemoryAllocation* allocation) {
             if (info.mIsLazyAllocated) {
                 mLazyUsedMemory.Decrement(deletionSerial, info.mRequestedSize);
             }
+            mAllocationCount--;
             break;
         }
 
@@ -336,6 +356,89 @@ void ResourceMemoryAllocator::Deallocate(ResourceMemoryAllocation* allocation) {
     allocation->Invalidate();
 }
 
+ResultOrError<ResourceMemoryAllocation> ResourceMemoryAllocator::AllocateTransient(
+    const VkMemoryRequirements& requirements) {
+    int memoryType = FindBestTypeIndex(requirements, MemoryKind::LazilyAllocated);
+    DAWN_ASSERT(memoryType >= 0);
+
+    // Lazily allocated memory is only committed if the attachment actually needs it so there is
+    // nothing to gain from aliasing it. Large attachments get their own memory like in Allocate().
+    if (mTransientAllocatorsPerType[memoryType]->IsLazyMemoryType() ||
+        requirements.size >= mMaxSizeForSuballocation ||
+        mDevice->IsToggleEnabled(Toggle::DisableResourceSuballocation)) {
+        return ResourceMemoryAllocation();
+    }
+
+    // The transient heaps only contain optimally tiled images so, unlike in Allocate(), there is
+    // no need to respect bufferImageGranularity.
+    ResourceMemoryAllocation subAllocation;
+    DAWN_TRY_ASSIGN(subAllocation, mTransientAllocatorsPerType[memoryType]->AllocateMemory(
+                                       requirements.size, requirements.alignment));
+    if (subAllocation.GetInfo().mMethod != AllocationMethod::kInvalid) {
+        mUsedMemory.Increment(requirements.size);
+        mAllocationCount++;
+        TrackTransientAliasing(subAllocation);
+    }
+    return subAllocation;
+}
+
+void ResourceMemoryAllocator::TrackTransientAliasing(const ResourceMemoryAllocation& allocation) {
+    VkDeviceMemory memory = ToBackend(allocation.GetResourceHeap())->GetMemory();
+    uint64_t begin = allocation.GetOffset();
+    uint64_t end = begin + allocation.GetInfo().mRequestedSize;
+
+    // Find the parts of the new allocation that destroyed transient attachments may still be using
+    // on the GPU. Released ranges can overlap each other when memory is aliased several times, so
+    // merge the overlaps before counting them.
+    std::vector<std::pair<uint64_t, uint64_t>> overlaps;
+    ExecutionSerial lastSerial = kBeginningOfGPUTime;
+    for (const ReleasedTransientRange& range : mReleasedTransientRanges.IterateAll()) {
+        uint64_t overlapBegin = std::max(begin, range.offset);
+        uint64_t overlapEnd = std::min(end, range.offset + range.size);
+        if (range.memory != memory || overlapBegin >= overlapEnd) {
+            continue;
+        }
+        overlaps.emplace_back(overlapBegin, overlapEnd);
+        lastSerial = std::max(lastSerial, range.serial);
+    }
+    if (overlaps.empty()) {
+        return;
+    }
+
+    std::sort(overlaps.begin(), overlaps.end());
+    uint64_t aliasedSize = 0;
+    uint64_t coveredEnd = begin;
+    for (const auto& [overlapBegin, overlapEnd] : overlaps) {
+        aliasedSize += overlapEnd - std::max(overlapBegin, std::min(coveredEnd, overlapEnd));
+        coveredEnd = std::max(coveredEnd, overlapEnd);
+    }
+
+    // The memory stops being aliased once the GPU is done with its previous users.
+    mAliasedTransientMemory.Increment(aliasedSize);
+    mAliasedTransientMemory.Decrement(lastSerial, aliasedSize);
+}
+
+void ResourceMemoryAllocator::DeallocateTransient(ResourceMemoryAllocation* allocation) {
+    AllocationInfo info = allocation->GetInfo();
+    DAWN_ASSERT(info.mMethod == AllocationMethod::kSubAllocated);
+
+    // Contrary to other sub-allocations the memory is given back right away so that the next
+    // transient attachment can alias it. Remember which range the GPU may still be using so that
+    // reusing it is reported by GetPeakAliasedTransientMemory().
+    ResourceHeap* heap = ToBackend(allocation->GetResourceHeap());
+    ExecutionSerial deletionSerial = mDevice->GetFencedDeleter()->GetCurrentDeletionSerial();
+    mReleasedTransientRanges.Enqueue(
+        ReleasedTransientRange{heap->GetMemory(), allocation->GetOffset(), info.mRequestedSize,
+                               deletionSerial},
+        deletionSerial);
+    mUsedMemory.DecrementNow(info.mRequestedSize);
+
+    size_t memoryType = heap->GetMemoryType();
+    mTransientAllocatorsPerType[memoryType]->DeallocateMemory(*allocation);
+    allocation->Invalidate();
+    mAllocationCount--;
+}
+
 ExecutionSerial ResourceMemoryAllocator::GetLastPendingDeletionSerial() {
     ExecutionSerial lastSerial = kBeginningOfGPUTime;
     auto GetLastSubmitted = [&lastSerial](auto& queue) {
@@ -373,12 +476,14 @@ void ResourceMemoryAllocator::Tick(ExecutionSerial completedSerial) {
         mAllocatorsPerType[memoryType]->DeallocateMemory(allocation);
     }
     mSubAllocationsToDelete.ClearUpTo(completedSerial);
+    mReleasedTransientRanges.ClearUpTo(completedSerial);
 
     // Update the allocation sizes after completed serials.
     mAllocatedMemory.Tick(completedSerial);
     mUsedMemory.Tick(completedSerial);
     mLazyAllocatedMemory.Tick(completedSerial);
     mLazyUsedMemory.Tick(completedSerial);
+    mAliasedTransientMemory.Tick(completedSerial);
 }
 
 int ResourceMemoryAllocator::FindBestTypeIndex(VkMemoryRequirements requirements, MemoryKind kind) {
@@ -462,6 +567,9 @@ void ResourceMemoryAllocator::FreeRecycledMemory() {
     for (auto& alloc : mAllocatorsPerType) {
         alloc->FreeRecycledMemory();
     }
+    for (auto& alloc : mTransientAllocatorsPerType) {
+        alloc->FreeRecycledMemory();
+    }
 }
 
 uint64_t ResourceMemoryAllocator::GetTotalUsedMemory() const {
@@ -480,6 +588,28 @@ uint64_t ResourceMemoryAllocator::GetTotalLazyUsedMemory() const {
     return mLazyUsedMemory.Size();
 }
 
+uint64_t ResourceMemoryAllocator::GetPeakAliasedTransientMemory() const {
+    return mAliasedTransientMemory.PeakSize();
+}
+
+void ResourceMemoryAllocator::GetStatistics(DeviceMemoryStatistics* statistics) const {
+    MemoryAllocatorStatistics& resources = statistics->resources;
+    resources.usedSize = mUsedMemory.Size();
+    resources.peakUsedSize = mUsedMemory.PeakSize();
+    resources.reservedSize = mAllocatedMemory.Size();
+    resources.peakReservedSize = mAllocatedMemory.PeakSize();
+    resources.allocationCount = mAllocationCount;
+    UpdateFragmentation(&resources);
+
+    for (const auto* allocators : {&mAllocatorsPerType, &mTransientAllocatorsPerType}) {
+        for (const auto& allocator : *allocators) {
+            AccumulateAllocatorStatistics(&statistics->buddyAllocators,
+                                          allocator->GetBuddyStatistics());
+            AccumulateAllocatorStatistics(&statistics->heapPools, allocator->GetPoolStatistics());
+        }
+    }
+}
+
 VkMemoryPropertyFlags ResourceMemoryAllocator::GetRequiredMemoryPropertyFlags(
     MemoryKind memoryKind) const {
     VkMemoryPropertyFlags vkFlags = 0;
@@ -34,6 +34,7 @@
 
 #include "dawn/common/SerialQueue.h"
 #include "dawn/common/vulkan_platform.h"
+#include "dawn/native/DawnNative.h"
 #include "dawn/native/Error.h"
 #include "dawn/native/IntegerTypes.h"
 #include "dawn/native/PooledResourceMemoryAllocator.h"
@@ -73,6 +74,15 @@ class ResourceMemoryAllocator {
                                                      bool forceDisableSubAllocation = false);
     void Deallocate(ResourceMemoryAllocation* allocation);
 
+    // Sub-allocates memory for a TransientAttachment texture from heaps that only contain other
+    // transient attachments. Returns an invalid allocation if the memory should come from
+    // Allocate() instead. Memory released with DeallocateTransient() can be handed out again
+    // immediately, even if the GPU is still using it, so textures using it must make their first
+    // use of each subresource wait on all previous GPU work.
+    ResultOrError<ResourceMemoryAllocation> AllocateTransient(
+        const VkMemoryRequirements& requirements);
+    void DeallocateTransient(ResourceMemoryAllocation* allocation);
+
     void FreeRecycledMemory();
 
     // Returns the last serial that an object is pending deletion after or
@@ -89,6 +99,11 @@ class ResourceMemoryAllocator {
     // Reports the total lazy allocated and used vulkan memory.
     uint64_t GetTotalLazyAllocatedMemory() const;
     uint64_t GetTotalLazyUsedMemory() const;
+    // Reports the peak size of memory that transient attachments reused while the GPU may still
+    // have been using it for destroyed transient attachments.
+    uint64_t GetPeakAliasedTransientMemory() const;
+    // Fills the resources, buddyAllocators and heapPools members of `statistics`.
+    void GetStatistics(DeviceMemoryStatistics* statistics) const;
 
   protected:
     void RecordHeapAllocation(VkDeviceSize size, bool isLazyMemoryType);
@@ -96,37 +111,56 @@ class ResourceMemoryAllocator {
 
   private:
     // Wrapper for tracking the allocation sizes to be decremented up to a completed ExecutionSerial
-    // and reporting total allocation/used sizes.
+    // and reporting total allocation/used sizes and their peak.
     class AllocationSizeTracker {
       public:
         // Increment the total size for tracking.
         void Increment(VkDeviceSize incrementSize);
         // Track the size to be decremented on Tick.
         void Decrement(ExecutionSerial currentSerial, VkDeviceSize decrementSize);
+        // Decrement the total size right away, for memory that can be reused immediately.
+        void DecrementNow(VkDeviceSize decrementSize);
         // Update the total size after completed serials.
         void Tick(ExecutionSerial completedSerial);
 
         VkDeviceSize Size() const { return mTotalSize; }
+        VkDeviceSize PeakSize() const { return mPeakSize; }
 
       private:
         std::map<ExecutionSerial, VkDeviceSize> mMemoryToDecrement;
         VkDeviceSize mTotalSize = 0;
+        VkDeviceSize mPeakSize = 0;
     };
 
     VkMemoryPropertyFlags GetRequiredMemoryPropertyFlags(MemoryKind memoryKind) const;
 
+    // Records how much of a new transient allocation overlaps memory of destroyed transient
+    // attachments that the GPU may still be using.
+    void TrackTransientAliasing(const ResourceMemoryAllocation& allocation);
+
     raw_ptr<Device> mDevice;
     const VkDeviceSize mMaxSizeForSuballocation;
     bool mUseHostCachedForMappable = false;
 
     class SingleTypeAllocator;
     std::vector<std::unique_ptr<SingleTypeAllocator>> mAllocatorsPerType;
+    std::vector<std::unique_ptr<SingleTypeAllocator>> mTransientAllocatorsPerType;
 
     SerialQueue<ExecutionSerial, ResourceMemoryAllocation> mSubAllocationsToDelete;
     AllocationSizeTracker mAllocatedMemory;
     AllocationSizeTracker mUsedMemory;
     AllocationSizeTracker mLazyAllocatedMemory;
     AllocationSizeTracker mLazyUsedMemory;
+    // Memory of destroyed transient attachments, until the GPU is done using it.
+    struct ReleasedTransientRange {
+        VkDeviceMemory memory;
+        uint64_t offset;
+        uint64_t size;
+        ExecutionSerial serial;
+    };
+    SerialQueue<ExecutionSerial, ReleasedTransientRange> mReleasedTransientRanges;
+    AllocationSizeTracker mAliasedTransientMemory;
+    uint64_t mAllocationCount = 0;
 };
 
 }  // namespace dawn::native::vulkan
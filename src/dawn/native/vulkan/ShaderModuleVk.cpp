@@ -123,6 +123,7 @@ using SubstituteOverrideConfig = std::unordered_map<tint::OverrideId, double>;
     X(uint32_t, maxSubgroupSize)                                                     \
     X(std::string_view, entryPointName)                                              \
     X(bool, usesSubgroupMatrix)                                                      \
+    X(bool, disableConstantPropagation)                                              \
     X(tint::spirv::writer::Options, tintOptions)                                     \
     X(UnsafeUnserializedValue<dawn::platform::Platform*>, platform)
 
@@ -246,6 +247,8 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
     req.platform = UnsafeUnserializedValue(GetDevice()->GetPlatform());
     req.substituteOverrideConfig = BuildSubstituteOverridesTransformConfig(programmableStage);
     req.usesSubgroupMatrix = programmableStage.metadata->usesSubgroupMatrix;
+    req.disableConstantPropagation =
+        GetDevice()->IsToggleEnabled(Toggle::DisableIRConstantPropagation);
 
     req.tintOptions.remapped_entry_point_name = GetDevice()->GetIsolatedEntryPointName();
     req.tintOptions.strip_all_names = !GetDevice()->IsToggleEnabled(Toggle::DisableSymbolRenaming);
@@ -318,28 +321,12 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
 
             // Requires Tint Program here right before actual using.
             auto inputProgram = r.inputProgram.UnsafeGetValue()->GetTintProgram();
-            const tint::Program* tintInputProgram = &(inputProgram->program);
-            // Convert the AST program to an IR module.
+            // Get the lowered IR module reduced to the entry point, with its overrides not yet
+            // substituted. This is shared by the pipelines using the same entry point. Many Vulkan
+            // drivers can't handle multi-entrypoint shader modules.
             tint::Result<tint::core::ir::Module> ir;
-            {
-                SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
-                                                   "ShaderModuleProgramToIR");
-                ir = tint::wgsl::reader::ProgramToLoweredIR(*tintInputProgram);
-                DAWN_INVALID_IF(ir != tint::Success,
-                                "An error occurred while generating Tint IR\n%s",
-                                ir.Failure().reason);
-            }
-
-            {
-                SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
-                                                   "ShaderModuleSingleEntryPoint");
-                // Many Vulkan drivers can't handle multi-entrypoint shader modules.
-                auto singleEntryPointResult =
-                    tint::core::ir::transform::SingleEntryPoint(ir.Get(), r.entryPointName);
-                DAWN_INVALID_IF(singleEntryPointResult != tint::Success,
-                                "Pipeline single entry point (IR) failed:\n%s",
-                                singleEntryPointResult.Failure().reason);
-            }
+            DAWN_TRY_ASSIGN(ir, inputProgram->CreatePreOverrideIR(r.platform.UnsafeGetValue(),
+                                                                  r.entryPointName));
 
             {
                 SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
@@ -355,6 +342,18 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
                                 substituteOverridesResult.Failure().reason);
             }
 
+            if (!r.disableConstantPropagation) {
+                SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
+                                                   "ShaderModuleConstantPropagation");
+                // Fold the values that became constant when the overrides were substituted,
+                // removing the branches that this pipeline can never take.
+                auto constantPropagationResult =
+                    tint::core::ir::transform::ConstantPropagation(ir.Get());
+                DAWN_INVALID_IF(constantPropagationResult != tint::Success,
+                                "Pipeline constant propagation (IR) failed:\n%s",
+                                constantPropagationResult.Failure().reason);
+            }
+
             tint::Result<tint::spirv::writer::Output> tintResult;
             {
                 SCOPED_DAWN_HISTOGRAM_TIMER_MICROS(r.platform.UnsafeGetValue(),
@@ -366,6 +365,10 @@ ResultOrError<ShaderModule::ModuleAndSpirv> ShaderModule::GetHandleAndSpirv(
                                 tintResult.Failure().reason);
             }
 
+            // The writer lowers the module in place, so its arena is now at its peak size.
+            DAWN_HISTOGRAM_CUSTOM_COUNTS(r.platform.UnsafeGetValue(), "ShaderModuleIRArenaKB",
+                                         ir.Get().ArenaBytesReserved() / 1024, 1, 500'000, 50);
+
             // Workgroup validation has to come after `Generate` because it may require
             // overrides to have been substituted.
             if (r.stage == SingleShaderStage::Compute) {
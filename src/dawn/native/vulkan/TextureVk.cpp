@@ -948,6 +948,9 @@ void Texture::TransitionUsageForPassImpl(
         }
 
         imageBarriers->push_back(BuildMemoryBarrier(this, lastSyncInfo->usage, newUsage, range));
+        if (lastSyncInfo->usage == wgpu::TextureUsage::None && mAliasesTransientMemory) {
+            AddTransientAliasingDependency(&imageBarriers->back(), srcStages);
+        }
 
         allLastUsages |= lastSyncInfo->usage;
         allNewUsages |= newUsage;
@@ -1057,6 +1060,9 @@ void Texture::TransitionUsageAndGetResourceBarrierImpl(
             }
 
             imageBarriers->push_back(BuildMemoryBarrier(this, lastSyncInfo->usage, usage, range));
+            if (lastSyncInfo->usage == wgpu::TextureUsage::None && mAliasesTransientMemory) {
+                AddTransientAliasingDependency(&imageBarriers->back(), srcStages);
+            }
 
             allLastUsages |= lastSyncInfo->usage;
             allLastShaderStages |= lastSyncInfo->shaderStages;
@@ -1077,9 +1083,36 @@ void Texture::TransitionUsageAndGetResourceBarrierImpl(
     *dstStages |= VulkanPipelineStage(usage, shaderStages, format);
 }
 
+void Texture::AddTransientAliasingDependency(VkImageMemoryBarrier* barrier,
+                                             VkPipelineStageFlags* srcStages) {
+    // The memory of this texture may still be written by a transient attachment that was destroyed
+    // earlier, maybe in the same submit. Its first use must wait on all the previous GPU work
+    // instead of only TOP_OF_PIPE.
+    barrier->srcAccessMask |= VK_ACCESS_MEMORY_WRITE_BIT;
+    *srcStages |= VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+}
+
+wgpu::TextureUsage Texture::GetClearTextureUsage() const {
+    if ((GetInternalUsage() & wgpu::TextureUsage::RenderAttachment) && GetFormat().IsColor() &&
+        !GetFormat().IsMultiPlanar()) {
+        return wgpu::TextureUsage::RenderAttachment;
+    }
+    return wgpu::TextureUsage::CopyDst;
+}
+
 MaybeError Texture::ClearTexture(CommandRecordingContext* recordingContext,
                                  const SubresourceRange& range,
                                  TextureBase::ClearValue clearValue) {
+    if (range.aspects == Aspect::None) {
+        return {};
+    }
+    TransitionUsageNow(recordingContext, GetClearTextureUsage(), wgpu::ShaderStage::None, range);
+    return RecordClearTexture(recordingContext, range, clearValue);
+}
+
+MaybeError Texture::RecordClearTexture(CommandRecordingContext* recordingContext,
+                                       const SubresourceRange& range,
+                                       TextureBase::ClearValue clearValue) {
     Device* device = ToBackend(GetDevice());
 
     const bool isZero = clearValue == TextureBase::ClearValue::Zero;
@@ -1090,11 +1123,7 @@ MaybeError Texture::ClearTexture(CommandRecordingContext* recordingContext,
     imageRange.levelCount = 1;
     imageRange.layerCount = 1;
 
-    if ((GetInternalUsage() & wgpu::TextureUsage::RenderAttachment) && GetFormat().IsColor() &&
-        !GetFormat().IsMultiPlanar()) {
-        TransitionUsageNow(recordingContext, wgpu::TextureUsage::RenderAttachment,
-                           wgpu::ShaderStage::None, range);
-
+    if (GetClearTextureUsage() == wgpu::TextureUsage::RenderAttachment) {
         for (uint32_t level = range.baseMipLevel; level < range.baseMipLevel + range.levelCount;
              ++level) {
             for (uint32_t layer = range.baseArrayLayer;
@@ -1152,9 +1181,6 @@ MaybeError Texture::ClearTexture(CommandRecordingContext* recordingContext,
             }
         }
     } else if (GetFormat().HasDepthOrStencil()) {
-        TransitionUsageNow(recordingContext, wgpu::TextureUsage::CopyDst, wgpu::ShaderStage::None,
-                           range);
-
         for (uint32_t level = range.baseMipLevel; level < range.baseMipLevel + range.levelCount;
              ++level) {
             imageRange.baseMipLevel = level;
@@ -1192,9 +1218,6 @@ MaybeError Texture::ClearTexture(CommandRecordingContext* recordingContext,
             return {};
         }
 
-        TransitionUsageNow(recordingContext, wgpu::TextureUsage::CopyDst, wgpu::ShaderStage::None,
-                           range);
-
         // need to clear the texture with a copy from buffer
         DAWN_ASSERT(range.aspects == Aspect::Color || range.aspects == Aspect::Plane0 ||
                     range.aspects == Aspect::Plane1 || range.aspects == Aspect::Plane2);
@@ -1270,6 +1293,45 @@ MaybeError Texture::EnsureSubresourceContentInitialized(CommandRecordingContext*
     return {};
 }
 
+// static
+ResultOrError<uint32_t> Texture::EnsureSubresourceContentInitializedBatched(
+    CommandRecordingContext* recordingContext,
+    const std::vector<std::pair<Texture*, SubresourceRange>>& ranges) {
+    std::vector<std::pair<Texture*, SubresourceRange>> rangesToClear;
+    std::vector<VkImageMemoryBarrier> barriers;
+    VkPipelineStageFlags srcStages = 0;
+    VkPipelineStageFlags dstStages = 0;
+
+    for (const auto& [texture, range] : ranges) {
+        if (texture->IsSubresourceContentInitialized(range)) {
+            continue;
+        }
+        size_t transitionBarrierStart = barriers.size();
+        texture->TransitionUsageAndGetResourceBarrier(texture->GetClearTextureUsage(),
+                                                      wgpu::ShaderStage::None, range, &barriers,
+                                                      &srcStages, &dstStages);
+        texture->TweakTransition(recordingContext, &barriers, transitionBarrierStart);
+        rangesToClear.emplace_back(texture, range);
+    }
+
+    if (rangesToClear.empty()) {
+        return 0u;
+    }
+
+    Device* device = ToBackend(rangesToClear.front().first->GetDevice());
+    if (!barriers.empty()) {
+        DAWN_ASSERT(srcStages != 0 && dstStages != 0);
+        device->fn.CmdPipelineBarrier(recordingContext->commandBuffer, srcStages, dstStages, 0, 0,
+                                      nullptr, 0, nullptr, barriers.size(), barriers.data());
+    }
+
+    for (const auto& [texture, range] : rangesToClear) {
+        DAWN_TRY(
+            texture->RecordClearTexture(recordingContext, range, TextureBase::ClearValue::Zero));
+    }
+    return static_cast<uint32_t>(rangesToClear.size());
+}
+
 VkImageLayout Texture::GetCurrentLayout(Aspect aspect,
                                         uint32_t arrayLayer,
                                         uint32_t mipLevel) const {
@@ -1408,8 +1470,17 @@ MaybeError InternalTexture::Initialize(VkImageUsageFlags extraUsages) {
     auto memoryKind = (GetInternalUsage() & wgpu::TextureUsage::TransientAttachment)
                           ? MemoryKind::LazilyAllocated
                           : MemoryKind::DeviceLocal;
-    DAWN_TRY_ASSIGN(mMemoryAllocation, device->GetResourceMemoryAllocator()->Allocate(
-                                           requirements, memoryKind, forceDisableSubAllocation));
+    ResourceMemoryAllocator* allocator = device->GetResourceMemoryAllocator();
+    if (memoryKind == MemoryKind::LazilyAllocated && !forceDisableSubAllocation &&
+        device->IsToggleEnabled(Toggle::VulkanAliasTransientAttachmentMemory)) {
+        DAWN_TRY_ASSIGN(mMemoryAllocation, allocator->AllocateTransient(requirements));
+        mAliasesTransientMemory =
+            mMemoryAllocation.GetInfo().mMethod != AllocationMethod::kInvalid;
+    }
+    if (!mAliasesTransientMemory) {
+        DAWN_TRY_ASSIGN(mMemoryAllocation, allocator->Allocate(requirements, memoryKind,
+                                                               forceDisableSubAllocation));
+    }
 
     DAWN_TRY(CheckVkSuccess(
         device->fn.BindImageMemory(device->GetVkDevice(), mHandle,
@@ -1460,7 +1531,11 @@ void InternalTexture::DestroyImpl() {
     device->GetFencedDeleter()->DeleteWhenUnused(mHandle);
     mHandle = VK_NULL_HANDLE;
 
-    device->GetResourceMemoryAllocator()->Deallocate(&mMemoryAllocation);
+    if (mAliasesTransientMemory) {
+        device->GetResourceMemoryAllocator()->DeallocateTransient(&mMemoryAllocation);
+    } else {
+        device->GetResourceMemoryAllocator()->Deallocate(&mMemoryAllocation);
+    }
     mMemoryAllocation = ResourceMemoryAllocation();
 
     Texture::DestroyImpl();
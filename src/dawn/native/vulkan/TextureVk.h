@@ -29,6 +29,7 @@
 #define SRC_DAWN_NATIVE_VULKAN_TEXTUREVK_H_
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "dawn/common/vulkan_platform.h"
@@ -102,6 +103,15 @@ class Texture : public TextureBase {
     MaybeError EnsureSubresourceContentInitialized(CommandRecordingContext* recordingContext,
                                                    const SubresourceRange& range);
 
+    // Same as EnsureSubresourceContentInitialized for many ranges at once. The ranges of a
+    // texture must not overlap. All the transitions are recorded in a single barrier before the
+    // clears instead of one barrier per clear. The clears are recorded right away, so the ranges
+    // must not be initialized by commands recorded later in the same submit. Returns the number of
+    // ranges that were cleared.
+    static ResultOrError<uint32_t> EnsureSubresourceContentInitializedBatched(
+        CommandRecordingContext* recordingContext,
+        const std::vector<std::pair<Texture*, SubresourceRange>>& ranges);
+
     // Adds any special synchronization once for the current submit.
     virtual MaybeError OnBeforeSubmit(CommandRecordingContext* context);
     // Cleans up after the submit.
@@ -119,6 +129,12 @@ class Texture : public TextureBase {
     MaybeError ClearTexture(CommandRecordingContext* recordingContext,
                             const SubresourceRange& range,
                             TextureBase::ClearValue);
+    // Records the commands of ClearTexture, assuming that `range` was already transitioned to
+    // GetClearTextureUsage().
+    MaybeError RecordClearTexture(CommandRecordingContext* recordingContext,
+                                  const SubresourceRange& range,
+                                  TextureBase::ClearValue clearValue);
+    wgpu::TextureUsage GetClearTextureUsage() const;
 
     // Implementation details of the barrier computations for the texture.
     void TransitionUsageAndGetResourceBarrier(wgpu::TextureUsage usage,
@@ -139,6 +155,10 @@ class Texture : public TextureBase {
                                                   VkPipelineStageFlags* srcStages,
                                                   VkPipelineStageFlags* dstStages);
 
+    // Makes the first use of a subresource wait on previous users of the aliased memory.
+    void AddTransientAliasingDependency(VkImageMemoryBarrier* barrier,
+                                        VkPipelineStageFlags* srcStages);
+
     // TODO(42242084): Make this more robust and maybe predicated on a boolean as we're in hot code.
     virtual bool CanReuseWithoutBarrier(wgpu::TextureUsage lastUsage,
                                         wgpu::TextureUsage usage,
@@ -163,6 +183,8 @@ class Texture : public TextureBase {
 
     SubresourceStorage<TextureSyncInfo> mSubresourceLastSyncInfos;
     VkImage mHandle = VK_NULL_HANDLE;
+    // Whether the memory of the texture comes from ResourceMemoryAllocator::AllocateTransient.
+    bool mAliasesTransientMemory = false;
 };
 
 // A texture created and fully owned by Dawn. Typically the result of device.CreateTexture.
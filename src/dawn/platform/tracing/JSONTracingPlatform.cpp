@@ -0,0 +1,239 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/platform/tracing/JSONTracingPlatform.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+#include "dawn/common/Assert.h"
+#include "dawn/platform/tracing/TraceEvent.h"
+
+namespace dawn::platform::tracing {
+namespace {
+
+constexpr size_t kTraceCategoryCount = 4;
+
+// The pointers returned by GetTraceCategoryEnabledFlag are cached by the trace macros for the
+// lifetime of the process, so they must point to storage that outlives every platform.
+unsigned char gTraceCategoryEnabled[kTraceCategoryCount] = {1, 1, 1, 1};
+
+constexpr std::array<const char*, kTraceCategoryCount> kTraceCategoryNames = {
+    "General",
+    "Validation",
+    "Recording",
+    "GPUWork",
+};
+
+static_assert(static_cast<uint32_t>(TraceCategory::General) == 0);
+static_assert(static_cast<uint32_t>(TraceCategory::Validation) == 1);
+static_assert(static_cast<uint32_t>(TraceCategory::Recording) == 2);
+static_assert(static_cast<uint32_t>(TraceCategory::GPUWork) == 3);
+
+const char* GetCategoryName(const unsigned char* categoryGroupEnabled) {
+    ptrdiff_t index = categoryGroupEnabled - &gTraceCategoryEnabled[0];
+    if (index < 0 || index >= static_cast<ptrdiff_t>(kTraceCategoryCount)) {
+        return "Unknown";
+    }
+    return kTraceCategoryNames[index];
+}
+
+// Small sequential IDs make the thread tracks in the trace viewers easier to read than hashes of
+// std::thread::id.
+uint32_t GetCurrentThreadTraceId() {
+    static std::atomic<uint32_t> sNextThreadId = 1;
+    thread_local uint32_t threadId = sNextThreadId.fetch_add(1, std::memory_order_relaxed);
+    return threadId;
+}
+
+double NowInSeconds() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void WriteEscapedString(std::ostringstream* out, const char* str) {
+    *out << '"';
+    for (const char* c = str; c != nullptr && *c != '\0'; ++c) {
+        switch (*c) {
+            case '"':
+                *out << "\\\"";
+                break;
+            case '\\':
+                *out << "\\\\";
+                break;
+            case '\n':
+                *out << "\\n";
+                break;
+            case '\t':
+                *out << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20) {
+                    char escaped[8];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(*c));
+                    *out << escaped;
+                } else {
+                    *out << *c;
+                }
+                break;
+        }
+    }
+    *out << '"';
+}
+
+void WriteArgValue(std::ostringstream* out, unsigned char type, uint64_t value) {
+    switch (type) {
+        case TRACE_VALUE_TYPE_BOOL:
+            *out << (value != 0 ? "true" : "false");
+            break;
+        case TRACE_VALUE_TYPE_UINT:
+            *out << value;
+            break;
+        case TRACE_VALUE_TYPE_INT:
+            *out << static_cast<int64_t>(value);
+            break;
+        case TRACE_VALUE_TYPE_DOUBLE: {
+            double d;
+            static_assert(sizeof(d) == sizeof(value));
+            memcpy(&d, &value, sizeof(d));
+            // JSON has no representation of NaN and infinities.
+            if (std::isfinite(d)) {
+                *out << d;
+            } else {
+                *out << "null";
+            }
+            break;
+        }
+        case TRACE_VALUE_TYPE_POINTER: {
+            char pointer[24];
+            snprintf(pointer, sizeof(pointer), "\"0x%" PRIx64 "\"", value);
+            *out << pointer;
+            break;
+        }
+        case TRACE_VALUE_TYPE_STRING:
+        case TRACE_VALUE_TYPE_COPY_STRING:
+            WriteEscapedString(out, reinterpret_cast<const char*>(static_cast<uintptr_t>(value)));
+            break;
+        default:
+            *out << "null";
+            break;
+    }
+}
+
+}  // anonymous namespace
+
+JSONTracingPlatform::JSONTracingPlatform(const std::string& path)
+    : mOriginSeconds(NowInSeconds()), mFile(path, std::ios::out | std::ios::trunc) {
+    if (mFile.is_open()) {
+        mFile << "[";
+    }
+}
+
+JSONTracingPlatform::~JSONTracingPlatform() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mFile.is_open()) {
+        mFile << "\n]\n";
+        mFile.close();
+    }
+}
+
+bool JSONTracingPlatform::IsValid() const {
+    return mFile.is_open();
+}
+
+const unsigned char* JSONTracingPlatform::GetTraceCategoryEnabledFlag(TraceCategory category) {
+    DAWN_ASSERT(static_cast<size_t>(category) < kTraceCategoryCount);
+    return &gTraceCategoryEnabled[static_cast<size_t>(category)];
+}
+
+double JSONTracingPlatform::MonotonicallyIncreasingTime() {
+    // A timestamp of 0 makes the event dropped, so this must never return 0.
+    return NowInSeconds();
+}
+
+uint64_t JSONTracingPlatform::AddTraceEvent(char phase,
+                                            const unsigned char* categoryGroupEnabled,
+                                            const char* name,
+                                            uint64_t id,
+                                            double timestamp,
+                                            int numArgs,
+                                            const char** argNames,
+                                            const unsigned char* argTypes,
+                                            const uint64_t* argValues,
+                                            unsigned char flags) {
+    // Format the event outside of the lock. Names and string arguments are only guaranteed to
+    // live for the duration of this call, which formatting them right away takes care of.
+    std::ostringstream event;
+    event << "{\"name\":";
+    WriteEscapedString(&event, name);
+    event << ",\"cat\":\"" << GetCategoryName(categoryGroupEnabled) << "\",\"ph\":\"" << phase
+          << "\"";
+    if (phase == TRACE_EVENT_PHASE_INSTANT) {
+        event << ",\"s\":\"t\"";
+    }
+
+    char ts[32];
+    snprintf(ts, sizeof(ts), "%.3f", (timestamp - mOriginSeconds) * 1'000'000.0);
+    event << ",\"ts\":" << ts << ",\"pid\":1,\"tid\":" << GetCurrentThreadTraceId();
+
+    if (flags & TRACE_EVENT_FLAG_HAS_ID) {
+        char idString[24];
+        snprintf(idString, sizeof(idString), "\"0x%" PRIx64 "\"", id);
+        event << ",\"id\":" << idString;
+    }
+
+    if (numArgs > 0) {
+        event << ",\"args\":{";
+        for (int i = 0; i < numArgs; ++i) {
+            if (i > 0) {
+                event << ",";
+            }
+            WriteEscapedString(&event, argNames[i]);
+            event << ":";
+            WriteArgValue(&event, argTypes[i], argValues[i]);
+        }
+        event << "}";
+    }
+    event << "}";
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!mFile.is_open()) {
+        return 0;
+    }
+    mFile << (mHasWrittenEvent ? ",\n" : "\n") << event.str();
+    mHasWrittenEvent = true;
+    return 0;
+}
+
+}  // namespace dawn::platform::tracing
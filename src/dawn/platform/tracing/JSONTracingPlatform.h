@@ -0,0 +1,78 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_PLATFORM_TRACING_JSONTRACINGPLATFORM_H_
+#define SRC_DAWN_PLATFORM_TRACING_JSONTRACINGPLATFORM_H_
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+#include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/dawn_platform_export.h"
+
+namespace dawn::platform::tracing {
+
+// A Platform that enables every trace category and streams the trace events to a file in the
+// Chrome trace event JSON format, which can be loaded in chrome://tracing or ui.perfetto.dev.
+// It lets Dawn be profiled without an embedder that implements tracing. Events are written as
+// they are added using the JSON array format, which stays loadable even if the closing bracket
+// written when the platform is destroyed is missing.
+class DAWN_PLATFORM_EXPORT JSONTracingPlatform : public Platform {
+  public:
+    explicit JSONTracingPlatform(const std::string& path);
+    ~JSONTracingPlatform() override;
+
+    // Returns false if the trace file could not be opened, in which case no event is recorded.
+    bool IsValid() const;
+
+    const unsigned char* GetTraceCategoryEnabledFlag(TraceCategory category) override;
+    double MonotonicallyIncreasingTime() override;
+    uint64_t AddTraceEvent(char phase,
+                           const unsigned char* categoryGroupEnabled,
+                           const char* name,
+                           uint64_t id,
+                           double timestamp,
+                           int numArgs,
+                           const char** argNames,
+                           const unsigned char* argTypes,
+                           const uint64_t* argValues,
+                           unsigned char flags) override;
+
+  private:
+    // Timestamps are reported relative to the creation of the platform, in microseconds.
+    const double mOriginSeconds;
+
+    std::mutex mMutex;
+    std::ofstream mFile;
+    bool mHasWrittenEvent = false;
+};
+
+}  // namespace dawn::platform::tracing
+
+#endif  // SRC_DAWN_PLATFORM_TRACING_JSONTRACINGPLATFORM_H_
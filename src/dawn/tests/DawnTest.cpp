@@ -1122,6 +1122,10 @@ bool DawnTestBase::GetRequireUseTieredLimits() {
     return false;
 }
 
+const wgpu::ChainedStruct* DawnTestBase::GetRequiredDeviceDescriptorChain() {
+    return nullptr;
+}
+
 const TestAdapterProperties& DawnTestBase::GetAdapterProperties() const {
     return mParam.adapterProperties;
 }
@@ -1202,6 +1206,7 @@ WGPUDevice DawnTestBase::CreateDeviceImpl(std::string isolationKey,
     // inherited to all adapters' toggles set.
     ParamTogglesHelper deviceTogglesHelper(mParam, native::ToggleStage::Device);
     cacheDesc.nextInChain = &deviceTogglesHelper.togglesDesc;
+    deviceTogglesHelper.togglesDesc.nextInChain = GetRequiredDeviceDescriptorChain();
 
     WGPUDevice createdDevice;
     uint32_t deviceCreationDeprecatedWarningExpectation =
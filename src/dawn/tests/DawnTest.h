@@ -682,6 +682,10 @@ class DawnTestBase {
     // adapter.
     virtual bool GetRequireUseTieredLimits();
 
+    // Called when creating a device to get extension structs to chain on its descriptor, e.g. to
+    // configure the device's allocators. The chain must stay alive as long as the test.
+    virtual const wgpu::ChainedStruct* GetRequiredDeviceDescriptorChain();
+
     const TestAdapterProperties& GetAdapterProperties() const;
 
     const dawn::utils::ComboLimits& GetAdapterLimits();
@@ -0,0 +1,119 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "dawn/native/SubresourceStorage.h"
+
+namespace dawn::native {
+namespace {
+
+// Stands in for the per-subresource state of the texture usage tracking.
+struct TrackedUsage {
+    uint32_t usage = 0;
+    uint32_t shaderStages = 0;
+
+    bool operator==(const TrackedUsage& other) const = default;
+};
+
+// The number of textures a pass uses.
+constexpr uint32_t kTextureCount = 64;
+
+// The benchmark arguments are the array layer count, the mip level count and whether the textures
+// are depth-stencil.
+uint32_t GetArrayLayerCount(const benchmark::State& state) {
+    return static_cast<uint32_t>(state.range(0));
+}
+uint32_t GetMipLevelCount(const benchmark::State& state) {
+    return static_cast<uint32_t>(state.range(1));
+}
+Aspect GetAspects(const benchmark::State& state) {
+    return state.range(2) ? Aspect::Depth | Aspect::Stencil : Aspect::Color;
+}
+
+std::vector<SubresourceStorage<TrackedUsage>> CreateStorages(const benchmark::State& state) {
+    std::vector<SubresourceStorage<TrackedUsage>> storages;
+    storages.reserve(kTextureCount);
+    for (uint32_t i = 0; i < kTextureCount; ++i) {
+        storages.emplace_back(GetAspects(state), GetArrayLayerCount(state),
+                              GetMipLevelCount(state));
+    }
+    return storages;
+}
+
+// Records a usage of each whole texture, like a pass using each of its textures once.
+void BM_SubresourceStorageUpdate(benchmark::State& state) {
+    std::vector<SubresourceStorage<TrackedUsage>> storages = CreateStorages(state);
+    SubresourceRange range = SubresourceRange::MakeFull(
+        GetAspects(state), GetArrayLayerCount(state), GetMipLevelCount(state));
+
+    uint32_t usageBit = 0;
+    for (auto _ : state) {
+        usageBit = (usageBit + 1) % 8;
+        for (SubresourceStorage<TrackedUsage>& storage : storages) {
+            storage.Update(range, [&](const SubresourceRange&, TrackedUsage* data) {
+                data->usage |= 1u << usageBit;
+            });
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kTextureCount);
+}
+
+// Merges the usages of each texture, like a pass merging the usages of a render bundle.
+void BM_SubresourceStorageMerge(benchmark::State& state) {
+    std::vector<SubresourceStorage<TrackedUsage>> storages = CreateStorages(state);
+    std::vector<SubresourceStorage<TrackedUsage>> others = CreateStorages(state);
+
+    uint32_t usageBit = 0;
+    for (auto _ : state) {
+        usageBit = (usageBit + 1) % 8;
+        for (uint32_t i = 0; i < kTextureCount; ++i) {
+            storages[i].Merge(others[i], [&](const SubresourceRange&, TrackedUsage* data,
+                                             const TrackedUsage& otherData) {
+                data->usage |= otherData.usage | (1u << usageBit);
+            });
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kTextureCount);
+}
+
+void SubresourceStorageArgs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"layers", "mips", "depthStencil"});
+    b->Args({1, 1, 0});
+    b->Args({1, 1, 1});
+    b->Args({6, 1, 0});
+    b->Args({1, 4, 0});
+}
+
+BENCHMARK(BM_SubresourceStorageUpdate)->Apply(SubresourceStorageArgs);
+BENCHMARK(BM_SubresourceStorageMerge)->Apply(SubresourceStorageArgs);
+
+}  // anonymous namespace
+}  // namespace dawn::native
@@ -26,8 +26,10 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <limits>
+#include <vector>
 
 #include "dawn/tests/DawnTest.h"
+#include "dawn/utils/WGPUHelpers.h"
 
 namespace dawn {
 namespace {
@@ -88,5 +90,174 @@ TEST_P(AllocatorMemoryInstrumentationTest, GetAllocatorMemoryInfoVulkan) {
 
 DAWN_INSTANTIATE_TEST(AllocatorMemoryInstrumentationTest, VulkanBackend());
 
+class TransientAttachmentAliasingTest : public AllocatorMemoryInstrumentationTest {
+  protected:
+    static constexpr uint32_t kSize = 64;
+
+    void SetUp() override {
+        AllocatorMemoryInstrumentationTest::SetUp();
+        DAWN_TEST_UNSUPPORTED_IF(!SupportsFeatures({wgpu::FeatureName::TransientAttachments}));
+    }
+
+    std::vector<wgpu::FeatureName> GetRequiredFeatures() override {
+        if (SupportsFeatures({wgpu::FeatureName::TransientAttachments})) {
+            return {wgpu::FeatureName::TransientAttachments};
+        }
+        return {};
+    }
+
+    wgpu::Texture CreateTransientAttachment() {
+        wgpu::TextureDescriptor descriptor;
+        descriptor.size = {kSize, kSize};
+        descriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+        descriptor.sampleCount = 4;
+        descriptor.usage =
+            wgpu::TextureUsage::RenderAttachment | wgpu::TextureUsage::TransientAttachment;
+        return device.CreateTexture(&descriptor);
+    }
+
+    wgpu::Texture CreateResolveTexture() {
+        wgpu::TextureDescriptor descriptor;
+        descriptor.size = {kSize, kSize};
+        descriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+        descriptor.usage = wgpu::TextureUsage::RenderAttachment | wgpu::TextureUsage::CopySrc;
+        return device.CreateTexture(&descriptor);
+    }
+
+    // Clears `transient` to `color` and resolves it into `resolveTarget` in its own submit.
+    void SubmitClearAndResolve(const wgpu::Texture& transient,
+                               const wgpu::Texture& resolveTarget,
+                               const wgpu::Color& color) {
+        utils::ComboRenderPassDescriptor renderPass({transient.CreateView()});
+        renderPass.cColorAttachments[0].resolveTarget = resolveTarget.CreateView();
+        renderPass.cColorAttachments[0].loadOp = wgpu::LoadOp::Clear;
+        renderPass.cColorAttachments[0].storeOp = wgpu::StoreOp::Discard;
+        renderPass.cColorAttachments[0].clearValue = color;
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        encoder.BeginRenderPass(&renderPass).End();
+        wgpu::CommandBuffer commands = encoder.Finish();
+        queue.Submit(1, &commands);
+    }
+};
+
+// Test that transient attachments created and destroyed one after the other alias the same memory
+// without waiting for the GPU, and that each of them still renders correctly.
+TEST_P(TransientAttachmentAliasingTest, SequentialTransientAttachments) {
+    constexpr uint32_t kFrameCount = 4;
+    constexpr wgpu::Color kColors[kFrameCount] = {
+        {1.0, 0.0, 0.0, 1.0}, {0.0, 1.0, 0.0, 1.0}, {0.0, 0.0, 1.0, 1.0}, {1.0, 1.0, 1.0, 1.0}};
+    const utils::RGBA8 kExpected[kFrameCount] = {utils::RGBA8::kRed, utils::RGBA8::kGreen,
+                                                 utils::RGBA8::kBlue, utils::RGBA8::kWhite};
+
+    std::vector<wgpu::Texture> resolveTextures;
+    for (uint32_t i = 0; i < kFrameCount; ++i) {
+        wgpu::Texture transient = CreateTransientAttachment();
+        resolveTextures.push_back(CreateResolveTexture());
+        SubmitClearAndResolve(transient, resolveTextures.back(), kColors[i]);
+
+        // The next transient attachment can reuse the memory while this submit is in flight.
+        transient.Destroy();
+    }
+
+    for (uint32_t i = 0; i < kFrameCount; ++i) {
+        EXPECT_TEXTURE_EQ(kExpected[i], resolveTextures[i], {0, 0});
+        EXPECT_TEXTURE_EQ(kExpected[i], resolveTextures[i], {kSize - 1, kSize - 1});
+    }
+
+    // Lazily allocated memory isn't aliased since it is only committed when needed.
+    native::AllocatorMemoryInfo memInfo = native::GetAllocatorMemoryInfo(device.Get());
+    if (memInfo.totalLazyAllocatedMemory == 0) {
+        EXPECT_GT(memInfo.peakAliasedTransientMemory, 0u);
+    }
+}
+
+// Test that a transient attachment created after another one is destroyed gets the memory of the
+// destroyed one, even though the submit using that memory may still be executing.
+TEST_P(TransientAttachmentAliasingTest, ReusesMemoryOfDestroyedAttachment) {
+    wgpu::Texture firstResolve = CreateResolveTexture();
+    wgpu::Texture secondResolve = CreateResolveTexture();
+    WaitForAllOperations();
+
+    native::AllocatorMemoryInfo before = native::GetAllocatorMemoryInfo(device.Get());
+    wgpu::Texture first = CreateTransientAttachment();
+    native::AllocatorMemoryInfo withFirst = native::GetAllocatorMemoryInfo(device.Get());
+    // Lazily allocated memory isn't aliased since it is only committed when needed.
+    DAWN_TEST_UNSUPPORTED_IF(withFirst.totalLazyAllocatedMemory > 0);
+    uint64_t attachmentSize = withFirst.totalUsedMemory - before.totalUsedMemory;
+    ASSERT_GT(attachmentSize, 0u);
+    EXPECT_EQ(withFirst.peakAliasedTransientMemory, 0u);
+
+    SubmitClearAndResolve(first, firstResolve, {1.0, 0.0, 0.0, 1.0});
+    first.Destroy();
+
+    // The memory of `first` is only known to be unused after the next submit completes, so all of
+    // `second` aliasing it means that it got exactly the same memory.
+    wgpu::Texture second = CreateTransientAttachment();
+    native::AllocatorMemoryInfo withSecond = native::GetAllocatorMemoryInfo(device.Get());
+    EXPECT_EQ(withSecond.peakAliasedTransientMemory, attachmentSize);
+    EXPECT_EQ(withSecond.totalUsedMemory - before.totalUsedMemory, attachmentSize);
+    EXPECT_LT(withSecond.totalUsedMemory - before.totalUsedMemory, 2 * attachmentSize);
+
+    SubmitClearAndResolve(second, secondResolve, {0.0, 1.0, 0.0, 1.0});
+    second.Destroy();
+
+    EXPECT_TEXTURE_EQ(utils::RGBA8::kRed, firstResolve, {0, 0});
+    EXPECT_TEXTURE_EQ(utils::RGBA8::kRed, firstResolve, {kSize - 1, kSize - 1});
+    EXPECT_TEXTURE_EQ(utils::RGBA8::kGreen, secondResolve, {0, 0});
+    EXPECT_TEXTURE_EQ(utils::RGBA8::kGreen, secondResolve, {kSize - 1, kSize - 1});
+}
+
+DAWN_INSTANTIATE_TEST(TransientAttachmentAliasingTest,
+                      VulkanBackend({"vulkan_alias_transient_attachment_memory"}));
+
+class DeviceMemoryStatisticsTest : public AllocatorMemoryInstrumentationTest {};
+
+// Test the statistics reported by GetDeviceMemoryStatistics() for a texture and its upload.
+TEST_P(DeviceMemoryStatisticsTest, TextureUpload) {
+    constexpr uint32_t kSize = 16;
+    constexpr uint32_t kBytesPerRow = kSize * 4;
+
+    wgpu::TextureDescriptor desc;
+    desc.size = {kSize, kSize};
+    desc.format = wgpu::TextureFormat::RGBA8Unorm;
+    desc.usage = wgpu::TextureUsage::CopyDst | wgpu::TextureUsage::CopySrc;
+    wgpu::Texture texture = device.CreateTexture(&desc);
+
+    native::DeviceMemoryStatistics statistics = native::GetDeviceMemoryStatistics(device.Get());
+    if (IsVulkan()) {
+        EXPECT_GT(statistics.resources.usedSize, 0u);
+        EXPECT_GT(statistics.resources.allocationCount, 0u);
+        EXPECT_GE(statistics.resources.peakUsedSize, statistics.resources.usedSize);
+        EXPECT_GE(statistics.resources.reservedSize, statistics.resources.usedSize);
+        EXPECT_GE(statistics.heapPools.reservedSize, statistics.heapPools.usedSize);
+    } else {
+        EXPECT_EQ(statistics.resources.usedSize, 0u);
+        EXPECT_EQ(statistics.buddyAllocators.usedSize, 0u);
+        EXPECT_EQ(statistics.heapPools.usedSize, 0u);
+    }
+
+    // The upload goes through the staging ring buffers.
+    std::vector<utils::RGBA8> data(kSize * kSize, utils::RGBA8::kGreen);
+    wgpu::TexelCopyTextureInfo dst = utils::CreateTexelCopyTextureInfo(texture);
+    wgpu::TexelCopyBufferLayout layout = utils::CreateTexelCopyBufferLayout(0, kBytesPerRow);
+    wgpu::Extent3D copySize = {kSize, kSize};
+    queue.WriteTexture(&dst, data.data(), data.size() * sizeof(utils::RGBA8), &layout, &copySize);
+
+    statistics = native::GetDeviceMemoryStatistics(device.Get());
+    EXPECT_GE(statistics.staging.usedSize, kBytesPerRow * kSize);
+    EXPECT_GT(statistics.staging.allocationCount, 0u);
+    EXPECT_GE(statistics.staging.reservedSize, statistics.staging.usedSize);
+    EXPECT_GE(statistics.staging.peakUsedSize, statistics.staging.usedSize);
+    EXPECT_GE(statistics.staging.fragmentation, 0.0);
+    EXPECT_LE(statistics.staging.fragmentation, 1.0);
+
+    // The peak is kept once the upload has completed.
+    WaitForAllOperations();
+    statistics = native::GetDeviceMemoryStatistics(device.Get());
+    EXPECT_GE(statistics.staging.peakUsedSize, kBytesPerRow * kSize);
+}
+
+DAWN_INSTANTIATE_TEST(DeviceMemoryStatisticsTest, NullBackend(), VulkanBackend());
+
 }  // anonymous namespace
 }  // namespace dawn
@@ -715,7 +715,11 @@ DAWN_INSTANTIATE_TEST(DrawIndexedIndirectTest,
                       MetalBackend(),
                       OpenGLBackend(),
                       OpenGLESBackend(),
-                      VulkanBackend());
+                      VulkanBackend(),
+                      VulkanBackend({"vulkan_record_render_bundles_in_secondary_command_buffers"}),
+                      D3D12Backend({"batch_indirect_draw_validation_per_submit"}),
+                      MetalBackend({"batch_indirect_draw_validation_per_submit"}),
+                      VulkanBackend({"batch_indirect_draw_validation_per_submit"}));
 
 }  // anonymous namespace
 }  // namespace dawn
@@ -140,7 +140,10 @@ DAWN_INSTANTIATE_TEST(DrawIndirectTest,
                       MetalBackend(),
                       OpenGLBackend(),
                       OpenGLESBackend(),
-                      VulkanBackend());
+                      VulkanBackend(),
+                      D3D12Backend({"batch_indirect_draw_validation_per_submit"}),
+                      MetalBackend({"batch_indirect_draw_validation_per_submit"}),
+                      VulkanBackend({"batch_indirect_draw_validation_per_submit"}));
 
 class DrawIndirectUsingFirstVertexTest : public DawnTest {
   protected:
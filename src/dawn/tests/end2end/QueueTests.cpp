@@ -25,6 +25,8 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "dawn/common/Math.h"
@@ -269,16 +271,187 @@ TEST_P(QueueWriteBufferTests, WriteUniformBufferWithVariousOffsetAndSizeAlignmen
     EXPECT_BUFFER_U32_RANGE_EQ(data, buffer, 0, kElementCount);
 }
 
+// Test that WriteBuffers to adjacent ranges of a buffer are merged into a single copy when
+// coalesce_write_buffers is enabled, and that overlapping writes keep their order.
+TEST_P(QueueWriteBufferTests, CoalescedAdjacentWrites) {
+    DAWN_TEST_UNSUPPORTED_IF(UsesWire());
+    DAWN_TEST_UNSUPPORTED_IF(!HasToggleEnabled("coalesce_write_buffers"));
+
+    constexpr uint32_t kElements = 64;
+    wgpu::BufferDescriptor descriptor;
+    descriptor.size = kElements * sizeof(uint32_t);
+    descriptor.usage = wgpu::BufferUsage::CopySrc | wgpu::BufferUsage::CopyDst;
+    wgpu::Buffer buffer = device.CreateBuffer(&descriptor);
+
+    std::vector<uint32_t> expectedData(kElements);
+    size_t copiesBefore = native::GetStagingBufferCopyCountForTesting(device.Get());
+    size_t stagedBytesBefore = native::GetStagedByteCountForTesting(device.Get());
+    for (uint32_t i = 0; i < kElements; ++i) {
+        expectedData[i] = i;
+        queue.WriteBuffer(buffer, i * sizeof(uint32_t), &i, sizeof(i));
+    }
+    queue.Submit(0, nullptr);
+    size_t copies = native::GetStagingBufferCopyCountForTesting(device.Get()) - copiesBefore;
+    size_t stagedBytes = native::GetStagedByteCountForTesting(device.Get()) - stagedBytesBefore;
+    if (stagedBytes == 0) {
+        // The buffer is host visible and idle, so the backend wrote it directly without staging.
+        EXPECT_EQ(copies, 0u);
+    } else {
+        EXPECT_EQ(stagedBytes, kElements * sizeof(uint32_t));
+        EXPECT_EQ(copies, 1u);
+    }
+    EXPECT_BUFFER_U32_RANGE_EQ(expectedData.data(), buffer, 0, kElements);
+
+    // Overwriting a range that was just written isn't merged but must still land last.
+    uint32_t first[4] = {100, 101, 102, 103};
+    uint32_t second[2] = {200, 201};
+    uint32_t third[2] = {300, 301};
+    queue.WriteBuffer(buffer, 0, first, sizeof(first));
+    queue.WriteBuffer(buffer, sizeof(uint32_t), second, sizeof(second));
+    queue.WriteBuffer(buffer, 3 * sizeof(uint32_t), third, sizeof(third));
+    expectedData[0] = 100;
+    expectedData[1] = 200;
+    expectedData[2] = 201;
+    expectedData[3] = 300;
+    expectedData[4] = 301;
+    EXPECT_BUFFER_U32_RANGE_EQ(expectedData.data(), buffer, 0, kElements);
+}
+
 DAWN_INSTANTIATE_TEST(QueueWriteBufferTests,
                       D3D11Backend(),
                       D3D11Backend({"d3d11_delay_flush_to_gpu"}),
                       D3D12Backend(),
+                      D3D12Backend({"coalesce_write_buffers"}),
                       MetalBackend(),
+                      MetalBackend({"coalesce_write_buffers"}),
                       OpenGLBackend(),
                       OpenGLESBackend(),
                       VulkanBackend(),
+                      VulkanBackend({"coalesce_write_buffers"}),
                       WebGPUBackend());
 
+// Tests of uploads that need more staging memory than DawnDeviceAllocatorControl allows.
+class QueueStagingMemoryBudgetTests : public DawnTest {
+  protected:
+    static constexpr uint32_t kStagingRingBufferSize = 64 * 1024;
+    static constexpr uint32_t kStagingMemoryBudget = 2 * kStagingRingBufferSize;
+
+    std::vector<wgpu::FeatureName> GetRequiredFeatures() override {
+        mSupportsAllocatorControl =
+            SupportsFeatures({wgpu::FeatureName::DawnDeviceAllocatorControl});
+        if (!mSupportsAllocatorControl) {
+            return {};
+        }
+        return {wgpu::FeatureName::DawnDeviceAllocatorControl};
+    }
+
+    const wgpu::ChainedStruct* GetRequiredDeviceDescriptorChain() override {
+        if (!mSupportsAllocatorControl) {
+            return nullptr;
+        }
+        mAllocatorControl.stagingRingBufferSize = kStagingRingBufferSize;
+        mAllocatorControl.stagingMemoryBudget = kStagingMemoryBudget;
+        return &mAllocatorControl;
+    }
+
+    void SetUp() override {
+        DawnTest::SetUp();
+        DAWN_TEST_UNSUPPORTED_IF(UsesWire());
+        DAWN_TEST_UNSUPPORTED_IF(!mSupportsAllocatorControl);
+    }
+
+    // Writes |rowCount| rows of a kWidth wide RGBA8 texture per WriteTexture, so that each write
+    // takes |rowCount| * kBytesPerRow bytes of staging memory, and returns the texture data.
+    std::vector<utils::RGBA8> WriteTextureInChunks(wgpu::Texture texture,
+                                                   uint32_t height,
+                                                   uint32_t rowCount) {
+        std::vector<utils::RGBA8> data(kWidth * height);
+        for (uint32_t i = 0; i < data.size(); ++i) {
+            data[i] = utils::RGBA8(static_cast<uint8_t>(i % 251),
+                                   static_cast<uint8_t>((i / kWidth) % 251),
+                                   static_cast<uint8_t>(i % 7), 255);
+        }
+
+        wgpu::TexelCopyBufferLayout layout = {};
+        layout.bytesPerRow = kBytesPerRow;
+        for (uint32_t y = 0; y < height; y += rowCount) {
+            wgpu::TexelCopyTextureInfo destination =
+                utils::CreateTexelCopyTextureInfo(texture, 0, {0, y, 0});
+            wgpu::Extent3D size = {kWidth, std::min(rowCount, height - y), 1};
+            queue.WriteTexture(&destination, &data[y * kWidth],
+                               size.height * kBytesPerRow, &layout, &size);
+        }
+        return data;
+    }
+
+    wgpu::Texture CreateTexture(uint32_t height) {
+        wgpu::TextureDescriptor descriptor;
+        descriptor.size = {kWidth, height, 1};
+        descriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+        descriptor.usage = wgpu::TextureUsage::CopyDst | wgpu::TextureUsage::CopySrc;
+        return device.CreateTexture(&descriptor);
+    }
+
+    static constexpr uint32_t kWidth = 256;
+    static constexpr uint32_t kBytesPerRow = kWidth * sizeof(utils::RGBA8);
+
+    bool mSupportsAllocatorControl = false;
+    wgpu::DawnDeviceAllocatorControl mAllocatorControl = {};
+};
+
+// Test that uploads exceeding the staging memory budget between two submits wait for earlier
+// uploads instead of growing the ring buffers past the budget, and still upload the right data.
+TEST_P(QueueStagingMemoryBudgetTests, UploadsExceedingBudgetWait) {
+    // The texture takes 4 times the budget, written a quarter of a ring buffer at a time.
+    constexpr uint32_t kHeight = 4 * kStagingMemoryBudget / kBytesPerRow;
+    constexpr uint32_t kRowsPerWrite = kStagingRingBufferSize / 4 / kBytesPerRow;
+
+    wgpu::Texture texture = CreateTexture(kHeight);
+    size_t waitsBefore = native::GetStagingBudgetWaitCountForTesting(device.Get());
+    std::vector<utils::RGBA8> data = WriteTextureInChunks(texture, kHeight, kRowsPerWrite);
+    queue.Submit(0, nullptr);
+
+    EXPECT_GT(native::GetStagingBudgetWaitCountForTesting(device.Get()), waitsBefore);
+    EXPECT_LE(native::GetDeviceMemoryStatistics(device.Get()).staging.peakReservedSize,
+              kStagingMemoryBudget);
+    EXPECT_TEXTURE_EQ(data.data(), texture, {0, 0}, {kWidth, kHeight});
+}
+
+// Test that uploads larger than a staging ring buffer, mixed with ones that fit in it, upload the
+// right data and don't count against the staging memory budget.
+TEST_P(QueueStagingMemoryBudgetTests, UploadsLargerThanRingBuffer) {
+    // Each pair of writes takes one row and then one and a half ring buffers.
+    constexpr uint32_t kLargeRowCount = 3 * kStagingRingBufferSize / 2 / kBytesPerRow;
+    constexpr uint32_t kHeight = 4 * (kLargeRowCount + 1);
+
+    wgpu::Texture texture = CreateTexture(kHeight);
+    std::vector<utils::RGBA8> data(kWidth * kHeight);
+    for (uint32_t i = 0; i < data.size(); ++i) {
+        data[i] = utils::RGBA8(static_cast<uint8_t>(i % 13),
+                               static_cast<uint8_t>((i / kWidth) % 251),
+                               static_cast<uint8_t>(i % 251), 255);
+    }
+
+    wgpu::TexelCopyBufferLayout layout = {};
+    layout.bytesPerRow = kBytesPerRow;
+    for (uint32_t y = 0; y < kHeight; y += kLargeRowCount + 1) {
+        for (auto [rowOffset, rowCount] : {std::pair{0u, 1u}, std::pair{1u, kLargeRowCount}}) {
+            wgpu::TexelCopyTextureInfo destination =
+                utils::CreateTexelCopyTextureInfo(texture, 0, {0, y + rowOffset, 0});
+            wgpu::Extent3D size = {kWidth, rowCount, 1};
+            queue.WriteTexture(&destination, &data[(y + rowOffset) * kWidth],
+                               rowCount * kBytesPerRow, &layout, &size);
+        }
+    }
+    queue.Submit(0, nullptr);
+
+    EXPECT_LE(native::GetDeviceMemoryStatistics(device.Get()).staging.peakReservedSize,
+              kStagingMemoryBudget);
+    EXPECT_TEXTURE_EQ(data.data(), texture, {0, 0}, {kWidth, kHeight});
+}
+
+DAWN_INSTANTIATE_TEST(QueueStagingMemoryBudgetTests, VulkanBackend());
+
 // For MinimumDataSpec bytesPerRow and rowsPerImage, compute a default from the copy extent.
 constexpr uint32_t kStrideComputeDefault = 0xFFFF'FFFEul;
 
@@ -209,13 +209,75 @@ TEST_P(RenderBundleTest, BundleAndRenderPassCommands) {
     EXPECT_PIXEL_RGBA8_EQ(kColors[1], renderPass.color, 3, 1);
 }
 
+// Test executing the same bundle in several render passes with different load operations and
+// render targets of different sizes, in the same and in separate submits.
+TEST_P(RenderBundleTest, BundleReusedInSeveralPasses) {
+    utils::ComboRenderBundleEncoderDescriptor desc = {};
+    desc.colorFormatCount = 1;
+    desc.cColorFormats[0] = renderPass.colorFormat;
+
+    wgpu::RenderBundleEncoder renderBundleEncoder = device.CreateRenderBundleEncoder(&desc);
+
+    renderBundleEncoder.SetPipeline(pipeline);
+    renderBundleEncoder.SetVertexBuffer(0, vertexBuffer);
+    renderBundleEncoder.SetBindGroup(0, bindGroups[0]);
+    renderBundleEncoder.Draw(3);
+
+    wgpu::RenderBundle renderBundle = renderBundleEncoder.Finish();
+
+    utils::BasicRenderPass largeRenderPass =
+        utils::CreateBasicRenderPass(device, 2 * kRTSize, 2 * kRTSize);
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    {
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+        pass.ExecuteBundles(1, &renderBundle);
+        pass.End();
+    }
+    {
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&largeRenderPass.renderPassInfo);
+        pass.ExecuteBundles(1, &renderBundle);
+        pass.End();
+    }
+    wgpu::CommandBuffer commands = encoder.Finish();
+    queue.Submit(1, &commands);
+
+    EXPECT_PIXEL_RGBA8_EQ(kColors[0], renderPass.color, 1, 3);
+    EXPECT_PIXEL_RGBA8_EQ(utils::RGBA8::kZero, renderPass.color, 3, 1);
+    EXPECT_PIXEL_RGBA8_EQ(kColors[0], largeRenderPass.color, 2, 6);
+    EXPECT_PIXEL_RGBA8_EQ(utils::RGBA8::kZero, largeRenderPass.color, 6, 2);
+
+    // Draw the top right triangle of the first render target on top of its contents.
+    encoder = device.CreateCommandEncoder();
+    {
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+        pass.SetPipeline(pipeline);
+        pass.SetVertexBuffer(0, vertexBuffer);
+        pass.SetBindGroup(0, bindGroups[1]);
+        pass.Draw(3, 1, 3);
+        pass.End();
+    }
+    {
+        renderPass.renderPassInfo.cColorAttachments[0].loadOp = wgpu::LoadOp::Load;
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass.renderPassInfo);
+        pass.ExecuteBundles(1, &renderBundle);
+        pass.End();
+    }
+    commands = encoder.Finish();
+    queue.Submit(1, &commands);
+
+    EXPECT_PIXEL_RGBA8_EQ(kColors[0], renderPass.color, 1, 3);
+    EXPECT_PIXEL_RGBA8_EQ(kColors[1], renderPass.color, 3, 1);
+}
+
 DAWN_INSTANTIATE_TEST(RenderBundleTest,
                       D3D11Backend(),
                       D3D12Backend(),
                       MetalBackend(),
                       OpenGLBackend(),
                       OpenGLESBackend(),
-                      VulkanBackend());
+                      VulkanBackend(),
+                      VulkanBackend({"vulkan_record_render_bundles_in_secondary_command_buffers"}));
 
 }  // anonymous namespace
 }  // namespace dawn
@@ -1064,6 +1064,66 @@ TEST_P(TextureZeroInitTest, RenderPassSampledTextureClear) {
     EXPECT_EQ(true, native::IsTextureSubresourceInitialized(renderTexture.Get(), 0, 1, 0, 1));
 }
 
+// This tests that a texture initialized by a copy in a command buffer is not cleared when it is
+// sampled by a later command buffer of the same submit.
+TEST_P(TextureZeroInitTest, CopyThenSampleInSameSubmitIsNotCleared) {
+    // Create needed resources
+    wgpu::TextureDescriptor descriptor = CreateTextureDescriptor(
+        1, 1, wgpu::TextureUsage::CopyDst | wgpu::TextureUsage::TextureBinding, kColorFormat);
+    wgpu::Texture texture = device.CreateTexture(&descriptor);
+
+    wgpu::TextureDescriptor renderTextureDescriptor = CreateTextureDescriptor(
+        1, 1, wgpu::TextureUsage::CopySrc | wgpu::TextureUsage::RenderAttachment, kColorFormat);
+    wgpu::Texture renderTexture = device.CreateTexture(&renderTextureDescriptor);
+
+    std::vector<uint8_t> data(kFormatBlockByteSize * kSize * kSize, 100);
+    wgpu::Buffer stagingBuffer = utils::CreateBufferFromData(
+        device, data.data(), static_cast<uint32_t>(data.size()), wgpu::BufferUsage::CopySrc);
+
+    // Create render pipeline
+    utils::ComboRenderPipelineDescriptor renderPipelineDescriptor;
+    renderPipelineDescriptor.cTargets[0].format = kColorFormat;
+    renderPipelineDescriptor.vertex.module = CreateBasicVertexShaderForTest();
+    renderPipelineDescriptor.cFragment.module = CreateSampledTextureFragmentShaderForTest();
+    wgpu::RenderPipeline renderPipeline = device.CreateRenderPipeline(&renderPipelineDescriptor);
+
+    // Create bindgroup
+    wgpu::BindGroup bindGroup = utils::MakeBindGroup(device, renderPipeline.GetBindGroupLayout(0),
+                                                     {{0, texture.CreateView()}});
+
+    // Encode the copy and the pass in separate command buffers and submit them together
+    wgpu::CommandBuffer commands[2];
+    {
+        wgpu::TexelCopyBufferInfo texelCopyBufferInfo =
+            utils::CreateTexelCopyBufferInfo(stagingBuffer, 0, kSize * sizeof(uint32_t));
+        wgpu::TexelCopyTextureInfo texelCopyTextureInfo =
+            utils::CreateTexelCopyTextureInfo(texture, 0, {0, 0, 0});
+        wgpu::Extent3D copySize = {kSize, kSize, 1};
+
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        encoder.CopyBufferToTexture(&texelCopyBufferInfo, &texelCopyTextureInfo, &copySize);
+        commands[0] = encoder.Finish();
+    }
+    {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        utils::ComboRenderPassDescriptor renderPassDesc({renderTexture.CreateView()});
+        renderPassDesc.cColorAttachments[0].clearValue = {1.0, 1.0, 1.0, 1.0};
+        renderPassDesc.cColorAttachments[0].loadOp = wgpu::LoadOp::Clear;
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPassDesc);
+        pass.SetPipeline(renderPipeline);
+        pass.SetBindGroup(0, bindGroup);
+        pass.Draw(6);
+        pass.End();
+        commands[1] = encoder.Finish();
+    }
+    // Expect 0 lazy clears since the copy fully initializes the sampled texture
+    EXPECT_LAZY_CLEAR(0u, queue.Submit(2, commands));
+
+    // Expect the rendered texture to contain the copied data
+    std::vector<utils::RGBA8> expected(kSize * kSize, {100, 100, 100, 100});
+    EXPECT_TEXTURE_EQ(expected.data(), renderTexture, {0, 0}, {kSize, kSize});
+}
+
 // This is a regression test for a bug where a texture wouldn't get clear for a pass if at least
 // one of its subresources was used as an attachment. It tests that if a texture is used as both
 // sampled and attachment (with LoadOp::Clear so the lazy clear can be skipped) then the sampled
@@ -1905,7 +1965,9 @@ DAWN_INSTANTIATE_TEST(
     MetalBackend({"nonzero_clear_resources_on_creation_for_testing",
                   "use_blit_for_buffer_to_depth_texture_copy",
                   "use_blit_for_buffer_to_stencil_texture_copy"}),
-    VulkanBackend({"nonzero_clear_resources_on_creation_for_testing"}));
+    VulkanBackend({"nonzero_clear_resources_on_creation_for_testing"}),
+    VulkanBackend({"nonzero_clear_resources_on_creation_for_testing",
+                   "vulkan_batch_lazy_clears_per_submit"}));
 
 class CompressedTextureZeroInitTest : public TextureZeroInitTest {
   protected:
@@ -37,6 +37,8 @@ constexpr unsigned int kNumIterations = 50;
 
 enum class UploadMethod {
     WriteBuffer,
+    // WriteBuffer to a uniform buffer, which is allocated in host-visible memory on UMA devices.
+    WriteBufferToUniform,
     MappedAtCreation,
     MapWithExtendedUsages,
     StagingBuffer,
@@ -70,6 +72,9 @@ std::ostream& operator<<(std::ostream& ostream, const BufferUploadParams& param)
         case UploadMethod::WriteBuffer:
             ostream << "_WriteBuffer";
             break;
+        case UploadMethod::WriteBufferToUniform:
+            ostream << "_WriteBufferToUniform";
+            break;
         case UploadMethod::MappedAtCreation:
             ostream << "_MappedAtCreation";
             break;
@@ -125,13 +130,17 @@ void BufferUploadPerf::SetUp() {
     wgpu::BufferDescriptor desc = {};
     desc.size = data.size();
     desc.usage = wgpu::BufferUsage::CopyDst;
+    if (GetParam().uploadMethod == UploadMethod::WriteBufferToUniform) {
+        desc.usage |= wgpu::BufferUsage::Uniform;
+    }
 
     dst = device.CreateBuffer(&desc);
 }
 
 void BufferUploadPerf::Step() {
     switch (GetParam().uploadMethod) {
-        case UploadMethod::WriteBuffer: {
+        case UploadMethod::WriteBuffer:
+        case UploadMethod::WriteBufferToUniform: {
             for (unsigned int i = 0; i < kNumIterations; ++i) {
                 queue.WriteBuffer(dst, 0, data.data(), data.size());
             }
@@ -238,7 +247,8 @@ void BufferMapExtendedUsagesPerf::SetUp() {
 
 void BufferMapExtendedUsagesPerf::Step() {
     switch (GetParam().uploadMethod) {
-        case UploadMethod::WriteBuffer: {
+        case UploadMethod::WriteBuffer:
+        case UploadMethod::WriteBufferToUniform: {
             for (unsigned int i = 0; i < kNumIterations; ++i) {
                 queue.WriteBuffer(buffers[i], 0, data.data(), data.size());
             }
@@ -312,7 +322,8 @@ TEST_P(BufferMapExtendedUsagesPerf, Run) {
 
 DAWN_INSTANTIATE_TEST_P(BufferUploadPerf,
                         {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend()},
-                        {UploadMethod::WriteBuffer, UploadMethod::MappedAtCreation},
+                        {UploadMethod::WriteBuffer, UploadMethod::WriteBufferToUniform,
+                         UploadMethod::MappedAtCreation},
                         {UploadSize::BufferSize_1KB, UploadSize::BufferSize_64KB,
                          UploadSize::BufferSize_1MB, UploadSize::BufferSize_4MB,
                          UploadSize::BufferSize_16MB});
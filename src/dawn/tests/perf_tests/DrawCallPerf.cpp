@@ -25,6 +25,7 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -33,6 +34,7 @@
 #include "dawn/common/Math.h"
 #include "dawn/tests/perf_tests/DawnPerfTest.h"
 #include "dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "dawn/utils/Timer.h"
 #include "dawn/utils/WGPUHelpers.h"
 
 namespace dawn {
@@ -224,17 +226,23 @@ std::ostream& operator<<(std::ostream& ostream, const DrawCallParamForTest& test
 //     the efficiency of resource transitions.
 class DrawCallPerf : public DawnPerfTestWithParams<DrawCallParamForTest> {
   public:
-    DrawCallPerf() : DawnPerfTestWithParams(kNumDraws, 3) {}
+    DrawCallPerf() : DrawCallPerf(kNumDraws) {}
     ~DrawCallPerf() override = default;
 
     void SetUp() override;
 
   protected:
+    explicit DrawCallPerf(unsigned int iterationsPerStep)
+        : DawnPerfTestWithParams(iterationsPerStep, 3) {}
+
     DrawCallParam GetParam() const { return DawnPerfTestWithParams::GetParam().param; }
 
     template <typename Encoder>
     void RecordRenderCommands(Encoder encoder);
 
+    // Encodes the render pass with all the draws of a step in `commands`.
+    void EncodeRenderPass(const wgpu::CommandEncoder& commands);
+
   private:
     void Step() override;
 
@@ -581,6 +589,12 @@ void DrawCallPerf::Step() {
     }
 
     wgpu::CommandEncoder commands = device.CreateCommandEncoder();
+    EncodeRenderPass(commands);
+    wgpu::CommandBuffer commandBuffer = commands.Finish();
+    queue.Submit(1, &commandBuffer);
+}
+
+void DrawCallPerf::EncodeRenderPass(const wgpu::CommandEncoder& commands) {
     utils::ComboRenderPassDescriptor renderPass({mColorAttachment}, mDepthStencilAttachment);
     wgpu::RenderPassEncoder pass = commands.BeginRenderPass(&renderPass);
 
@@ -597,8 +611,6 @@ void DrawCallPerf::Step() {
     }
 
     pass.End();
-    wgpu::CommandBuffer commandBuffer = commands.Finish();
-    queue.Submit(1, &commandBuffer);
 }
 
 TEST_P(DrawCallPerf, Run) {
@@ -661,5 +673,73 @@ DAWN_INSTANTIATE_TEST_P(
                   UniformData::Dynamic),  // Update per-draw data: Dynamic bind groups
     });
 
+// DrawCallBundleReplayPerf replays a render bundle of kNumDraws draws once per step and reports
+// the time per replay instead of per draw. It compares re-encoding the bundle's commands on every
+// execution with replaying a pre-recorded Vulkan secondary command buffer.
+class DrawCallBundleReplayPerf : public DrawCallPerf {
+  public:
+    DrawCallBundleReplayPerf() : DrawCallPerf(1) {}
+};
+
+TEST_P(DrawCallBundleReplayPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(
+    DrawCallBundleReplayPerf,
+    {VulkanBackend(), VulkanBackend({"vulkan_record_render_bundles_in_secondary_command_buffers"})},
+    {
+        MakeParam(RenderBundle::Yes),
+        MakeParam(BindGroup::Multiple, RenderBundle::Yes),
+        MakeParam(Pipeline::Dynamic, BindGroup::Dynamic, RenderBundle::Yes),
+    });
+
+// DrawCallEncodePerf measures the CPU time spent encoding the render pass separately from the
+// rest of the step and reports it per draw. With the static parameterizations it shows the cost
+// of validating long runs of draws without state changes in between.
+class DrawCallEncodePerf : public DrawCallPerf {
+  public:
+    DrawCallEncodePerf() : mEncodeTimer(utils::CreateTimer()) {}
+
+    void TearDown() override {
+        if (mNumEncodedDraws > 0) {
+            PrintResult("encode_time_per_draw", mEncodeTimeSeconds * 1e9 / mNumEncodedDraws, "ns",
+                        true);
+        }
+        DrawCallPerf::TearDown();
+    }
+
+  private:
+    void Step() override {
+        wgpu::CommandEncoder commands = device.CreateCommandEncoder();
+
+        mEncodeTimer->Start();
+        EncodeRenderPass(commands);
+        mEncodeTimer->Stop();
+        mEncodeTimeSeconds += mEncodeTimer->GetElapsedTime();
+        mNumEncodedDraws += kNumDraws;
+
+        wgpu::CommandBuffer commandBuffer = commands.Finish();
+        queue.Submit(1, &commandBuffer);
+    }
+
+    std::unique_ptr<utils::Timer> mEncodeTimer;
+    double mEncodeTimeSeconds = 0;
+    uint64_t mNumEncodedDraws = 0;
+};
+
+TEST_P(DrawCallEncodePerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST_P(DrawCallEncodePerf,
+                        {D3D12Backend(), MetalBackend(), OpenGLBackend(), VulkanBackend()},
+                        {
+                            MakeParam(),
+                            MakeParam(Pipeline::Redundant, BindGroup::Redundant),
+                            MakeParam(VertexBuffer::Multiple),
+                            MakeParam(BindGroup::Multiple),
+                        });
+
 }  // anonymous namespace
 }  // namespace dawn
@@ -0,0 +1,155 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <vector>
+
+#include "dawn/native/DawnNative.h"
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/ComboRenderPipelineDescriptor.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn {
+namespace {
+
+constexpr uint32_t kNumPasses = 100;
+constexpr uint32_t kDrawsPerPass = 100;
+constexpr uint32_t kNumDraws = kNumPasses * kDrawsPerPass;
+
+constexpr uint32_t kTextureSize = 64;
+
+// Test the CPU cost of validating indirect draws, and the number of compute dispatches that
+// are encoded to do it. Each step submits a single command buffer with 10k indirect draws spread
+// across 100 render passes. By default the draws are validated at the end of each render pass,
+// whereas batch_indirect_draw_validation_per_submit validates all of them at Queue::Submit.
+class IndirectDrawValidationPerf : public DawnPerfTestWithParams<> {
+  public:
+    IndirectDrawValidationPerf() : DawnPerfTestWithParams(kNumDraws, 3) {}
+    ~IndirectDrawValidationPerf() override = default;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    void Step() override;
+
+    wgpu::Buffer mIndirectBuffer;
+    wgpu::RenderPipeline mPipeline;
+    wgpu::TextureView mColorAttachment;
+
+    // The number of validation dispatches encoded by the last step. It can only be queried
+    // when the device is not accessed through the wire.
+    size_t mValidationDispatchesPerStep = 0;
+    bool mHasValidationDispatchCount = false;
+};
+
+void IndirectDrawValidationPerf::SetUp() {
+    DawnPerfTestWithParams<>::SetUp();
+
+    // Every draw reads its own indirect parameters.
+    std::vector<uint32_t> indirectData;
+    indirectData.reserve(kNumDraws * 4);
+    for (uint32_t i = 0; i < kNumDraws; ++i) {
+        // vertexCount, instanceCount, firstVertex, firstInstance
+        indirectData.insert(indirectData.end(), {3, 1, 0, 0});
+    }
+    mIndirectBuffer = utils::CreateBufferFromData(
+        device, indirectData.data(), indirectData.size() * sizeof(uint32_t),
+        wgpu::BufferUsage::Indirect);
+
+    wgpu::TextureDescriptor descriptor;
+    descriptor.size = {kTextureSize, kTextureSize};
+    descriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+    descriptor.usage = wgpu::TextureUsage::RenderAttachment;
+    mColorAttachment = device.CreateTexture(&descriptor).CreateView();
+
+    utils::ComboRenderPipelineDescriptor pipelineDesc;
+    pipelineDesc.vertex.module = utils::CreateShaderModule(device, R"(
+        @vertex fn main(@builtin(vertex_index) vertexIndex : u32) -> @builtin(position) vec4f {
+            var pos = array(vec2f(-1.0, -1.0), vec2f(3.0, -1.0), vec2f(-1.0, 3.0));
+            return vec4f(pos[vertexIndex], 0.0, 1.0);
+        })");
+    pipelineDesc.cFragment.module = utils::CreateShaderModule(device, R"(
+        @fragment fn main() -> @location(0) vec4f {
+            return vec4f(0.0, 1.0, 0.0, 1.0);
+        })");
+    pipelineDesc.cTargets[0].format = wgpu::TextureFormat::RGBA8Unorm;
+    mPipeline = device.CreateRenderPipeline(&pipelineDesc);
+}
+
+void IndirectDrawValidationPerf::TearDown() {
+    if (mHasValidationDispatchCount) {
+        PrintResult("validation_dispatches_per_step",
+                    static_cast<unsigned int>(mValidationDispatchesPerStep), "count", true);
+    }
+    DawnPerfTestWithParams<>::TearDown();
+}
+
+void IndirectDrawValidationPerf::Step() {
+    size_t dispatchesBefore = 0;
+    if (!UsesWire()) {
+        dispatchesBefore = native::GetIndirectDrawValidationDispatchCountForTesting(device.Get());
+    }
+
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    for (uint32_t pass = 0; pass < kNumPasses; ++pass) {
+        utils::ComboRenderPassDescriptor renderPass({mColorAttachment});
+        renderPass.cColorAttachments[0].loadOp =
+            pass == 0 ? wgpu::LoadOp::Clear : wgpu::LoadOp::Load;
+
+        wgpu::RenderPassEncoder passEncoder = encoder.BeginRenderPass(&renderPass);
+        passEncoder.SetPipeline(mPipeline);
+        for (uint32_t draw = 0; draw < kDrawsPerPass; ++draw) {
+            uint64_t indirectOffset = (pass * kDrawsPerPass + draw) * 4 * sizeof(uint32_t);
+            passEncoder.DrawIndirect(mIndirectBuffer, indirectOffset);
+        }
+        passEncoder.End();
+    }
+    wgpu::CommandBuffer commands = encoder.Finish();
+    queue.Submit(1, &commands);
+
+    if (!UsesWire()) {
+        mValidationDispatchesPerStep =
+            native::GetIndirectDrawValidationDispatchCountForTesting(device.Get()) -
+            dispatchesBefore;
+        mHasValidationDispatchCount = true;
+    }
+}
+
+TEST_P(IndirectDrawValidationPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST(IndirectDrawValidationPerf,
+                      D3D12Backend(),
+                      D3D12Backend({"batch_indirect_draw_validation_per_submit"}),
+                      MetalBackend(),
+                      MetalBackend({"batch_indirect_draw_validation_per_submit"}),
+                      VulkanBackend(),
+                      VulkanBackend({"batch_indirect_draw_validation_per_submit"}));
+
+}  // anonymous namespace
+}  // namespace dawn
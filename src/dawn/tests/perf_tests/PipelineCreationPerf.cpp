@@ -0,0 +1,105 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <string>
+
+#include "dawn/tests/perf_tests/DawnPerfTest.h"
+#include "dawn/utils/WGPUHelpers.h"
+
+namespace dawn {
+namespace {
+
+constexpr unsigned int kNumIterations = 50;
+
+// Test the CPU cost of creating many compute pipelines from the same shader module, which is what
+// applications with pipeline variants keyed by override constants do. Each pipeline uses a new
+// override value so that it is actually compiled instead of being found in the pipeline cache.
+class PipelineCreationPerf : public DawnPerfTest {
+  public:
+    PipelineCreationPerf() : DawnPerfTest(kNumIterations, 1) {}
+    ~PipelineCreationPerf() override = default;
+
+    void SetUp() override {
+        DawnPerfTest::SetUp();
+
+        mModule = utils::CreateShaderModule(device, R"(
+            override scale : f32 = 1.0;
+
+            struct Data {
+                values : array<vec4f, 64>,
+            }
+            @group(0) @binding(0) var<storage, read_write> data : Data;
+
+            fn transform(v : vec4f, i : u32) -> vec4f {
+                var result = v;
+                for (var j = 0u; j < 4u; j++) {
+                    result = result * scale + vec4f(f32(i + j));
+                }
+                return result;
+            }
+
+            @compute @workgroup_size(64) fn main(@builtin(local_invocation_index) i : u32) {
+                data.values[i] = transform(data.values[i], i);
+            }
+
+            @compute @workgroup_size(64) fn other(@builtin(local_invocation_index) i : u32) {
+                data.values[i] = transform(data.values[63u - i], i);
+            }
+        )");
+    }
+
+  private:
+    void Step() override {
+        for (unsigned int i = 0; i < kNumIterations; ++i) {
+            wgpu::ConstantEntry constant;
+            constant.key = "scale";
+            constant.value = static_cast<double>(mNextOverrideValue++);
+
+            wgpu::ComputePipelineDescriptor descriptor;
+            descriptor.compute.module = mModule;
+            descriptor.compute.constantCount = 1;
+            descriptor.compute.constants = &constant;
+            device.CreateComputePipeline(&descriptor);
+        }
+    }
+
+    wgpu::ShaderModule mModule;
+    uint64_t mNextOverrideValue = 0;
+};
+
+TEST_P(PipelineCreationPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST(PipelineCreationPerf,
+                      D3D12Backend(),
+                      MetalBackend(),
+                      OpenGLBackend(),
+                      VulkanBackend());
+
+}  // anonymous namespace
+}  // namespace dawn
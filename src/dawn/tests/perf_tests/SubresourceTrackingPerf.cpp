@@ -25,6 +25,8 @@
 // OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <array>
+
 #include "dawn/tests/perf_tests/DawnPerfTest.h"
 
 #include "dawn/utils/ComboRenderPipelineDescriptor.h"
@@ -164,5 +166,88 @@ DAWN_INSTANTIATE_TEST_P(SubresourceTrackingPerf,
                         {1, 4, 16, 256},
                         {2, 3, 8});
 
+// Test the performance of Subresource usage tracking on the most common case: textures with a
+// single array layer and mip level that are sampled by a render pass using many bind groups.
+class SingleSubresourceTrackingPerf : public DawnPerfTest {
+  public:
+    static constexpr unsigned int kNumIterations = 50;
+    static constexpr uint32_t kNumDraws = 100;
+
+    SingleSubresourceTrackingPerf() : DawnPerfTest(kNumIterations, 1) {}
+    ~SingleSubresourceTrackingPerf() override = default;
+
+    void SetUp() override {
+        DawnPerfTest::SetUp();
+
+        utils::ComboRenderPipelineDescriptor pipelineDesc;
+        pipelineDesc.vertex.module = utils::CreateShaderModule(device, R"(
+            @vertex fn main() -> @builtin(position) vec4f {
+                return vec4f(1.0, 0.0, 0.0, 1.0);
+            }
+        )");
+        pipelineDesc.cFragment.module = utils::CreateShaderModule(device, R"(
+            @group(0) @binding(0) var t0 : texture_2d<f32>;
+            @group(0) @binding(1) var t1 : texture_2d<f32>;
+            @group(0) @binding(2) var t2 : texture_2d<f32>;
+            @group(0) @binding(3) var t3 : texture_2d<f32>;
+            @fragment fn main() -> @location(0) vec4f {
+                _ = t0;
+                _ = t1;
+                _ = t2;
+                _ = t3;
+                return vec4f(1.0, 0.0, 0.0, 1.0);
+            }
+        )");
+        mPipeline = device.CreateRenderPipeline(&pipelineDesc);
+
+        wgpu::TextureDescriptor desc;
+        desc.size = {16, 16};
+        desc.usage = wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::RenderAttachment;
+        desc.format = wgpu::TextureFormat::RGBA8Unorm;
+        mRenderTarget = device.CreateTexture(&desc);
+
+        // Use two bind groups with different textures so that every SetBindGroup in the pass
+        // needs to be tracked.
+        for (wgpu::BindGroup& bindGroup : mBindGroups) {
+            bindGroup = utils::MakeBindGroup(device, mPipeline.GetBindGroupLayout(0),
+                                             {{0, device.CreateTexture(&desc).CreateView()},
+                                              {1, device.CreateTexture(&desc).CreateView()},
+                                              {2, device.CreateTexture(&desc).CreateView()},
+                                              {3, device.CreateTexture(&desc).CreateView()}});
+        }
+    }
+
+  private:
+    void Step() override {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+
+        utils::ComboRenderPassDescriptor renderPass({mRenderTarget.CreateView()});
+        wgpu::RenderPassEncoder pass = encoder.BeginRenderPass(&renderPass);
+        pass.SetPipeline(mPipeline);
+        for (uint32_t i = 0; i < kNumDraws; i++) {
+            pass.SetBindGroup(0, mBindGroups[i % mBindGroups.size()]);
+            pass.Draw(3);
+        }
+        pass.End();
+
+        wgpu::CommandBuffer commands = encoder.Finish();
+        queue.Submit(1, &commands);
+    }
+
+    wgpu::Texture mRenderTarget;
+    std::array<wgpu::BindGroup, 2> mBindGroups;
+    wgpu::RenderPipeline mPipeline;
+};
+
+TEST_P(SingleSubresourceTrackingPerf, Run) {
+    RunTest();
+}
+
+DAWN_INSTANTIATE_TEST(SingleSubresourceTrackingPerf,
+                      D3D12Backend(),
+                      MetalBackend(),
+                      OpenGLBackend(),
+                      VulkanBackend());
+
 }  // anonymous namespace
 }  // namespace dawn
@@ -67,6 +67,8 @@ class PlaceholderBuddyResourceAllocator {
         return mAllocator.ComputeTotalNumOfHeapsForTesting();
     }
 
+    MemoryAllocatorStatistics GetStatistics() const { return mAllocator.GetStatistics(); }
+
   private:
     PlaceholderResourceHeapAllocator mHeapAllocator;
     BuddyMemoryAllocator mAllocator;
@@ -468,4 +470,62 @@ TEST(BuddyMemoryAllocatorTests, DestroyHeaps) {
     ASSERT_EQ(poolAllocator.GetPoolSizeForTesting(), 0u);
 }
 
+// Verify the statistics of the buddy allocator and of the pool of heaps it allocates from.
+TEST(BuddyMemoryAllocatorTests, Statistics) {
+    constexpr uint64_t kHeapSize = 128;
+    constexpr uint64_t kMaxBlockSize = 4096;
+
+    PlaceholderResourceHeapAllocator heapAllocator;
+    PooledResourceMemoryAllocator poolAllocator(&heapAllocator);
+    PlaceholderBuddyResourceAllocator allocator(kMaxBlockSize, kHeapSize, &poolAllocator);
+
+    // Both allocations are rounded up to 64 bytes and fill the first heap.
+    ResourceMemoryAllocation allocation1 = allocator.Allocate(48);
+    ResourceMemoryAllocation allocation2 = allocator.Allocate(48);
+    ASSERT_EQ(allocation1.GetResourceHeap(), allocation2.GetResourceHeap());
+
+    MemoryAllocatorStatistics statistics = allocator.GetStatistics();
+    EXPECT_EQ(statistics.usedSize, 96u);
+    EXPECT_EQ(statistics.reservedSize, kHeapSize);
+    EXPECT_EQ(statistics.allocationCount, 2u);
+    EXPECT_EQ(statistics.fragmentation, 0.25);
+
+    MemoryAllocatorStatistics poolStatistics = poolAllocator.GetStatistics();
+    EXPECT_EQ(poolStatistics.usedSize, kHeapSize);
+    EXPECT_EQ(poolStatistics.reservedSize, kHeapSize);
+    EXPECT_EQ(poolStatistics.allocationCount, 1u);
+
+    // The third allocation needs a second heap.
+    ResourceMemoryAllocation allocation3 = allocator.Allocate(64);
+    ASSERT_NE(allocation3.GetResourceHeap(), allocation1.GetResourceHeap());
+
+    statistics = allocator.GetStatistics();
+    EXPECT_EQ(statistics.usedSize, 160u);
+    EXPECT_EQ(statistics.reservedSize, 2 * kHeapSize);
+    EXPECT_EQ(statistics.allocationCount, 3u);
+
+    allocator.Deallocate(allocation1);
+    allocator.Deallocate(allocation2);
+    allocator.Deallocate(allocation3);
+
+    // The heaps are back in the pool and the peaks are kept.
+    statistics = allocator.GetStatistics();
+    EXPECT_EQ(statistics.usedSize, 0u);
+    EXPECT_EQ(statistics.peakUsedSize, 160u);
+    EXPECT_EQ(statistics.reservedSize, 0u);
+    EXPECT_EQ(statistics.peakReservedSize, 2 * kHeapSize);
+    EXPECT_EQ(statistics.allocationCount, 0u);
+
+    poolStatistics = poolAllocator.GetStatistics();
+    EXPECT_EQ(poolStatistics.usedSize, 0u);
+    EXPECT_EQ(poolStatistics.reservedSize, 2 * kHeapSize);
+    EXPECT_EQ(poolStatistics.allocationCount, 0u);
+    EXPECT_EQ(poolStatistics.fragmentation, 1.0);
+
+    poolAllocator.FreeRecycledAllocations();
+    poolStatistics = poolAllocator.GetStatistics();
+    EXPECT_EQ(poolStatistics.reservedSize, 0u);
+    EXPECT_EQ(poolStatistics.peakReservedSize, 2 * kHeapSize);
+}
+
 }  // namespace dawn::native
@@ -0,0 +1,98 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "dawn/platform/tracing/JSONTracingPlatform.h"
+#include "dawn/platform/tracing/TraceEvent.h"
+#include "gmock/gmock-matchers.h"
+#include "gtest/gtest.h"
+
+namespace dawn {
+namespace {
+
+using ::testing::EndsWith;
+using ::testing::HasSubstr;
+using ::testing::StartsWith;
+
+std::string ReadFile(const std::string& path) {
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+// Test that the trace events are written as a JSON array that is completed when the platform is
+// destroyed.
+TEST(JSONTracingPlatformTests, WritesEvents) {
+    std::string path = ::testing::TempDir() + "JSONTracingPlatformTests_WritesEvents.json";
+    {
+        platform::tracing::JSONTracingPlatform tracingPlatform(path);
+        ASSERT_TRUE(tracingPlatform.IsValid());
+        platform::Platform* platform = &tracingPlatform;
+
+        { TRACE_EVENT0(platform, Recording, "ScopedEvent"); }
+        TRACE_COUNTER1(platform, General, "Counter", 42);
+        TRACE_EVENT_INSTANT1(platform, GPUWork, "InstantEvent", "durationUs", 1.5);
+    }
+
+    std::string trace = ReadFile(path);
+    EXPECT_THAT(trace, StartsWith("["));
+    EXPECT_THAT(trace, EndsWith("]\n"));
+    EXPECT_THAT(trace, HasSubstr(R"({"name":"ScopedEvent","cat":"Recording","ph":"B")"));
+    EXPECT_THAT(trace, HasSubstr(R"({"name":"ScopedEvent","cat":"Recording","ph":"E")"));
+    EXPECT_THAT(trace, HasSubstr(R"("name":"Counter","cat":"General","ph":"C")"));
+    EXPECT_THAT(trace, HasSubstr(R"("args":{"value":42})"));
+    EXPECT_THAT(trace, HasSubstr(R"("name":"InstantEvent","cat":"GPUWork","ph":"I")"));
+    EXPECT_THAT(trace, HasSubstr(R"("args":{"durationUs":1.5})"));
+}
+
+// Test that string arguments are escaped.
+TEST(JSONTracingPlatformTests, EscapesStrings) {
+    std::string path = ::testing::TempDir() + "JSONTracingPlatformTests_EscapesStrings.json";
+    {
+        platform::tracing::JSONTracingPlatform tracingPlatform(path);
+        ASSERT_TRUE(tracingPlatform.IsValid());
+        platform::Platform* platform = &tracingPlatform;
+
+        TRACE_EVENT_INSTANT1(platform, General, "Label", "label", "a \"quoted\"\\label\n");
+    }
+
+    EXPECT_THAT(ReadFile(path), HasSubstr(R"("args":{"label":"a \"quoted\"\\label\n"})"));
+}
+
+// Test that a platform that could not open its file is invalid.
+TEST(JSONTracingPlatformTests, InvalidPath) {
+    platform::tracing::JSONTracingPlatform tracingPlatform(::testing::TempDir() +
+                                                           "nonexistent/directory/trace.json");
+    EXPECT_FALSE(tracingPlatform.IsValid());
+}
+
+}  // anonymous namespace
+}  // namespace dawn
@@ -187,4 +187,39 @@ TEST(RingBufferAllocatorTests, RingBufferOverflow) {
               RingBufferAllocator::kInvalidOffset);
 }
 
+// Tests that the statistics of the ringbuffer follow its sub-allocations.
+TEST(RingBufferAllocatorTests, Statistics) {
+    constexpr uint64_t sizeInBytes = 64;
+    RingBufferAllocator allocator(sizeInBytes);
+
+    MemoryAllocatorStatistics statistics = allocator.GetStatistics();
+    EXPECT_EQ(statistics.usedSize, 0u);
+    EXPECT_EQ(statistics.reservedSize, sizeInBytes);
+    EXPECT_EQ(statistics.allocationCount, 0u);
+    EXPECT_EQ(statistics.fragmentation, 1.0);
+
+    ASSERT_EQ(allocator.Allocate(16, ExecutionSerial(1)), 0u);
+    ASSERT_EQ(allocator.Allocate(16, ExecutionSerial(2)), 16u);
+
+    statistics = allocator.GetStatistics();
+    EXPECT_EQ(statistics.usedSize, 32u);
+    EXPECT_EQ(statistics.peakUsedSize, 32u);
+    EXPECT_EQ(statistics.allocationCount, 2u);
+    EXPECT_EQ(statistics.fragmentation, 0.5);
+
+    // Reclaim the first sub-allocation.
+    allocator.Deallocate(ExecutionSerial(1));
+    statistics = allocator.GetStatistics();
+    EXPECT_EQ(statistics.usedSize, 16u);
+    EXPECT_EQ(statistics.peakUsedSize, 32u);
+    EXPECT_EQ(statistics.allocationCount, 1u);
+
+    // Reclaim the second sub-allocation, the peak is unchanged.
+    allocator.Deallocate(ExecutionSerial(2));
+    statistics = allocator.GetStatistics();
+    EXPECT_EQ(statistics.usedSize, 0u);
+    EXPECT_EQ(statistics.peakUsedSize, 32u);
+    EXPECT_EQ(statistics.allocationCount, 0u);
+}
+
 }  // namespace dawn::native
@@ -748,6 +748,48 @@ TEST(SubresourceStorageTest, FillAfterModificationRecompresses) {
     CheckAspectCompressed(s, Aspect::Stencil, true);
 }
 
+// Test that storages with a single subresource per aspect stay compressed through Update() and
+// Merge() and report single-subresource ranges.
+TEST(SubresourceStorageTest, SingleSubresourceStorage) {
+    SubresourceStorage<int> s(Aspect::Depth | Aspect::Stencil, 1, 1, 3);
+    FakeStorage<int> f(Aspect::Depth | Aspect::Stencil, 1, 1, 3);
+    EXPECT_TRUE(s.IsSingleSubresourceForTesting());
+
+    // Update a single aspect.
+    {
+        SubresourceRange range = SubresourceRange::MakeSingle(Aspect::Stencil, 0, 0);
+        CallUpdateOnBoth(&s, &f, range, [](const SubresourceRange&, int* data) { *data += 1; });
+    }
+    CheckAspectCompressed(s, Aspect::Depth, true);
+    CheckAspectCompressed(s, Aspect::Stencil, true);
+    EXPECT_EQ(3, s.Get(Aspect::Depth, 0, 0));
+    EXPECT_EQ(4, s.Get(Aspect::Stencil, 0, 0));
+
+    // Update both aspects.
+    {
+        SubresourceRange range = SubresourceRange::MakeFull(Aspect::Depth | Aspect::Stencil, 1, 1);
+        CallUpdateOnBoth(&s, &f, range, [](const SubresourceRange&, int* data) { *data *= 2; });
+    }
+
+    // Merge another single subresource storage.
+    SubresourceStorage<bool> other(Aspect::Depth | Aspect::Stencil, 1, 1, false);
+    other.Update(SubresourceRange::MakeSingle(Aspect::Depth, 0, 0),
+                 [](const SubresourceRange&, bool* data) { *data = true; });
+    CallMergeOnBoth(&s, &f, other, [](const SubresourceRange&, int* data, bool other) {
+        if (other) {
+            *data = 13;
+        }
+    });
+    CheckAspectCompressed(s, Aspect::Depth, true);
+    CheckAspectCompressed(s, Aspect::Stencil, true);
+    EXPECT_EQ(13, s.Get(Aspect::Depth, 0, 0));
+    EXPECT_EQ(8, s.Get(Aspect::Stencil, 0, 0));
+
+    // Storages with more than one layer or level don't use the single subresource path.
+    EXPECT_FALSE((SubresourceStorage<int>(Aspect::Color, 2, 1).IsSingleSubresourceForTesting()));
+    EXPECT_FALSE((SubresourceStorage<int>(Aspect::Color, 1, 2).IsSingleSubresourceForTesting()));
+}
+
 // Bugs found while testing:
 //  - mLayersCompressed not initialized to true.
 //  - DecompressLayer setting Compressed to true instead of false.
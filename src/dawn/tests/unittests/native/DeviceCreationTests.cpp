@@ -166,6 +166,22 @@ TEST_F(DeviceCreationTest, CreateDeviceWithAllocatorFailedHeapBlockSize) {
     EXPECT_EQ(device, nullptr);
 }
 
+// Test failed call to CreateDevice with allocator descriptor. The staging ring buffer size provided
+// is not a multiple of 4.
+TEST_F(DeviceCreationTest, CreateDeviceWithAllocatorFailedStagingRingBufferSize) {
+    wgpu::DawnDeviceAllocatorControl allocationDesc = {};
+    allocationDesc.stagingRingBufferSize = 1024 * 1024 + 2;
+
+    wgpu::DeviceDescriptor desc = {};
+    wgpu::FeatureName feature = wgpu::FeatureName::DawnDeviceAllocatorControl;
+    desc.requiredFeatures = &feature;
+    desc.requiredFeatureCount = 1;
+    desc.nextInChain = &allocationDesc;
+
+    wgpu::Device device = unsafeAdapter.CreateDevice(&desc);
+    EXPECT_EQ(device, nullptr);
+}
+
 // Test successful call to CreateDevice with toggle descriptor.
 TEST_F(DeviceCreationTest, CreateDeviceWithTogglesSuccess) {
     wgpu::DeviceDescriptor desc = {};
@@ -1019,5 +1019,63 @@ TEST_F(DrawVertexAndIndexBufferOOBValidationTests, SetBufferMultipleTime) {
     }
 }
 
+// Verify that the vertex buffer range validation cached between draws is invalidated when the
+// vertex buffers or the pipeline change in the middle of a render pass.
+TEST_F(DrawVertexAndIndexBufferOOBValidationTests, StateChangeBetweenDraws) {
+    wgpu::Buffer vertexBuffer2 = CreateBuffer(2 * kFloat32x4Stride);
+    wgpu::Buffer vertexBuffer3 = CreateBuffer(3 * kFloat32x4Stride);
+    wgpu::RenderPipeline pipeline = CreateBasicRenderPipeline();
+
+    // Shrinking the vertex buffer after a successful draw makes the same draw OOB.
+    {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder renderPassEncoder =
+            encoder.BeginRenderPass(GetBasicRenderPassDescriptor());
+        renderPassEncoder.SetPipeline(pipeline);
+        renderPassEncoder.SetVertexBuffer(0, vertexBuffer3);
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.SetVertexBuffer(0, vertexBuffer2);
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.End();
+
+        ASSERT_DEVICE_ERROR(encoder.Finish());
+    }
+
+    // Switching to a pipeline with a larger stride after a successful draw makes the same draw
+    // OOB.
+    {
+        wgpu::RenderPipeline pipelineWithLargerStride =
+            CreateBasicRenderPipeline(2 * kFloat32x4Stride);
+
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder renderPassEncoder =
+            encoder.BeginRenderPass(GetBasicRenderPassDescriptor());
+        renderPassEncoder.SetPipeline(pipeline);
+        renderPassEncoder.SetVertexBuffer(0, vertexBuffer3);
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.SetPipeline(pipelineWithLargerStride);
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.End();
+
+        ASSERT_DEVICE_ERROR(encoder.Finish());
+    }
+
+    // Growing the vertex buffer between draws allows larger draws.
+    {
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::RenderPassEncoder renderPassEncoder =
+            encoder.BeginRenderPass(GetBasicRenderPassDescriptor());
+        renderPassEncoder.SetPipeline(pipeline);
+        renderPassEncoder.SetVertexBuffer(0, vertexBuffer2);
+        renderPassEncoder.Draw(2);
+        renderPassEncoder.SetVertexBuffer(0, vertexBuffer3);
+        renderPassEncoder.Draw(3);
+        renderPassEncoder.End();
+
+        encoder.Finish();
+    }
+}
+
 }  // anonymous namespace
 }  // namespace dawn
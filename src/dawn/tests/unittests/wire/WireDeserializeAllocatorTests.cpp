@@ -0,0 +1,129 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/wire/WireDeserializeAllocator.h"
+#include "gtest/gtest.h"
+
+namespace dawn::wire {
+namespace {
+
+constexpr size_t kLargeSize = 64 * 1024;
+
+// Test that small allocations are served from the inline storage.
+TEST(WireDeserializeAllocatorTests, SmallAllocationsDontAllocate) {
+    WireDeserializeAllocator allocator;
+    for (uint32_t i = 0; i < 10; ++i) {
+        EXPECT_NE(allocator.GetSpace(64), nullptr);
+        EXPECT_NE(allocator.GetSpace(128), nullptr);
+        allocator.Reset();
+    }
+
+    EXPECT_EQ(allocator.GetStats().heapAllocationCount, 0u);
+    EXPECT_EQ(allocator.GetStats().retainedBytes, 0u);
+    EXPECT_EQ(allocator.GetStats().peakBytesInUse, 192u);
+}
+
+// Test that heap blocks are reused across calls to Reset().
+TEST(WireDeserializeAllocatorTests, LargeAllocationsAreRetained) {
+    WireDeserializeAllocator allocator;
+
+    EXPECT_NE(allocator.GetSpace(kLargeSize), nullptr);
+    allocator.Reset();
+    EXPECT_EQ(allocator.GetStats().heapAllocationCount, 1u);
+    EXPECT_GE(allocator.GetStats().retainedBytes, kLargeSize);
+
+    for (uint32_t i = 0; i < 10; ++i) {
+        EXPECT_NE(allocator.GetSpace(kLargeSize), nullptr);
+        allocator.Reset();
+    }
+    EXPECT_EQ(allocator.GetStats().heapAllocationCount, 1u);
+    EXPECT_EQ(allocator.GetStats().heapFreeCount, 0u);
+}
+
+// Test that a retained block that is too small is replaced with a larger one.
+TEST(WireDeserializeAllocatorTests, RetainedBlockGrows) {
+    WireDeserializeAllocator allocator;
+
+    EXPECT_NE(allocator.GetSpace(kLargeSize), nullptr);
+    allocator.Reset();
+    EXPECT_NE(allocator.GetSpace(4 * kLargeSize), nullptr);
+    allocator.Reset();
+
+    EXPECT_EQ(allocator.GetStats().heapAllocationCount, 2u);
+    EXPECT_EQ(allocator.GetStats().heapFreeCount, 1u);
+    EXPECT_GE(allocator.GetStats().retainedBytes, 4 * kLargeSize);
+
+    // The larger block is used for subsequent smaller commands.
+    EXPECT_NE(allocator.GetSpace(kLargeSize), nullptr);
+    allocator.Reset();
+    EXPECT_EQ(allocator.GetStats().heapAllocationCount, 2u);
+}
+
+// Test that pointers returned in the same command don't overlap when spanning multiple blocks.
+TEST(WireDeserializeAllocatorTests, MultipleBlocksInOneCommand) {
+    WireDeserializeAllocator allocator;
+
+    char* a = static_cast<char*>(allocator.GetSpace(kLargeSize));
+    char* b = static_cast<char*>(allocator.GetSpace(kLargeSize));
+    char* c = static_cast<char*>(allocator.GetSpace(16));
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    ASSERT_NE(c, nullptr);
+    EXPECT_TRUE(a + kLargeSize <= b || b + kLargeSize <= a);
+    EXPECT_EQ(allocator.GetStats().heapAllocationCount, 2u);
+    allocator.Reset();
+    EXPECT_EQ(allocator.GetStats().peakBytesInUse, 2 * kLargeSize + 16);
+}
+
+// Test that blocks not used during a whole trim period are freed.
+TEST(WireDeserializeAllocatorTests, UnusedBlocksAreTrimmed) {
+    WireDeserializeAllocator allocator;
+
+    EXPECT_NE(allocator.GetSpace(kLargeSize), nullptr);
+    EXPECT_NE(allocator.GetSpace(kLargeSize), nullptr);
+    allocator.Reset();
+    EXPECT_EQ(allocator.GetStats().heapAllocationCount, 2u);
+
+    // Only use the first block for the rest of the first period, and the whole second period.
+    for (uint32_t i = 1; i < 2 * WireDeserializeAllocator::kTrimPeriod; ++i) {
+        EXPECT_NE(allocator.GetSpace(kLargeSize), nullptr);
+        allocator.Reset();
+    }
+    EXPECT_EQ(allocator.GetStats().heapAllocationCount, 2u);
+    EXPECT_EQ(allocator.GetStats().heapFreeCount, 1u);
+
+    // Only use the inline storage for a whole period.
+    for (uint32_t i = 0; i < WireDeserializeAllocator::kTrimPeriod; ++i) {
+        EXPECT_NE(allocator.GetSpace(16), nullptr);
+        allocator.Reset();
+    }
+    EXPECT_EQ(allocator.GetStats().heapFreeCount, 2u);
+    EXPECT_EQ(allocator.GetStats().retainedBytes, 0u);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::wire
@@ -0,0 +1,244 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/tests/unittests/wire/WireTest.h"
+
+namespace dawn::wire {
+namespace {
+
+using testing::_;
+using testing::Return;
+
+class WireImmutableObjectCacheTests : public WireTest {
+  private:
+    bool IsImmutableObjectDeduplicationEnabled() override { return true; }
+};
+
+// Test that samplers created with the same descriptor share a single server object that is only
+// released when the last reference is dropped.
+TEST_F(WireImmutableObjectCacheTests, SameSamplerDescriptorIsDeduplicated) {
+    wgpu::SamplerDescriptor descriptor = {};
+    descriptor.magFilter = wgpu::FilterMode::Linear;
+
+    wgpu::Sampler sampler1 = device.CreateSampler(&descriptor);
+    wgpu::Sampler sampler2 = device.CreateSampler(&descriptor);
+    EXPECT_EQ(sampler1.Get(), sampler2.Get());
+
+    WGPUSampler apiSampler = api.GetNewSampler();
+    EXPECT_CALL(api, DeviceCreateSampler(apiDevice, _)).WillOnce(Return(apiSampler));
+    FlushClient();
+
+    sampler1 = nullptr;
+    EXPECT_CALL(api, SamplerRelease(_)).Times(0);
+    FlushClient();
+
+    sampler2 = nullptr;
+    EXPECT_CALL(api, SamplerRelease(apiSampler)).Times(1);
+    FlushClient();
+
+    // The cache entry is gone with the object so the next sampler is created again.
+    wgpu::Sampler sampler3 = device.CreateSampler(&descriptor);
+    WGPUSampler apiSampler3 = api.GetNewSampler();
+    EXPECT_CALL(api, DeviceCreateSampler(apiDevice, _)).WillOnce(Return(apiSampler3));
+    FlushClient();
+}
+
+// Test that samplers with different descriptors or labels are not deduplicated.
+TEST_F(WireImmutableObjectCacheTests, DifferentSamplerDescriptorsAreNotDeduplicated) {
+    wgpu::SamplerDescriptor descriptor = {};
+    wgpu::Sampler sampler1 = device.CreateSampler(&descriptor);
+
+    descriptor.magFilter = wgpu::FilterMode::Linear;
+    wgpu::Sampler sampler2 = device.CreateSampler(&descriptor);
+
+    descriptor.label = "sampler";
+    wgpu::Sampler sampler3 = device.CreateSampler(&descriptor);
+
+    EXPECT_NE(sampler1.Get(), sampler2.Get());
+    EXPECT_NE(sampler2.Get(), sampler3.Get());
+
+    EXPECT_CALL(api, DeviceCreateSampler(apiDevice, _))
+        .WillOnce(Return(api.GetNewSampler()))
+        .WillOnce(Return(api.GetNewSampler()))
+        .WillOnce(Return(api.GetNewSampler()));
+    FlushClient();
+}
+
+// Test that pipeline layouts referencing deduplicated bind group layouts are deduplicated too.
+TEST_F(WireImmutableObjectCacheTests, LayoutsAreDeduplicated) {
+    wgpu::BindGroupLayoutEntry entry = {};
+    entry.binding = 0;
+    entry.visibility = wgpu::ShaderStage::Fragment;
+    entry.sampler.type = wgpu::SamplerBindingType::Filtering;
+
+    wgpu::BindGroupLayoutDescriptor bglDescriptor = {};
+    bglDescriptor.entryCount = 1;
+    bglDescriptor.entries = &entry;
+
+    wgpu::BindGroupLayout bgl1 = device.CreateBindGroupLayout(&bglDescriptor);
+    wgpu::BindGroupLayout bgl2 = device.CreateBindGroupLayout(&bglDescriptor);
+    EXPECT_EQ(bgl1.Get(), bgl2.Get());
+
+    wgpu::PipelineLayoutDescriptor descriptor = {};
+    descriptor.bindGroupLayoutCount = 1;
+
+    descriptor.bindGroupLayouts = &bgl1;
+    wgpu::PipelineLayout layout1 = device.CreatePipelineLayout(&descriptor);
+    descriptor.bindGroupLayouts = &bgl2;
+    wgpu::PipelineLayout layout2 = device.CreatePipelineLayout(&descriptor);
+    EXPECT_EQ(layout1.Get(), layout2.Get());
+
+    WGPUBindGroupLayout apiBgl = api.GetNewBindGroupLayout();
+    EXPECT_CALL(api, DeviceCreateBindGroupLayout(apiDevice, _)).WillOnce(Return(apiBgl));
+    WGPUPipelineLayout apiLayout = api.GetNewPipelineLayout();
+    EXPECT_CALL(api, DeviceCreatePipelineLayout(apiDevice, _)).WillOnce(Return(apiLayout));
+    FlushClient();
+}
+
+// Test that a pipeline layout is not reused for a bind group layout that recycled the ObjectId of
+// a released bind group layout.
+TEST_F(WireImmutableObjectCacheTests, RecycledIdIsNotDeduplicated) {
+    wgpu::BindGroupLayoutEntry entry = {};
+    entry.binding = 0;
+    entry.visibility = wgpu::ShaderStage::Fragment;
+    entry.sampler.type = wgpu::SamplerBindingType::Filtering;
+
+    wgpu::BindGroupLayoutDescriptor bglDescriptor = {};
+    bglDescriptor.entryCount = 1;
+    bglDescriptor.entries = &entry;
+
+    wgpu::PipelineLayoutDescriptor descriptor = {};
+    descriptor.bindGroupLayoutCount = 1;
+
+    // Create a pipeline layout that stays alive after its bind group layout is released.
+    wgpu::BindGroupLayout bglA = device.CreateBindGroupLayout(&bglDescriptor);
+    descriptor.bindGroupLayouts = &bglA;
+    wgpu::PipelineLayout layoutA = device.CreatePipelineLayout(&descriptor);
+
+    WGPUBindGroupLayout apiBglA = api.GetNewBindGroupLayout();
+    EXPECT_CALL(api, DeviceCreateBindGroupLayout(apiDevice, _)).WillOnce(Return(apiBglA));
+    WGPUPipelineLayout apiLayoutA = api.GetNewPipelineLayout();
+    EXPECT_CALL(api, DeviceCreatePipelineLayout(apiDevice, _)).WillOnce(Return(apiLayoutA));
+    FlushClient();
+
+    bglA = nullptr;
+    EXPECT_CALL(api, BindGroupLayoutRelease(apiBglA)).Times(1);
+    FlushClient();
+
+    // The new bind group layout gets the ObjectId of the released one with a new generation so
+    // the identical pipeline layout creation command must create a new object.
+    entry.visibility = wgpu::ShaderStage::Compute;
+    wgpu::BindGroupLayout bglB = device.CreateBindGroupLayout(&bglDescriptor);
+    descriptor.bindGroupLayouts = &bglB;
+    wgpu::PipelineLayout layoutB = device.CreatePipelineLayout(&descriptor);
+    EXPECT_NE(layoutA.Get(), layoutB.Get());
+
+    WGPUBindGroupLayout apiBglB = api.GetNewBindGroupLayout();
+    EXPECT_CALL(api, DeviceCreateBindGroupLayout(apiDevice, _)).WillOnce(Return(apiBglB));
+    WGPUPipelineLayout apiLayoutB = api.GetNewPipelineLayout();
+    EXPECT_CALL(api, DeviceCreatePipelineLayout(apiDevice, _)).WillOnce(Return(apiLayoutB));
+    FlushClient();
+}
+
+// Test that a bind group layout is not reused for a static sampler that recycled the ObjectId of a
+// released sampler.
+TEST_F(WireImmutableObjectCacheTests, RecycledStaticSamplerIdIsNotDeduplicated) {
+    wgpu::StaticSamplerBindingLayout staticSampler = {};
+    wgpu::BindGroupLayoutEntry entry = {};
+    entry.binding = 0;
+    entry.visibility = wgpu::ShaderStage::Fragment;
+    entry.nextInChain = &staticSampler;
+
+    wgpu::BindGroupLayoutDescriptor bglDescriptor = {};
+    bglDescriptor.entryCount = 1;
+    bglDescriptor.entries = &entry;
+
+    // Create a bind group layout that stays alive after its static sampler is released.
+    wgpu::Sampler samplerA = device.CreateSampler();
+    staticSampler.sampler = samplerA;
+    wgpu::BindGroupLayout bglA = device.CreateBindGroupLayout(&bglDescriptor);
+
+    WGPUSampler apiSamplerA = api.GetNewSampler();
+    EXPECT_CALL(api, DeviceCreateSampler(apiDevice, _)).WillOnce(Return(apiSamplerA));
+    WGPUBindGroupLayout apiBglA = api.GetNewBindGroupLayout();
+    EXPECT_CALL(api, DeviceCreateBindGroupLayout(apiDevice, _)).WillOnce(Return(apiBglA));
+    FlushClient();
+
+    samplerA = nullptr;
+    staticSampler.sampler = nullptr;
+    EXPECT_CALL(api, SamplerRelease(apiSamplerA)).Times(1);
+    FlushClient();
+
+    // The new sampler gets the ObjectId of the released one with a new generation so the
+    // identical bind group layout creation command must create a new object.
+    wgpu::SamplerDescriptor samplerDescriptor = {};
+    samplerDescriptor.magFilter = wgpu::FilterMode::Linear;
+    wgpu::Sampler samplerB = device.CreateSampler(&samplerDescriptor);
+    staticSampler.sampler = samplerB;
+    wgpu::BindGroupLayout bglB = device.CreateBindGroupLayout(&bglDescriptor);
+    EXPECT_NE(bglA.Get(), bglB.Get());
+
+    WGPUSampler apiSamplerB = api.GetNewSampler();
+    EXPECT_CALL(api, DeviceCreateSampler(apiDevice, _)).WillOnce(Return(apiSamplerB));
+    WGPUBindGroupLayout apiBglB = api.GetNewBindGroupLayout();
+    EXPECT_CALL(api, DeviceCreateBindGroupLayout(apiDevice, _)).WillOnce(Return(apiBglB));
+    FlushClient();
+
+    // While the sampler is alive, the same descriptor still shares the bind group layout.
+    wgpu::BindGroupLayout bglC = device.CreateBindGroupLayout(&bglDescriptor);
+    EXPECT_EQ(bglB.Get(), bglC.Get());
+    FlushClient();
+}
+
+// Test that deduplicated objects can outlive the client.
+TEST_F(WireImmutableObjectCacheTests, ObjectOutlivesClient) {
+    wgpu::Sampler sampler1 = device.CreateSampler();
+    wgpu::Sampler sampler2 = device.CreateSampler();
+
+    WGPUSampler apiSampler = api.GetNewSampler();
+    EXPECT_CALL(api, DeviceCreateSampler(apiDevice, _)).WillOnce(Return(apiSampler));
+    FlushClient();
+
+    DeleteClient();
+
+    EXPECT_CALL(api, OnDeviceSetLoggingCallback(apiDevice, _)).Times(1);
+    EXPECT_CALL(api, DeviceRelease(apiDevice)).Times(1);
+    EXPECT_CALL(api, QueueRelease(apiQueue)).Times(1);
+    EXPECT_CALL(api, SamplerRelease(apiSampler)).Times(1);
+    EXPECT_CALL(api, AdapterRelease(apiAdapter)).Times(1);
+    EXPECT_CALL(api, InstanceRelease(apiInstance)).Times(1);
+    FlushClient();
+
+    DefaultApiDeviceWasReleased();
+    DefaultApiAdapterWasReleased();
+
+    sampler1 = nullptr;
+    sampler2 = nullptr;
+}
+
+}  // anonymous namespace
+}  // namespace dawn::wire
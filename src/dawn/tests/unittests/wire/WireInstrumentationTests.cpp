@@ -0,0 +1,118 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstring>
+#include <vector>
+
+#include "dawn/tests/unittests/wire/WireTest.h"
+#include "dawn/wire/WireClient.h"
+#include "dawn/wire/WireServer.h"
+
+namespace dawn::wire {
+namespace {
+
+using testing::_;
+
+const WireCommandStats* FindCommand(const std::vector<WireCommandStats>& commands,
+                                    const char* name) {
+    for (const WireCommandStats& command : commands) {
+        if (strcmp(command.name, name) == 0) {
+            return &command;
+        }
+    }
+    return nullptr;
+}
+
+class WireInstrumentationTests : public WireTest {
+  private:
+    bool IsInstrumentationEnabled() override { return true; }
+};
+
+// Test that commands sent by the client are counted on both sides of the wire.
+TEST_F(WireInstrumentationTests, CommandsAreCounted) {
+    GetWireClient()->ResetStats();
+    GetWireServer()->ResetStats();
+
+    queue.Submit(0, nullptr);
+    queue.Submit(0, nullptr);
+    EXPECT_CALL(api, QueueSubmit(apiQueue, 0, _)).Times(2);
+    FlushClient();
+
+    WireStats clientStats = GetWireClient()->GetStats();
+    const WireCommandStats* sent = FindCommand(clientStats.sentCommands, "QueueSubmit");
+    ASSERT_NE(sent, nullptr);
+    EXPECT_EQ(sent->count, 2u);
+    EXPECT_GT(sent->bytes, 0u);
+
+    WireStats serverStats = GetWireServer()->GetStats();
+    const WireCommandStats* received = FindCommand(serverStats.receivedCommands, "QueueSubmit");
+    ASSERT_NE(received, nullptr);
+    EXPECT_EQ(received->count, 2u);
+    EXPECT_EQ(received->bytes, sent->bytes);
+    EXPECT_EQ(serverStats.receivedBatchCount, 1u);
+    EXPECT_GE(serverStats.receivedBatchBytes, sent->bytes);
+    EXPECT_EQ(serverStats.maxReceivedBatchBytes, serverStats.receivedBatchBytes);
+}
+
+// Test that resetting the statistics clears them.
+TEST_F(WireInstrumentationTests, ResetStats) {
+    queue.Submit(0, nullptr);
+    EXPECT_CALL(api, QueueSubmit(apiQueue, 0, _)).Times(1);
+    FlushClient();
+
+    EXPECT_FALSE(GetWireClient()->GetStats().sentCommands.empty());
+    EXPECT_FALSE(GetWireServer()->GetStats().receivedCommands.empty());
+
+    GetWireClient()->ResetStats();
+    GetWireServer()->ResetStats();
+
+    WireStats clientStats = GetWireClient()->GetStats();
+    EXPECT_TRUE(clientStats.sentCommands.empty());
+    EXPECT_TRUE(clientStats.receivedCommands.empty());
+    EXPECT_EQ(clientStats.receivedBatchCount, 0u);
+
+    WireStats serverStats = GetWireServer()->GetStats();
+    EXPECT_TRUE(serverStats.sentCommands.empty());
+    EXPECT_TRUE(serverStats.receivedCommands.empty());
+    EXPECT_EQ(serverStats.receivedBatchCount, 0u);
+}
+
+class WireNoInstrumentationTests : public WireTest {};
+
+// Test that no statistics are collected unless instrumentation is enabled.
+TEST_F(WireNoInstrumentationTests, StatsAreEmpty) {
+    queue.Submit(0, nullptr);
+    EXPECT_CALL(api, QueueSubmit(apiQueue, 0, _)).Times(1);
+    FlushClient();
+
+    EXPECT_TRUE(GetWireClient()->GetStats().sentCommands.empty());
+    EXPECT_TRUE(GetWireServer()->GetStats().receivedCommands.empty());
+    EXPECT_EQ(GetWireServer()->GetStats().receivedBatchCount, 0u);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::wire
@@ -0,0 +1,211 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstring>
+#include <vector>
+
+#include "dawn/tests/unittests/wire/WireTest.h"
+#include "dawn/wire/WireClient.h"
+
+namespace dawn::wire {
+namespace {
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::Sequence;
+
+constexpr size_t kRingSize = 256 * 1024;
+// Large enough to go through the ring with the default threshold, small enough for two to fit.
+constexpr size_t kLargeWriteSize = 96 * 1024;
+
+uint64_t GetSentCommandCount(WireClient* client, const char* name) {
+    for (const WireCommandStats& command : client->GetStats().sentCommands) {
+        if (strcmp(command.name, name) == 0) {
+            return command.count;
+        }
+    }
+    return 0;
+}
+
+class WireQueueTransferRingTests : public WireTest {
+  protected:
+    void SetUp() override {
+        WireTest::SetUp();
+
+        wgpu::BufferDescriptor descriptor = {};
+        descriptor.size = kRingSize;
+        descriptor.usage = wgpu::BufferUsage::CopyDst;
+        buffer = device.CreateBuffer(&descriptor);
+
+        apiBuffer = api.GetNewBuffer();
+        EXPECT_CALL(api, DeviceCreateBuffer(apiDevice, _)).WillOnce(Return(apiBuffer));
+        FlushClient();
+    }
+
+    void TearDown() override {
+        // We must lose all references to objects before calling parent TearDown to avoid
+        // referencing the proc table after it gets cleared.
+        buffer = nullptr;
+
+        WireTest::TearDown();
+    }
+
+    // Writes |size| bytes of |value| to the buffer and sets the expectation that the server
+    // forwards the same data to the backend.
+    void WriteBuffer(size_t size, uint8_t value) {
+        std::vector<uint8_t> data(size, value);
+        queue.WriteBuffer(buffer, 0, data.data(), size);
+
+        EXPECT_CALL(api, QueueWriteBuffer(apiQueue, apiBuffer, 0, _, size))
+            .InSequence(mWriteSequence)
+            .WillOnce(Invoke([size, value](WGPUQueue, WGPUBuffer, uint64_t, const void* apiData,
+                                           size_t) {
+                std::vector<uint8_t> expected(size, value);
+                EXPECT_EQ(memcmp(apiData, expected.data(), size), 0);
+            }))
+            .RetiresOnSaturation();
+    }
+
+    // Checks how many writes were sent through the transfer ring and how many were inline.
+    void ExpectWriteBufferCounts(uint64_t ringCount, uint64_t inlineCount) {
+        EXPECT_EQ(GetSentCommandCount(GetWireClient(), "QueueWriteBufferFromTransferRing"),
+                  ringCount);
+        EXPECT_EQ(GetSentCommandCount(GetWireClient(), "QueueWriteBuffer"), inlineCount);
+    }
+
+    wgpu::Buffer buffer;
+    WGPUBuffer apiBuffer;
+
+  private:
+    // The write expectations are identical except for the data so they must be matched in order.
+    // Only they are sequenced because FlushClient() recreates the ignored call expectations, which
+    // would be retired by the next write if they were part of the sequence.
+    Sequence mWriteSequence;
+
+    size_t GetWriteTransferRingSize() override { return kRingSize; }
+    bool IsInstrumentationEnabled() override { return true; }
+};
+
+// Test that small writes are still forwarded correctly.
+TEST_F(WireQueueTransferRingTests, SmallWrite) {
+    WriteBuffer(16, 0x12);
+    FlushClient();
+
+    ExpectWriteBufferCounts(0, 1);
+}
+
+// Test that large writes staged in the ring are forwarded correctly.
+TEST_F(WireQueueTransferRingTests, LargeWrite) {
+    WriteBuffer(kLargeWriteSize, 0x34);
+    FlushClient();
+    FlushServer();
+
+    WriteBuffer(kLargeWriteSize, 0x56);
+    FlushClient();
+    FlushServer();
+
+    ExpectWriteBufferCounts(2, 0);
+}
+
+// Test that writes larger than the ring are sent inline.
+TEST_F(WireQueueTransferRingTests, WriteLargerThanRing) {
+    WriteBuffer(kRingSize + 4, 0x78);
+    FlushClient();
+
+    ExpectWriteBufferCounts(0, 1);
+}
+
+// Test that writes fall back to the command stream while the server hasn't consumed the ring, and
+// that the ring is used again once it has.
+TEST_F(WireQueueTransferRingTests, RingFullFallsBackInline) {
+    WriteBuffer(kLargeWriteSize, 0x01);
+    WriteBuffer(kLargeWriteSize, 0x02);
+    // There is no space left for this one until the server acknowledges the previous writes.
+    WriteBuffer(kLargeWriteSize, 0x03);
+    FlushClient();
+    FlushServer();
+    ExpectWriteBufferCounts(2, 1);
+
+    // This write wraps around to the start of the ring.
+    WriteBuffer(kLargeWriteSize, 0x04);
+    WriteBuffer(kLargeWriteSize, 0x05);
+    FlushClient();
+    FlushServer();
+    ExpectWriteBufferCounts(4, 1);
+}
+
+// Test that large texture writes are staged in the ring and forwarded correctly.
+TEST_F(WireQueueTransferRingTests, LargeWriteTexture) {
+    constexpr uint32_t kWidth = 64;
+    constexpr uint32_t kBytesPerRow = kWidth * 4;
+    constexpr uint32_t kHeight = kLargeWriteSize / kBytesPerRow;
+
+    wgpu::TextureDescriptor descriptor = {};
+    descriptor.size = {kWidth, kHeight};
+    descriptor.format = wgpu::TextureFormat::RGBA8Unorm;
+    descriptor.usage = wgpu::TextureUsage::CopyDst;
+    wgpu::Texture texture = device.CreateTexture(&descriptor);
+
+    WGPUTexture apiTexture = api.GetNewTexture();
+    EXPECT_CALL(api, DeviceCreateTexture(apiDevice, _)).WillOnce(Return(apiTexture));
+    FlushClient();
+
+    std::vector<uint8_t> data(kLargeWriteSize, 0x9A);
+    wgpu::TexelCopyTextureInfo destination = {};
+    destination.texture = texture;
+    wgpu::TexelCopyBufferLayout dataLayout = {};
+    dataLayout.bytesPerRow = kBytesPerRow;
+    dataLayout.rowsPerImage = kHeight;
+    wgpu::Extent3D writeSize = {kWidth, kHeight};
+    queue.WriteTexture(&destination, data.data(), data.size(), &dataLayout, &writeSize);
+
+    EXPECT_CALL(api, QueueWriteTexture(apiQueue, _, _, kLargeWriteSize, _, _))
+        .WillOnce(Invoke([&](WGPUQueue, const WGPUTexelCopyTextureInfo* apiDestination,
+                             const void* apiData, size_t,
+                             const WGPUTexelCopyBufferLayout* apiLayout,
+                             const WGPUExtent3D* apiWriteSize) {
+            EXPECT_EQ(apiDestination->texture, apiTexture);
+            EXPECT_EQ(apiLayout->bytesPerRow, kBytesPerRow);
+            EXPECT_EQ(apiWriteSize->height, kHeight);
+            EXPECT_EQ(memcmp(apiData, data.data(), kLargeWriteSize), 0);
+        }));
+    FlushClient();
+    FlushServer();
+
+    EXPECT_EQ(GetSentCommandCount(GetWireClient(), "QueueWriteTextureFromTransferRing"), 1u);
+    EXPECT_EQ(GetSentCommandCount(GetWireClient(), "QueueWriteTexture"), 0u);
+
+    // The destination holds a reference to the texture too.
+    destination.texture = nullptr;
+    texture = nullptr;
+    EXPECT_CALL(api, TextureRelease(apiTexture));
+    FlushClient();
+}
+
+}  // anonymous namespace
+}  // namespace dawn::wire
@@ -0,0 +1,161 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "dawn/tests/unittests/wire/WireTest.h"
+#include "dawn/wire/WireClient.h"
+
+namespace dawn::wire {
+namespace {
+
+using testing::_;
+using testing::Return;
+
+constexpr size_t kCacheSize = 4096;
+
+uint64_t GetSentCommandCount(WireClient* client, const char* name) {
+    for (const WireCommandStats& command : client->GetStats().sentCommands) {
+        if (strcmp(command.name, name) == 0) {
+            return command.count;
+        }
+    }
+    return 0;
+}
+
+// Matches a shader module descriptor made of just the WGSL |code|.
+auto MatchesWGSL(const std::string& code) {
+    return MatchesLambda([code](const WGPUShaderModuleDescriptor* desc) -> bool {
+        const WGPUChainedStruct* chain = desc->nextInChain;
+        if (chain == nullptr || chain->sType != WGPUSType_ShaderSourceWGSL ||
+            chain->next != nullptr) {
+            return false;
+        }
+        const auto* wgslDesc = reinterpret_cast<const WGPUShaderSourceWGSL*>(chain);
+        return std::string(wgslDesc->code.data, wgslDesc->code.length) == code;
+    });
+}
+
+class WireShaderSourceCacheTests : public WireTest {
+  protected:
+    wgpu::ShaderModule CreateShaderModule(const std::string& code) {
+        wgpu::ShaderSourceWGSL wgslDesc;
+        wgslDesc.code = code.c_str();
+        wgpu::ShaderModuleDescriptor descriptor;
+        descriptor.nextInChain = &wgslDesc;
+        return device.CreateShaderModule(&descriptor);
+    }
+
+  private:
+    size_t GetShaderSourceCacheSize() override { return kCacheSize; }
+    // The server enforces the same budget, so the sources must be released before the new ones
+    // are registered.
+    size_t GetMaxServerShaderSourceCacheSize() override { return kCacheSize; }
+    bool IsInstrumentationEnabled() override { return true; }
+};
+
+// Test that a source is only sent once and then referenced by the later shader modules.
+TEST_F(WireShaderSourceCacheTests, SourceIsSentOnce) {
+    std::string code(2000, ' ');
+    wgpu::ShaderModule module1 = CreateShaderModule(code);
+    wgpu::ShaderModule module2 = CreateShaderModule(code);
+
+    EXPECT_CALL(api, DeviceCreateShaderModule(apiDevice, MatchesWGSL(code)))
+        .WillOnce(Return(api.GetNewShaderModule()))
+        .WillOnce(Return(api.GetNewShaderModule()));
+    FlushClient();
+
+    EXPECT_EQ(GetSentCommandCount(GetWireClient(), "ShaderSourceRegister"), 1u);
+    EXPECT_EQ(GetSentCommandCount(GetWireClient(), "DeviceCreateShaderModuleFromSource"), 2u);
+    EXPECT_EQ(GetSentCommandCount(GetWireClient(), "DeviceCreateShaderModule"), 0u);
+}
+
+// Test that small sources are sent inline.
+TEST_F(WireShaderSourceCacheTests, SmallSourceIsSentInline) {
+    std::string code(16, ' ');
+    wgpu::ShaderModule module = CreateShaderModule(code);
+
+    EXPECT_CALL(api, DeviceCreateShaderModule(apiDevice, MatchesWGSL(code)))
+        .WillOnce(Return(api.GetNewShaderModule()));
+    FlushClient();
+
+    EXPECT_EQ(GetSentCommandCount(GetWireClient(), "ShaderSourceRegister"), 0u);
+    EXPECT_EQ(GetSentCommandCount(GetWireClient(), "DeviceCreateShaderModule"), 1u);
+}
+
+// Test that the least recently used source is evicted when the budget is exceeded, and is sent
+// again when it is used after that.
+TEST_F(WireShaderSourceCacheTests, SourcesAreEvicted) {
+    std::string codeA(kCacheSize / 2, 'a');
+    std::string codeB(kCacheSize / 2, 'b');
+    std::string codeC(kCacheSize / 2, 'c');
+
+    wgpu::ShaderModule moduleA = CreateShaderModule(codeA);
+    wgpu::ShaderModule moduleB = CreateShaderModule(codeB);
+    // Using A again makes B the least recently used source so it is the one evicted by C.
+    wgpu::ShaderModule moduleA2 = CreateShaderModule(codeA);
+    wgpu::ShaderModule moduleC = CreateShaderModule(codeC);
+    wgpu::ShaderModule moduleB2 = CreateShaderModule(codeB);
+
+    EXPECT_CALL(api, DeviceCreateShaderModule(apiDevice, MatchesWGSL(codeA)))
+        .Times(2)
+        .WillRepeatedly(Return(api.GetNewShaderModule()));
+    EXPECT_CALL(api, DeviceCreateShaderModule(apiDevice, MatchesWGSL(codeB)))
+        .Times(2)
+        .WillRepeatedly(Return(api.GetNewShaderModule()));
+    EXPECT_CALL(api, DeviceCreateShaderModule(apiDevice, MatchesWGSL(codeC)))
+        .WillOnce(Return(api.GetNewShaderModule()));
+    FlushClient();
+
+    EXPECT_EQ(GetSentCommandCount(GetWireClient(), "ShaderSourceRegister"), 4u);
+    EXPECT_EQ(GetSentCommandCount(GetWireClient(), "ShaderSourceRelease"), 2u);
+}
+
+class WireShaderSourceCacheServerLimitTests : public WireShaderSourceCacheTests {
+  private:
+    size_t GetMaxServerShaderSourceCacheSize() override { return kCacheSize / 2; }
+};
+
+// Test that registering more sources than the server allows is a fatal error.
+TEST_F(WireShaderSourceCacheServerLimitTests, RegistrationOverLimitIsFatal) {
+    std::string codeA(kCacheSize / 2, 'a');
+    wgpu::ShaderModule moduleA = CreateShaderModule(codeA);
+
+    EXPECT_CALL(api, DeviceCreateShaderModule(apiDevice, MatchesWGSL(codeA)))
+        .WillOnce(Return(api.GetNewShaderModule()));
+    FlushClient();
+
+    // The client's budget fits both sources, but the server only has room for one.
+    std::string codeB(2000, 'b');
+    wgpu::ShaderModule moduleB = CreateShaderModule(codeB);
+    FlushClient(false);
+}
+
+}  // anonymous namespace
+}  // namespace dawn::wire
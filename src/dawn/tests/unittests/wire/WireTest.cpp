@@ -61,6 +61,26 @@ wire::server::MemoryTransferService* WireTest::GetServerMemoryTransferService()
     return nullptr;
 }
 
+size_t WireTest::GetWriteTransferRingSize() {
+    return 0;
+}
+
+bool WireTest::IsInstrumentationEnabled() {
+    return false;
+}
+
+bool WireTest::IsImmutableObjectDeduplicationEnabled() {
+    return false;
+}
+
+size_t WireTest::GetShaderSourceCacheSize() {
+    return 0;
+}
+
+size_t WireTest::GetMaxServerShaderSourceCacheSize() {
+    return wire::WireServerDescriptor{}.maxShaderSourceCacheSize;
+}
+
 void WireTest::SetUp() {
     DawnProcTable mockProcs;
     api.GetProcTable(&mockProcs);
@@ -73,6 +93,8 @@ void WireTest::SetUp() {
     serverDesc.procs = &mockProcs;
     serverDesc.serializer = mS2cBuf.get();
     serverDesc.memoryTransferService = GetServerMemoryTransferService();
+    serverDesc.enableInstrumentation = IsInstrumentationEnabled();
+    serverDesc.maxShaderSourceCacheSize = GetMaxServerShaderSourceCacheSize();
 
     mWireServer.reset(new wire::WireServer(serverDesc));
     mC2sBuf->SetHandler(mWireServer.get());
@@ -80,6 +102,10 @@ void WireTest::SetUp() {
     wire::WireClientDescriptor clientDesc = {};
     clientDesc.serializer = mC2sBuf.get();
     clientDesc.memoryTransferService = GetClientMemoryTransferService();
+    clientDesc.writeTransferRingSize = GetWriteTransferRingSize();
+    clientDesc.enableInstrumentation = IsInstrumentationEnabled();
+    clientDesc.deduplicateImmutableObjects = IsImmutableObjectDeduplicationEnabled();
+    clientDesc.shaderSourceCacheSize = GetShaderSourceCacheSize();
 
     mWireClient.reset(new wire::WireClient(clientDesc));
     mS2cBuf->SetHandler(mWireClient.get());
@@ -188,6 +188,11 @@ class WireTest : public testing::Test {
 
     virtual dawn::wire::client::MemoryTransferService* GetClientMemoryTransferService();
     virtual dawn::wire::server::MemoryTransferService* GetServerMemoryTransferService();
+    virtual size_t GetWriteTransferRingSize();
+    virtual bool IsInstrumentationEnabled();
+    virtual bool IsImmutableObjectDeduplicationEnabled();
+    virtual size_t GetShaderSourceCacheSize();
+    virtual size_t GetMaxServerShaderSourceCacheSize();
 
     std::unique_ptr<dawn::wire::WireServer> mWireServer;
     std::unique_ptr<dawn::wire::WireClient> mWireClient;
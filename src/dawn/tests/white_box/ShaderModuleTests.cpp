@@ -30,6 +30,7 @@
 #include <utility>
 #include <vector>
 
+#include "dawn/native/Device.h"
 #include "dawn/native/ShaderModule.h"
 #include "dawn/tests/DawnTest.h"
 #include "dawn/utils/ComboRenderPipelineDescriptor.h"
@@ -40,6 +41,13 @@ namespace {
 
 constexpr wgpu::TextureFormat kRenderAttachmentFormat = wgpu::TextureFormat::RGBA8Unorm;
 
+// TintProgram only caches IR modules when they can be encoded with the IR binary format.
+#if TINT_BUILD_IR_BINARY
+constexpr bool kCachesEncodedIR = true;
+#else
+constexpr bool kCachesEncodedIR = false;
+#endif
+
 const char* kVertexShader = R"(
     @vertex fn main(
         @builtin(vertex_index) VertexIndex : u32
@@ -67,6 +75,32 @@ const char* kComputeShader = R"(
         ssbo.value = 1u;
     })";
 
+const char* kComputeShaderWithOverride = R"(
+    override value : u32 = 1u;
+    struct SSBO {
+        value : u32
+    }
+    @group(0) @binding(0) var<storage, read_write> ssbo : SSBO;
+
+    @compute @workgroup_size(1) fn main() {
+        ssbo.value = value;
+    })";
+
+const char* kComputeShaderWithOverrideSizedArray = R"(
+    override count : u32 = 1u;
+    var<workgroup> data : array<u32, count * 2u>;
+    struct SSBO {
+        value : u32
+    }
+    @group(0) @binding(0) var<storage, read_write> ssbo : SSBO;
+
+    @compute @workgroup_size(1) fn main() {
+        for (var i = 0u; i < count * 2u; i++) {
+            data[i] = i;
+        }
+        ssbo.value = data[count * 2u - 1u];
+    })";
+
 struct CreatePipelineAsyncTask {
     wgpu::ComputePipeline computePipeline = nullptr;
     wgpu::RenderPipeline renderPipeline = nullptr;
@@ -125,12 +159,15 @@ class ShaderModuleTests : public DawnTest {
             });
     }
 
-    wgpu::ComputePipeline DoCreateComputePipeline(const wgpu::ShaderModule& module) {
+    wgpu::ComputePipeline DoCreateComputePipeline(const wgpu::ShaderModule& module,
+                                                  std::vector<wgpu::ConstantEntry> constants = {}) {
         wgpu::ComputePipelineDescriptor csDesc;
         auto bgl = utils::MakeBindGroupLayout(
             device, {{0, wgpu::ShaderStage::Compute, wgpu::BufferBindingType::Storage}});
         csDesc.layout = utils::MakeBasicPipelineLayout(device, &bgl);
         csDesc.compute.module = module;
+        csDesc.compute.constantCount = constants.size();
+        csDesc.compute.constants = constants.data();
         return device.CreateComputePipeline(&csDesc);
     }
 
@@ -398,6 +435,130 @@ TEST_P(ShaderModuleTests, CreateComputePipelineAsync) {
     EXPECT_FALSE(shaderModule->GetNullableTintProgramForTesting());
 }
 
+// Check that the AST of a TintProgram is only converted to IR once and that every call to
+// CreateLoweredIR returns a module that the caller owns.
+TEST_P(ShaderModuleTests, LoweredIRIsCached) {
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, kComputeShader);
+    Ref<ShaderModuleBase> shaderModule(FromAPI(module.Get()));
+    auto scopedUseTintProgram = shaderModule->UseTintProgram();
+    Ref<TintProgram> tintProgram = shaderModule->GetTintProgram();
+    ASSERT_NE(tintProgram, nullptr);
+
+    auto ir1 = tintProgram->CreateLoweredIR();
+    ASSERT_EQ(ir1, tint::Success);
+    auto ir2 = tintProgram->CreateLoweredIR();
+    ASSERT_EQ(ir2, tint::Success);
+    EXPECT_NE(&ir1.Get(), &ir2.Get());
+    EXPECT_EQ(ir1->functions.Length(), ir2->functions.Length());
+
+#if TINT_BUILD_IR_BINARY
+    // The second module is decoded from the cached encoded module.
+    EXPECT_EQ(tintProgram->GetLoweringCountForTesting(), 1u);
+#else
+    // Without the IR binary format there is nothing to cache and the AST is lowered every time.
+    EXPECT_EQ(tintProgram->GetLoweringCountForTesting(), 2u);
+#endif
+}
+
+// Check that pipelines can be created from a shader with overrides, including an array sized by an
+// override, both from the IR that was just lowered and from the IR that is decoded from the cache.
+TEST_P(ShaderModuleTests, CreateComputePipelineWithOverrides) {
+    wgpu::ShaderModule module =
+        utils::CreateShaderModule(device, kComputeShaderWithOverrideSizedArray);
+    Ref<ShaderModuleBase> shaderModule(FromAPI(module.Get()));
+    auto scopedUseTintProgram = shaderModule->UseTintProgram();
+    Ref<TintProgram> tintProgram = shaderModule->GetTintProgram();
+
+    for (uint32_t count : {2u, 3u}) {
+        wgpu::ComputePipeline pipeline =
+            DoCreateComputePipeline(module, {{nullptr, "count", static_cast<double>(count)}});
+        ASSERT_TRUE(pipeline);
+
+        wgpu::BufferDescriptor bufferDesc;
+        bufferDesc.size = sizeof(uint32_t);
+        bufferDesc.usage = wgpu::BufferUsage::Storage | wgpu::BufferUsage::CopySrc;
+        wgpu::Buffer buffer = device.CreateBuffer(&bufferDesc);
+        wgpu::BindGroup bindGroup =
+            utils::MakeBindGroup(device, pipeline.GetBindGroupLayout(0), {{0, buffer}});
+
+        wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+        wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+        pass.SetPipeline(pipeline);
+        pass.SetBindGroup(0, bindGroup);
+        pass.DispatchWorkgroups(1);
+        pass.End();
+        wgpu::CommandBuffer commands = encoder.Finish();
+        queue.Submit(1, &commands);
+
+        // Each element of the array holds its index.
+        EXPECT_BUFFER_U32_EQ(count * 2 - 1, buffer, 0);
+    }
+
+    if (kCachesEncodedIR) {
+        // The second pipeline decoded the IR instead of lowering the program again.
+        EXPECT_EQ(tintProgram->GetLoweringCountForTesting(), 1u);
+    }
+}
+
+// Check that pipelines that only differ by their override constants reuse the pre-override IR
+// of their entry point.
+TEST_P(ShaderModuleTests, PreOverrideIRIsSharedAcrossPipelines) {
+    DAWN_TEST_UNSUPPORTED_IF(!kCachesEncodedIR);
+
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, kComputeShaderWithOverride);
+    Ref<ShaderModuleBase> shaderModule(FromAPI(module.Get()));
+    auto scopedUseTintProgram = shaderModule->UseTintProgram();
+    Ref<TintProgram> tintProgram = shaderModule->GetTintProgram();
+
+    wgpu::ComputePipeline pipeline1 = DoCreateComputePipeline(module, {{nullptr, "value", 2}});
+    EXPECT_TRUE(pipeline1);
+    uint32_t hitCount = tintProgram->GetPreOverrideIRCacheHitCountForTesting();
+
+    wgpu::ComputePipeline pipeline2 = DoCreateComputePipeline(module, {{nullptr, "value", 3}});
+    EXPECT_TRUE(pipeline2);
+    EXPECT_NE(pipeline1.Get(), pipeline2.Get());
+
+    // The second pipeline decoded the cached module instead of lowering the program again.
+    EXPECT_GT(tintProgram->GetPreOverrideIRCacheHitCountForTesting(), hitCount);
+    EXPECT_EQ(tintProgram->GetLoweringCountForTesting(), 1u);
+}
+
+// Check that only the pre-override IR of the most recently added entry points is cached.
+TEST_P(ShaderModuleTests, PreOverrideIRCacheIsBounded) {
+    DAWN_TEST_UNSUPPORTED_IF(!kCachesEncodedIR);
+
+    constexpr size_t kEntryPointCount = TintProgram::kMaxPreOverrideIREntryPoints + 1;
+    std::string shader;
+    for (size_t i = 0; i < kEntryPointCount; i++) {
+        shader += "@compute @workgroup_size(1) fn main" + std::to_string(i) + "() {}\n";
+    }
+    wgpu::ShaderModule module = utils::CreateShaderModule(device, shader.c_str());
+    Ref<ShaderModuleBase> shaderModule(FromAPI(module.Get()));
+    auto scopedUseTintProgram = shaderModule->UseTintProgram();
+    Ref<TintProgram> tintProgram = shaderModule->GetTintProgram();
+    dawn::platform::Platform* platform = FromAPI(device.Get())->GetPlatform();
+
+    auto CreatePreOverrideIR = [&](size_t entryPointIndex) {
+        auto ir = tintProgram->CreatePreOverrideIR(platform,
+                                                   "main" + std::to_string(entryPointIndex));
+        ASSERT_TRUE(ir.IsSuccess());
+        ir.AcquireSuccess();
+    };
+
+    for (size_t i = 0; i < kEntryPointCount; i++) {
+        CreatePreOverrideIR(i);
+    }
+    EXPECT_EQ(tintProgram->GetPreOverrideIRCacheHitCountForTesting(), 0u);
+
+    // The most recent entry point is still cached.
+    CreatePreOverrideIR(kEntryPointCount - 1);
+    EXPECT_EQ(tintProgram->GetPreOverrideIRCacheHitCountForTesting(), 1u);
+
+    // The first entry point was evicted.
+    CreatePreOverrideIR(0);
+    EXPECT_EQ(tintProgram->GetPreOverrideIRCacheHitCountForTesting(), 1u);
+}
+
 DAWN_INSTANTIATE_TEST(ShaderModuleTests,
                       D3D11Backend(),
                       D3D12Backend(),
@@ -0,0 +1,156 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <limits>
+#include <memory>
+
+#include "dawn/native/vulkan/CommandRecordingContextVk.h"
+#include "dawn/native/vulkan/DeviceVk.h"
+#include "dawn/native/vulkan/GPUPassTimer.h"
+#include "dawn/native/vulkan/QueueVk.h"
+#include "dawn/platform/DawnPlatform.h"
+#include "dawn/tests/DawnTest.h"
+#include "dawn/utils/WGPUHelpers.h"
+#include "partition_alloc/pointers/raw_ptr.h"
+
+namespace dawn::native::vulkan {
+namespace {
+
+// The trace macros cache the category flags in statics so they must outlive the platform.
+constexpr unsigned char kTraceCategoryEnabled = 1;
+constexpr unsigned char kTraceCategoryDisabled = 0;
+
+// Enables the GPUWork trace category, which the device needs to time passes, and counts the
+// GPUWork trace events.
+class GPUWorkTracingPlatform : public platform::Platform {
+  public:
+    const unsigned char* GetTraceCategoryEnabledFlag(platform::TraceCategory category) override {
+        return category == platform::TraceCategory::GPUWork ? &kTraceCategoryEnabled
+                                                            : &kTraceCategoryDisabled;
+    }
+
+    uint64_t AddTraceEvent(char phase,
+                           const unsigned char* categoryGroupEnabled,
+                           const char* name,
+                           uint64_t id,
+                           double timestamp,
+                           int numArgs,
+                           const char** argNames,
+                           const unsigned char* argTypes,
+                           const uint64_t* argValues,
+                           unsigned char flags) override {
+        if (categoryGroupEnabled == &kTraceCategoryEnabled) {
+            mGPUWorkEventCount++;
+        }
+        return 0;
+    }
+
+    size_t GetGPUWorkEventCount() const { return mGPUWorkEventCount; }
+
+  private:
+    size_t mGPUWorkEventCount = 0;
+};
+
+class VulkanGPUPassTimerTests : public DawnTest {
+  protected:
+    void SetUp() override {
+        DawnTest::SetUp();
+        DAWN_TEST_UNSUPPORTED_IF(UsesWire());
+
+        mDeviceVk = ToBackend(FromAPI(device.Get()));
+        mPassTimer = mDeviceVk->GetGPUPassTimer();
+        // The device only times passes if it supports timestamps on its queue.
+        DAWN_TEST_UNSUPPORTED_IF(mPassTimer == nullptr);
+    }
+
+    std::unique_ptr<platform::Platform> CreateTestPlatform() override {
+        auto platform = std::make_unique<GPUWorkTracingPlatform>();
+        mPlatform = platform.get();
+        return platform;
+    }
+
+    // Waits for the submitted work to complete and lets the timer process it.
+    void WaitAndTickPassTimer() {
+        wgpu::FutureWaitInfo waitInfo{};
+        waitInfo.future = queue.OnSubmittedWorkDone(
+            wgpu::CallbackMode::WaitAnyOnly, [](wgpu::QueueWorkDoneStatus, wgpu::StringView) {});
+        ASSERT_EQ(instance.WaitAny(1, &waitInfo, std::numeric_limits<uint64_t>::max()),
+                  wgpu::WaitStatus::Success);
+
+        auto deviceGuard = mDeviceVk->GetGuard();
+        mPassTimer->Tick(mDeviceVk->GetQueue()->GetCompletedCommandSerial());
+    }
+
+    raw_ptr<GPUWorkTracingPlatform> mPlatform;
+    raw_ptr<Device> mDeviceVk;
+    raw_ptr<GPUPassTimer> mPassTimer;
+};
+
+// Test that the duration of a pass is reported and its queries are released once its commands
+// complete.
+TEST_P(VulkanGPUPassTimerTests, PassIsReportedOnceCompleted) {
+    size_t freePassCount = mPassTimer->GetFreePassCountForTesting();
+    size_t eventCount = mPlatform->GetGPUWorkEventCount();
+
+    utils::BasicRenderPass renderPass = utils::CreateBasicRenderPass(device, 1, 1);
+    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    encoder.BeginRenderPass(&renderPass.renderPassInfo).End();
+    wgpu::CommandBuffer commands = encoder.Finish();
+    queue.Submit(1, &commands);
+
+    WaitAndTickPassTimer();
+    EXPECT_EQ(mPassTimer->GetFreePassCountForTesting(), freePassCount);
+    EXPECT_EQ(mPlatform->GetGPUWorkEventCount(), eventCount + 1);
+}
+
+// Test that a pass whose recording failed before EndPass is not read back before its commands are
+// submitted, since its queries haven't been reset yet, and that it is released once they complete.
+TEST_P(VulkanGPUPassTimerTests, PassNotEndedIsNotReadBack) {
+    size_t freePassCount = mPassTimer->GetFreePassCountForTesting();
+    size_t eventCount = mPlatform->GetGPUWorkEventCount();
+
+    {
+        auto deviceGuard = mDeviceVk->GetGuard();
+        CommandRecordingContext* recordingContext =
+            ToBackend(mDeviceVk->GetQueue())->GetPendingRecordingContext();
+        ASSERT_TRUE(mPassTimer->BeginPass(recordingContext, "RenderPass").has_value());
+
+        // Even if every serial completed, the pass isn't part of any submitted commands.
+        mPassTimer->Tick(kMaxExecutionSerial);
+        EXPECT_EQ(mPassTimer->GetFreePassCountForTesting(), freePassCount - 1);
+    }
+
+    queue.Submit(0, nullptr);
+    WaitAndTickPassTimer();
+    EXPECT_EQ(mPassTimer->GetFreePassCountForTesting(), freePassCount);
+    EXPECT_EQ(mPlatform->GetGPUWorkEventCount(), eventCount);
+}
+
+DAWN_INSTANTIATE_TEST(VulkanGPUPassTimerTests, VulkanBackend({"trace_gpu_pass_durations"}));
+
+}  // anonymous namespace
+}  // namespace dawn::native::vulkan
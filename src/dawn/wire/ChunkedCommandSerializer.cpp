@@ -29,8 +29,11 @@
 
 namespace dawn::wire {
 
-ChunkedCommandSerializer::ChunkedCommandSerializer(CommandSerializer* serializer)
-    : mSerializer(serializer), mMaxAllocationSize(serializer->GetMaximumAllocationSize()) {}
+ChunkedCommandSerializer::ChunkedCommandSerializer(CommandSerializer* serializer,
+                                                   WireInstrumentation* instrumentation)
+    : mSerializer(serializer),
+      mInstrumentation(instrumentation),
+      mMaxAllocationSize(serializer->GetMaximumAllocationSize()) {}
 
 void ChunkedCommandSerializer::SerializeChunkedCommand(const char* allocatedBuffer,
                                                        size_t remainingSize) {
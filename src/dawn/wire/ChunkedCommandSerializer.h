@@ -40,6 +40,7 @@
 #include "dawn/common/Math.h"
 #include "dawn/wire/Wire.h"
 #include "dawn/wire/WireCmd_autogen.h"
+#include "dawn/wire/WireInstrumentation.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 
 namespace dawn::wire {
@@ -73,7 +74,8 @@ WireResult SerializeCommandExtension(SerializeBuffer* serializeBuffer,
 
 class ChunkedCommandSerializer {
   public:
-    explicit ChunkedCommandSerializer(CommandSerializer* serializer);
+    explicit ChunkedCommandSerializer(CommandSerializer* serializer,
+                                      WireInstrumentation* instrumentation = nullptr);
 
     template <typename Cmd>
     void SerializeCommand(const Cmd& cmd) {
@@ -113,6 +115,10 @@ class ChunkedCommandSerializer {
                               Extensions&&... extensions) {
         size_t commandSize = cmd.GetRequiredSize();
         size_t requiredSize = (Align(extensions.size, kWireBufferAlignment) + ... + commandSize);
+        if (mInstrumentation != nullptr) {
+            mInstrumentation->RecordSentCommand(static_cast<size_t>(Cmd::kCommandId),
+                                                requiredSize);
+        }
 
         if (requiredSize <= mMaxAllocationSize) {
             char* allocatedBuffer = static_cast<char*>(mSerializer->GetCmdSpace(requiredSize));
@@ -145,6 +151,7 @@ class ChunkedCommandSerializer {
     void SerializeChunkedCommand(const char* allocatedBuffer, size_t remainingSize);
 
     raw_ptr<CommandSerializer> mSerializer;
+    raw_ptr<WireInstrumentation> mInstrumentation;
     size_t mMaxAllocationSize;
 };
 
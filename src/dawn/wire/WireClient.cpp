@@ -31,13 +31,16 @@
 namespace dawn::wire {
 
 WireClient::WireClient(const WireClientDescriptor& descriptor)
-    : mImpl(new client::Client(descriptor.serializer, descriptor.memoryTransferService)) {}
+    : mImpl(new client::Client(descriptor)) {}
 
 WireClient::~WireClient() {
     mImpl.reset();
 }
 
 const volatile char* WireClient::HandleCommands(const volatile char* commands, size_t size) {
+    if (WireInstrumentation* instrumentation = mImpl->GetInstrumentation()) {
+        instrumentation->RecordReceivedBatch(size);
+    }
     return mImpl->HandleCommands(commands, size);
 }
 
@@ -85,6 +88,19 @@ Handle WireClient::GetWireHandle(WGPUDevice device) const {
     return {wireDevice->GetWireId(), wireDevice->GetWireGeneration()};
 }
 
+WireStats WireClient::GetStats() const {
+    if (WireInstrumentation* instrumentation = mImpl->GetInstrumentation()) {
+        return instrumentation->GetStats();
+    }
+    return {};
+}
+
+void WireClient::ResetStats() {
+    if (WireInstrumentation* instrumentation = mImpl->GetInstrumentation()) {
+        instrumentation->Reset();
+    }
+}
+
 namespace client {
 MemoryTransferService::MemoryTransferService() = default;
 
@@ -28,14 +28,24 @@
 #include "dawn/wire/WireDeserializeAllocator.h"
 
 #include <algorithm>
+#include <cstdlib>
+
+#include "dawn/common/Assert.h"
 
 namespace dawn::wire {
-WireDeserializeAllocator::WireDeserializeAllocator() {
-    Reset();
-}
+
+namespace {
+// Heap blocks grow geometrically up to this size so that a burst of large commands ends up in a
+// small number of blocks. Single allocations larger than this get a block of their own size.
+constexpr size_t kMaxGrowthBlockSize = 1024 * 1024;
+}  // anonymous namespace
+
+// The constructor doesn't call Reset() so that it doesn't count towards the trim period.
+WireDeserializeAllocator::WireDeserializeAllocator()
+    : mRemainingSize(sizeof(mStaticBuffer)), mCurrentBuffer(mStaticBuffer) {}
 
 WireDeserializeAllocator::~WireDeserializeAllocator() {
-    Reset();
+    FreeBlocksFrom(0);
 }
 
 void* WireDeserializeAllocator::GetSpace(size_t size) {
@@ -44,30 +54,78 @@ void* WireDeserializeAllocator::GetSpace(size_t size) {
         char* buffer = mCurrentBuffer;
         mCurrentBuffer += size;
         mRemainingSize -= size;
+        mBytesInUse += size;
         return buffer;
     }
 
-    // Otherwise allocate a new buffer and try again.
-    size_t allocationSize = std::max(size, size_t(2048));
-    char* allocation = static_cast<char*>(malloc(allocationSize));
-    if (allocation == nullptr) {
+    // Otherwise move to the next retained block, growing it if needed, and try again.
+    if (!UseBlock(mNextBlock, size)) {
         return nullptr;
     }
-
-    mAllocations.push_back(allocation);
-    mCurrentBuffer = allocation;
-    mRemainingSize = allocationSize;
+    mNextBlock++;
     return GetSpace(size);
 }
 
+bool WireDeserializeAllocator::UseBlock(size_t index, size_t size) {
+    DAWN_ASSERT(index <= mBlocks.size());
+
+    if (index == mBlocks.size() || mBlocks[index].size < size) {
+        size_t previousSize = index == 0 ? sizeof(mStaticBuffer) : mBlocks[index - 1].size;
+        size_t allocationSize =
+            std::max(size, std::max(sizeof(mStaticBuffer),
+                                    std::min(previousSize * 2, kMaxGrowthBlockSize)));
+        char* allocation = static_cast<char*>(malloc(allocationSize));
+        if (allocation == nullptr) {
+            return false;
+        }
+        mStats.heapAllocationCount++;
+        mStats.retainedBytes += allocationSize;
+
+        if (index == mBlocks.size()) {
+            mBlocks.push_back({allocation, allocationSize});
+        } else {
+            // The retained block is too small, replace it with the larger one.
+            mStats.heapFreeCount++;
+            mStats.retainedBytes -= mBlocks[index].size;
+            free(mBlocks[index].data.ExtractAsDangling());
+            mBlocks[index] = {allocation, allocationSize};
+        }
+    }
+
+    mCurrentBuffer = mBlocks[index].data.get();
+    mRemainingSize = mBlocks[index].size;
+    return true;
+}
+
+void WireDeserializeAllocator::FreeBlocksFrom(size_t index) {
+    for (size_t i = index; i < mBlocks.size(); ++i) {
+        mStats.heapFreeCount++;
+        mStats.retainedBytes -= mBlocks[i].size;
+        free(mBlocks[i].data.ExtractAsDangling());
+    }
+    mBlocks.resize(std::min(index, mBlocks.size()));
+}
+
 void WireDeserializeAllocator::Reset() {
+    mStats.peakBytesInUse = std::max(mStats.peakBytesInUse, mBytesInUse);
+    mMaxBlocksUsedInPeriod = std::max(mMaxBlocksUsedInPeriod, mNextBlock);
+
+    // Periodically drop the blocks that weren't needed by any command in the last period.
+    if (++mResetsInPeriod >= kTrimPeriod) {
+        FreeBlocksFrom(mMaxBlocksUsedInPeriod);
+        mMaxBlocksUsedInPeriod = 0;
+        mResetsInPeriod = 0;
+    }
+
     // The initial buffer is the inline buffer so that some allocations can be skipped
     mCurrentBuffer = mStaticBuffer;
     mRemainingSize = sizeof(mStaticBuffer);
+    mNextBlock = 0;
+    mBytesInUse = 0;
+}
 
-    for (auto& allocation : mAllocations) {
-        free(allocation.ExtractAsDangling());
-    }
-    mAllocations.clear();
+const WireDeserializeAllocator::Stats& WireDeserializeAllocator::GetStats() const {
+    return mStats;
 }
+
 }  // namespace dawn::wire
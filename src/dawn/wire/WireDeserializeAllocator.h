@@ -28,17 +28,33 @@
 #ifndef SRC_DAWN_WIRE_WIREDESERIALIZEALLOCATOR_H_
 #define SRC_DAWN_WIRE_WIREDESERIALIZEALLOCATOR_H_
 
+#include <cstdint>
 #include <vector>
 
 #include "dawn/wire/WireCmd_autogen.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 
 namespace dawn::wire {
-// A really really simple implementation of the DeserializeAllocator. It's main feature
-// is that it has some inline storage so as to avoid allocations for the majority of
-// commands.
+// A simple arena implementation of the DeserializeAllocator. It has some inline storage so as to
+// avoid allocations for the majority of commands. Larger commands are served from heap blocks that
+// are retained across calls to Reset() so that steady-state deserialization does not allocate.
+// Blocks that haven't been needed for a while are trimmed so that a single very large command
+// doesn't pin its memory forever.
 class WireDeserializeAllocator : public DeserializeAllocator {
   public:
+    // The number of calls to Reset() over which the high-water mark of the number of blocks used
+    // is computed. Blocks above that high-water mark are freed at the end of each period.
+    static constexpr uint32_t kTrimPeriod = 256;
+
+    struct Stats {
+        uint64_t heapAllocationCount = 0;
+        uint64_t heapFreeCount = 0;
+        // Bytes of heap memory currently retained, not counting the inline storage.
+        size_t retainedBytes = 0;
+        // The most bytes used to deserialize a single command.
+        size_t peakBytesInUse = 0;
+    };
+
     WireDeserializeAllocator();
     virtual ~WireDeserializeAllocator();
 
@@ -46,11 +62,34 @@ class WireDeserializeAllocator : public DeserializeAllocator {
 
     void Reset();
 
+    const Stats& GetStats() const;
+
   private:
+    struct Block {
+        raw_ptr<char> data;
+        size_t size;
+    };
+
+    // Makes mBlocks[index] the current buffer, replacing it with a larger one (or appending a new
+    // one) if it is too small to fit |size| bytes. Returns false on OOM.
+    bool UseBlock(size_t index, size_t size);
+    void FreeBlocksFrom(size_t index);
+
     size_t mRemainingSize = 0;
     raw_ptr<char, AllowPtrArithmetic> mCurrentBuffer = nullptr;
     char mStaticBuffer[2048];
-    std::vector<raw_ptr<char>> mAllocations;
+
+    // Heap blocks retained across Reset(). mNextBlock is the index of the block to use once the
+    // current buffer is exhausted.
+    std::vector<Block> mBlocks;
+    size_t mNextBlock = 0;
+    size_t mBytesInUse = 0;
+
+    // The maximum number of heap blocks used by a single command in the current trim period.
+    size_t mMaxBlocksUsedInPeriod = 0;
+    uint32_t mResetsInPeriod = 0;
+
+    Stats mStats;
 };
 }  // namespace dawn::wire
 
@@ -0,0 +1,178 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/wire/WireInstrumentation.h"
+
+#include <vector>
+
+#include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/tracing/TraceEvent.h"
+
+namespace dawn::wire {
+
+namespace {
+
+const char* WireCmdName(size_t commandId) {
+    return GetWireCmdName(static_cast<WireCmd>(commandId));
+}
+
+const char* ReturnWireCmdName(size_t commandId) {
+    return GetReturnWireCmdName(static_cast<ReturnWireCmd>(commandId));
+}
+
+}  // anonymous namespace
+
+WireInstrumentation::WireInstrumentation(size_t sentCommandCount,
+                                         CommandNameFn sentCommandName,
+                                         size_t receivedCommandCount,
+                                         CommandNameFn receivedCommandName)
+    : mSentCommandCount(sentCommandCount),
+      mSentCommandName(sentCommandName),
+      mSent(new Counters[sentCommandCount]),
+      mReceivedCommandCount(receivedCommandCount),
+      mReceivedCommandName(receivedCommandName),
+      mReceived(new Counters[receivedCommandCount]) {}
+
+WireInstrumentation::~WireInstrumentation() = default;
+
+// static
+std::unique_ptr<WireInstrumentation> WireInstrumentation::CreateForClient() {
+    return std::make_unique<WireInstrumentation>(kWireCmdCount, WireCmdName, kReturnWireCmdCount,
+                                                 ReturnWireCmdName);
+}
+
+// static
+std::unique_ptr<WireInstrumentation> WireInstrumentation::CreateForServer() {
+    return std::make_unique<WireInstrumentation>(kReturnWireCmdCount, ReturnWireCmdName,
+                                                 kWireCmdCount, WireCmdName);
+}
+
+void WireInstrumentation::RecordSentCommand(size_t commandId, size_t size) {
+    if (commandId >= mSentCommandCount) {
+        return;
+    }
+    mSent[commandId].count.fetch_add(1, std::memory_order_relaxed);
+    mSent[commandId].bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void WireInstrumentation::RecordReceivedCommand(size_t commandId,
+                                                size_t size,
+                                                uint64_t handleTimeNs) {
+    if (commandId >= mReceivedCommandCount) {
+        return;
+    }
+    mReceived[commandId].count.fetch_add(1, std::memory_order_relaxed);
+    mReceived[commandId].bytes.fetch_add(size, std::memory_order_relaxed);
+    mReceived[commandId].handleTimeNs.fetch_add(handleTimeNs, std::memory_order_relaxed);
+}
+
+void WireInstrumentation::RecordReceivedBatch(size_t size) {
+    mReceivedBatchCount.fetch_add(1, std::memory_order_relaxed);
+    mReceivedBatchBytes.fetch_add(size, std::memory_order_relaxed);
+
+    uint64_t previousMax = mMaxReceivedBatchBytes.load(std::memory_order_relaxed);
+    while (previousMax < size && !mMaxReceivedBatchBytes.compare_exchange_weak(
+                                     previousMax, size, std::memory_order_relaxed)) {
+    }
+}
+
+WireStats WireInstrumentation::GetStats() const {
+    auto CollectCommands = [](const Counters* counters, size_t commandCount,
+                              CommandNameFn commandName) {
+        std::vector<WireCommandStats> commands;
+        for (size_t i = 0; i < commandCount; ++i) {
+            uint64_t count = counters[i].count.load(std::memory_order_relaxed);
+            if (count == 0) {
+                continue;
+            }
+            WireCommandStats stats;
+            stats.name = commandName(i);
+            stats.count = count;
+            stats.bytes = counters[i].bytes.load(std::memory_order_relaxed);
+            stats.handleTimeNs = counters[i].handleTimeNs.load(std::memory_order_relaxed);
+            commands.push_back(stats);
+        }
+        return commands;
+    };
+
+    WireStats stats;
+    stats.sentCommands = CollectCommands(mSent.get(), mSentCommandCount, mSentCommandName);
+    stats.receivedCommands =
+        CollectCommands(mReceived.get(), mReceivedCommandCount, mReceivedCommandName);
+    stats.receivedBatchCount = mReceivedBatchCount.load(std::memory_order_relaxed);
+    stats.receivedBatchBytes = mReceivedBatchBytes.load(std::memory_order_relaxed);
+    stats.maxReceivedBatchBytes = mMaxReceivedBatchBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void WireInstrumentation::Reset() {
+    auto ResetCommands = [](Counters* counters, size_t commandCount) {
+        for (size_t i = 0; i < commandCount; ++i) {
+            counters[i].count.store(0, std::memory_order_relaxed);
+            counters[i].bytes.store(0, std::memory_order_relaxed);
+            counters[i].handleTimeNs.store(0, std::memory_order_relaxed);
+        }
+    };
+    ResetCommands(mSent.get(), mSentCommandCount);
+    ResetCommands(mReceived.get(), mReceivedCommandCount);
+    mReceivedBatchCount.store(0, std::memory_order_relaxed);
+    mReceivedBatchBytes.store(0, std::memory_order_relaxed);
+    mMaxReceivedBatchBytes.store(0, std::memory_order_relaxed);
+}
+
+ScopedReceivedCommand::ScopedReceivedCommand(WireInstrumentation* instrumentation,
+                                             platform::Platform* platform,
+                                             size_t commandId,
+                                             const char* commandName,
+                                             size_t commandSize)
+    : mInstrumentation(instrumentation),
+      mPlatform(platform),
+      mCommandId(commandId),
+      mCommandName(commandName),
+      mCommandSize(commandSize) {
+    if (mInstrumentation != nullptr) {
+        mStart = std::chrono::steady_clock::now();
+    }
+    if (mPlatform != nullptr) {
+        TRACE_EVENT_BEGIN1(mPlatform.get(), General, mCommandName, "size",
+                           static_cast<uint64_t>(mCommandSize));
+    }
+}
+
+ScopedReceivedCommand::~ScopedReceivedCommand() {
+    if (mPlatform != nullptr) {
+        TRACE_EVENT_END0(mPlatform.get(), General, mCommandName);
+    }
+    if (mInstrumentation != nullptr) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - mStart);
+        mInstrumentation->RecordReceivedCommand(mCommandId, mCommandSize,
+                                                static_cast<uint64_t>(elapsed.count()));
+    }
+}
+
+}  // namespace dawn::wire
@@ -0,0 +1,112 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_WIRE_WIREINSTRUMENTATION_H_
+#define SRC_DAWN_WIRE_WIREINSTRUMENTATION_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "dawn/common/NonMovable.h"
+#include "dawn/wire/Wire.h"
+#include "dawn/wire/WireCmd_autogen.h"
+#include "partition_alloc/pointers/raw_ptr.h"
+
+namespace dawn::platform {
+class Platform;
+}  // namespace dawn::platform
+
+namespace dawn::wire {
+
+// Counts the commands and bytes going through one side of the wire. Counters are relaxed atomics
+// because commands may be serialized from a different thread than the one handling commands.
+class WireInstrumentation {
+  public:
+    using CommandNameFn = const char* (*)(size_t);
+
+    WireInstrumentation(size_t sentCommandCount,
+                        CommandNameFn sentCommandName,
+                        size_t receivedCommandCount,
+                        CommandNameFn receivedCommandName);
+    ~WireInstrumentation();
+
+    static std::unique_ptr<WireInstrumentation> CreateForClient();
+    static std::unique_ptr<WireInstrumentation> CreateForServer();
+
+    void RecordSentCommand(size_t commandId, size_t size);
+    void RecordReceivedCommand(size_t commandId, size_t size, uint64_t handleTimeNs);
+    void RecordReceivedBatch(size_t size);
+
+    WireStats GetStats() const;
+    void Reset();
+
+  private:
+    struct Counters {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> bytes{0};
+        std::atomic<uint64_t> handleTimeNs{0};
+    };
+
+    const size_t mSentCommandCount;
+    const CommandNameFn mSentCommandName;
+    std::unique_ptr<Counters[]> mSent;
+
+    const size_t mReceivedCommandCount;
+    const CommandNameFn mReceivedCommandName;
+    std::unique_ptr<Counters[]> mReceived;
+
+    std::atomic<uint64_t> mReceivedBatchCount{0};
+    std::atomic<uint64_t> mReceivedBatchBytes{0};
+    std::atomic<uint64_t> mMaxReceivedBatchBytes{0};
+};
+
+// Records the size and the handling time of one received command, and wraps its handling in a
+// trace event if a platform is provided. Does nothing if both |instrumentation| and |platform|
+// are null.
+class ScopedReceivedCommand : NonMovable {
+  public:
+    ScopedReceivedCommand(WireInstrumentation* instrumentation,
+                          platform::Platform* platform,
+                          size_t commandId,
+                          const char* commandName,
+                          size_t commandSize);
+    ~ScopedReceivedCommand();
+
+  private:
+    raw_ptr<WireInstrumentation> mInstrumentation;
+    raw_ptr<platform::Platform> mPlatform;
+    size_t mCommandId;
+    const char* mCommandName;
+    size_t mCommandSize;
+    std::chrono::steady_clock::time_point mStart;
+};
+
+}  // namespace dawn::wire
+
+#endif  // SRC_DAWN_WIRE_WIREINSTRUMENTATION_H_
@@ -26,20 +26,27 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "dawn/wire/WireServer.h"
+
+#include "dawn/platform/DawnPlatform.h"
+#include "dawn/platform/tracing/TraceEvent.h"
 #include "dawn/wire/server/Server.h"
 
 namespace dawn::wire {
 
 WireServer::WireServer(const WireServerDescriptor& descriptor)
-    : mImpl(server::Server::Create(*descriptor.procs,
-                                   descriptor.serializer,
-                                   descriptor.memoryTransferService)) {}
+    : mImpl(server::Server::Create(descriptor)) {}
 
 WireServer::~WireServer() {
     mImpl.reset();
 }
 
 const volatile char* WireServer::HandleCommands(const volatile char* commands, size_t size) {
+    if (platform::Platform* platform = mImpl->GetPlatform()) {
+        TRACE_COUNTER1(platform, General, "WireServer::ReceivedBatchBytes", size);
+    }
+    if (WireInstrumentation* instrumentation = mImpl->GetInstrumentation()) {
+        instrumentation->RecordReceivedBatch(size);
+    }
     return mImpl->HandleCommands(commands, size);
 }
 
@@ -71,6 +78,23 @@ bool WireServer::IsDeviceKnown(WGPUDevice device) const {
     return mImpl->IsDeviceKnown(device);
 }
 
+WireDeserializeAllocatorStats WireServer::GetDeserializeAllocatorStats() const {
+    return mImpl->GetDeserializeAllocatorStats();
+}
+
+WireStats WireServer::GetStats() const {
+    if (WireInstrumentation* instrumentation = mImpl->GetInstrumentation()) {
+        return instrumentation->GetStats();
+    }
+    return {};
+}
+
+void WireServer::ResetStats() {
+    if (WireInstrumentation* instrumentation = mImpl->GetInstrumentation()) {
+        instrumentation->Reset();
+    }
+}
+
 namespace server {
 MemoryTransferService::MemoryTransferService() = default;
 
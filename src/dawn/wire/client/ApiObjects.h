@@ -34,6 +34,7 @@
 #include "dawn/wire/client/Buffer.h"
 #include "dawn/wire/client/ComputePassEncoder.h"
 #include "dawn/wire/client/Device.h"
+#include "dawn/wire/client/ImmutableObject.h"
 #include "dawn/wire/client/Instance.h"
 #include "dawn/wire/client/QuerySet.h"
 #include "dawn/wire/client/Queue.h"
@@ -51,8 +51,18 @@ class NoopCommandSerializer final : public CommandSerializer {
 
 }  // anonymous namespace
 
-Client::Client(CommandSerializer* serializer, MemoryTransferService* memoryTransferService)
-    : ClientBase(), mSerializer(serializer), mMemoryTransferService(memoryTransferService) {
+Client::Client(const WireClientDescriptor& descriptor)
+    : ClientBase(),
+      mInstrumentation(descriptor.enableInstrumentation ? WireInstrumentation::CreateForClient()
+                                                        : nullptr),
+      mSerializer(descriptor.serializer, mInstrumentation.get()),
+      mMemoryTransferService(descriptor.memoryTransferService),
+      mWriteTransferRingSize(descriptor.writeTransferRingSize),
+      mWriteTransferThreshold(descriptor.writeTransferThreshold),
+      mDeduplicateImmutableObjects(descriptor.deduplicateImmutableObjects) {
+    if (descriptor.shaderSourceCacheSize != 0) {
+        mShaderSourceCache = std::make_unique<ShaderSourceCache>(descriptor.shaderSourceCacheSize);
+    }
     if (mMemoryTransferService == nullptr) {
         // If a MemoryTransferService is not provided, fall back to inline memory.
         mOwnedMemoryTransferService = CreateInlineMemoryTransferService();
@@ -70,6 +80,7 @@ Client::~Client() {
 }
 
 void Client::UnregisterAllObjects() {
+    mImmutableObjectCache.clear();
     for (auto& objectList : mObjects) {
         for (auto object : objectList.GetAllObjects()) {
             if (object != nullptr) {
@@ -189,6 +200,38 @@ void Client::Unregister(ObjectBase* obj, ObjectType type) {
     ReclaimReservation(obj, type);
 }
 
+void Client::RemoveFromImmutableObjectCache(const std::string& key, ObjectBase* object) {
+    auto it = mImmutableObjectCache.find(key);
+    if (it != mImmutableObjectCache.end() && it->second == object) {
+        mImmutableObjectCache.erase(it);
+    }
+}
+
+std::optional<uint64_t> Client::GetShaderSourceId(std::string_view source) {
+    ShaderSourceCache::Lookup lookup;
+    if (mShaderSourceCache == nullptr || !mShaderSourceCache->GetOrInsert(source, &lookup)) {
+        return std::nullopt;
+    }
+
+    // Release the evicted sources before registering the new one so that the server never holds
+    // more than the budget.
+    for (uint64_t evictedId : lookup.evictedIds) {
+        ShaderSourceReleaseCmd cmd;
+        cmd.sourceId = evictedId;
+        SerializeCommand(cmd);
+    }
+
+    if (lookup.isNew) {
+        ShaderSourceRegisterCmd cmd;
+        cmd.sourceId = lookup.id;
+        cmd.data = reinterpret_cast<const uint8_t*>(source.data());
+        cmd.size = source.size();
+        SerializeCommand(cmd);
+    }
+
+    return lookup.id;
+}
+
 void Client::ReclaimReservation(ObjectBase* obj, ObjectType type) {
     mObjects[type].Remove(obj);
 }
@@ -31,7 +31,11 @@
 #include <webgpu/webgpu.h>
 
 #include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include "absl/container/flat_hash_map.h"
 #include "dawn/common/LinkedList.h"
@@ -41,9 +45,11 @@
 #include "dawn/wire/WireClient.h"
 #include "dawn/wire/WireCmd_autogen.h"
 #include "dawn/wire/WireDeserializeAllocator.h"
+#include "dawn/wire/WireInstrumentation.h"
 #include "dawn/wire/client/ClientBase_autogen.h"
 #include "dawn/wire/client/EventManager.h"
 #include "dawn/wire/client/ObjectStore.h"
+#include "dawn/wire/client/ShaderSourceCache.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 
 namespace dawn::wire::client {
@@ -54,7 +60,7 @@ class EventManager;
 
 class Client : public ClientBase {
   public:
-    Client(CommandSerializer* serializer, MemoryTransferService* memoryTransferService);
+    explicit Client(const WireClientDescriptor& descriptor);
     ~Client() override;
 
     // Make<T>(arg1, arg2, arg3) creates a new T, calling a constructor of the form:
@@ -83,6 +89,11 @@ class Client : public ClientBase {
     const volatile char* HandleCommandsImpl(const volatile char* commands, size_t size) override;
 
     MemoryTransferService* GetMemoryTransferService() const { return mMemoryTransferService; }
+    size_t GetWriteTransferRingSize() const { return mWriteTransferRingSize; }
+    size_t GetWriteTransferThreshold() const { return mWriteTransferThreshold; }
+
+    // Returns nullptr when instrumentation is disabled.
+    WireInstrumentation* GetInstrumentation() const { return mInstrumentation.get(); }
 
     ReservedBuffer ReserveBuffer(WGPUDevice device, const WGPUBufferDescriptor* descriptor);
     ReservedTexture ReserveTexture(WGPUDevice device, const WGPUTextureDescriptor* descriptor);
@@ -105,6 +116,41 @@ class Client : public ClientBase {
         mSerializer.SerializeCommand(cmd, *this, std::forward<Extensions>(es)...);
     }
 
+    // Creates the immutable object T with |cmd|, a creation command whose result is not set yet.
+    // When deduplication is enabled and a live object was created by an identical command, a new
+    // reference to that object is returned instead and nothing is sent to the server.
+    // |referencedObjects| must contain all the objects referenced by |cmd| (null entries are
+    // allowed) because the command only contains their ObjectIds, which are recycled.
+    template <typename T, typename Cmd>
+    T* GetOrCreateImmutableObject(Cmd* cmd, const std::vector<ObjectBase*>& referencedObjects) {
+        std::string key;
+        if (mDeduplicateImmutableObjects) {
+            cmd->result = {};
+            key = ComputeImmutableObjectCacheKey(*cmd, referencedObjects);
+            auto it = mImmutableObjectCache.find(key);
+            if (it != mImmutableObjectCache.end()) {
+                T* object = static_cast<T*>(it->second.get());
+                object->AddRef();
+                return object;
+            }
+        }
+
+        Ref<T> object = Make<T>();
+        cmd->result = object->GetWireHandle();
+        SerializeCommand(*cmd);
+
+        if (!key.empty()) {
+            mImmutableObjectCache.emplace(key, object.Get());
+            object->SetCacheKey(std::move(key));
+        }
+        return object.Detach();
+    }
+    void RemoveFromImmutableObjectCache(const std::string& key, ObjectBase* object);
+
+    // Returns the ID under which the server keeps |source|, registering it first if needed, or
+    // std::nullopt if the source must be sent inline.
+    std::optional<uint64_t> GetShaderSourceId(std::string_view source);
+
     EventManager& GetEventManager(const ObjectHandle& instance);
 
     void Disconnect();
@@ -119,13 +165,46 @@ class Client : public ClientBase {
         ReclaimReservation(obj, ObjectTypeToTypeEnum<T>);
     }
 
+    // The key is the serialized command, which covers the type of the object, its parent device
+    // and every member of the descriptor including the ids of the objects it references. The
+    // generations of the referenced objects are appended so that an object whose id was recycled
+    // doesn't match the entries created with the previous owner of the id. The key is empty if
+    // the command cannot be serialized.
+    template <typename Cmd>
+    std::string ComputeImmutableObjectCacheKey(
+        const Cmd& cmd,
+        const std::vector<ObjectBase*>& referencedObjects) const {
+        size_t requiredSize = cmd.GetRequiredSize();
+        // Zero-initialized so that the padding in the serialized structures is deterministic.
+        std::string key(requiredSize, '\0');
+        SerializeBuffer serializeBuffer(key.data(), requiredSize);
+        if (cmd.Serialize(requiredSize, &serializeBuffer, *this) != WireResult::Success) {
+            return {};
+        }
+        for (ObjectBase* object : referencedObjects) {
+            ObjectGeneration generation = object != nullptr ? object->GetWireGeneration() : 0;
+            key.append(reinterpret_cast<const char*>(&generation), sizeof(generation));
+        }
+        return key;
+    }
+
 #include "dawn/wire/client/ClientPrototypes_autogen.inc"
 
+    // Must be declared before mSerializer which keeps a pointer to it.
+    std::unique_ptr<WireInstrumentation> mInstrumentation;
     ChunkedCommandSerializer mSerializer;
     WireDeserializeAllocator mWireCommandAllocator;
     PerObjectType<ObjectStore> mObjects;
     std::unique_ptr<MemoryTransferService> mOwnedMemoryTransferService = nullptr;
     raw_ptr<MemoryTransferService> mMemoryTransferService = nullptr;
+    const size_t mWriteTransferRingSize;
+    const size_t mWriteTransferThreshold;
+    const bool mDeduplicateImmutableObjects;
+    // Live immutable objects created with deduplication enabled, keyed by their creation command.
+    // Objects remove themselves when they are deleted.
+    absl::flat_hash_map<std::string, raw_ptr<ObjectBase>> mImmutableObjectCache;
+    // Null when shader source caching is disabled.
+    std::unique_ptr<ShaderSourceCache> mShaderSourceCache;
     // Map of instance object handles to a corresponding event manager. Note that for now because we
     // do not have an internal refcount on the instances, i.e. we don't know when the last object
     // associated with a particular instance is destroyed, this map is not cleaned up until the
@@ -28,8 +28,11 @@
 #include "dawn/wire/client/Device.h"
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include "dawn/common/Assert.h"
 #include "dawn/common/Log.h"
@@ -37,6 +40,8 @@
 #include "dawn/wire/client/ApiObjects_autogen.h"
 #include "dawn/wire/client/Client.h"
 #include "dawn/wire/client/EventManager.h"
+#include "dawn/wire/client/ImmutableObject.h"
+#include "dawn/wire/client/ShaderModule.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 
 namespace dawn::wire::client {
@@ -397,6 +402,84 @@ WGPUBuffer Device::APICreateErrorBuffer(const WGPUBufferDescriptor* descriptor)
     return Buffer::CreateError(this, descriptor);
 }
 
+WGPUBindGroupLayout Device::APICreateBindGroupLayout(
+    const WGPUBindGroupLayoutDescriptor* descriptor) {
+    DeviceCreateBindGroupLayoutCmd cmd;
+    cmd.self = ToAPI(this);
+    cmd.descriptor = descriptor;
+
+    // Static samplers are the only objects referenced by the entries.
+    std::vector<ObjectBase*> referencedObjects = {this};
+    for (size_t i = 0; i < descriptor->entryCount; ++i) {
+        for (const WGPUChainedStruct* chain = descriptor->entries[i].nextInChain;
+             chain != nullptr; chain = chain->next) {
+            if (chain->sType == WGPUSType_StaticSamplerBindingLayout) {
+                const auto* staticSampler =
+                    reinterpret_cast<const WGPUStaticSamplerBindingLayout*>(chain);
+                referencedObjects.push_back(FromAPI(staticSampler->sampler));
+            }
+        }
+    }
+    return ToAPI(
+        GetClient()->GetOrCreateImmutableObject<BindGroupLayout>(&cmd, referencedObjects));
+}
+
+WGPUPipelineLayout Device::APICreatePipelineLayout(
+    const WGPUPipelineLayoutDescriptor* descriptor) {
+    DeviceCreatePipelineLayoutCmd cmd;
+    cmd.self = ToAPI(this);
+    cmd.descriptor = descriptor;
+
+    std::vector<ObjectBase*> referencedObjects = {this};
+    for (size_t i = 0; i < descriptor->bindGroupLayoutCount; ++i) {
+        referencedObjects.push_back(FromAPI(descriptor->bindGroupLayouts[i]));
+    }
+    return ToAPI(GetClient()->GetOrCreateImmutableObject<PipelineLayout>(&cmd, referencedObjects));
+}
+
+WGPUSampler Device::APICreateSampler(const WGPUSamplerDescriptor* descriptor) {
+    DeviceCreateSamplerCmd cmd;
+    cmd.self = ToAPI(this);
+    cmd.descriptor = descriptor;
+    return ToAPI(GetClient()->GetOrCreateImmutableObject<Sampler>(&cmd, {this}));
+}
+
+WGPUShaderModule Device::APICreateShaderModule(const WGPUShaderModuleDescriptor* descriptor) {
+    Client* client = GetClient();
+    Ref<ShaderModule> shaderModule = client->Make<ShaderModule>(GetEventManagerHandle());
+
+    // Only descriptors containing nothing but WGSL source can use the server's source cache.
+    std::optional<uint64_t> sourceId;
+    const WGPUChainedStruct* chain = descriptor->nextInChain;
+    if (chain != nullptr && chain->sType == WGPUSType_ShaderSourceWGSL && chain->next == nullptr) {
+        const auto* wgslDesc = reinterpret_cast<const WGPUShaderSourceWGSL*>(chain);
+        std::string_view code;
+        if (wgslDesc->code.data != nullptr) {
+            code = wgslDesc->code.length == WGPU_STRLEN
+                       ? std::string_view(wgslDesc->code.data)
+                       : std::string_view(wgslDesc->code.data, wgslDesc->code.length);
+        }
+        sourceId = client->GetShaderSourceId(code);
+    }
+
+    if (sourceId) {
+        DeviceCreateShaderModuleFromSourceCmd cmd;
+        cmd.deviceId = GetWireId();
+        cmd.label = descriptor->label;
+        cmd.sourceId = *sourceId;
+        cmd.result = shaderModule->GetWireHandle();
+        client->SerializeCommand(cmd);
+    } else {
+        DeviceCreateShaderModuleCmd cmd;
+        cmd.self = ToAPI(this);
+        cmd.descriptor = descriptor;
+        cmd.result = shaderModule->GetWireHandle();
+        client->SerializeCommand(cmd);
+    }
+
+    return ReturnToAPI(std::move(shaderModule));
+}
+
 WGPUAdapter Device::APIGetAdapter() const {
     Ref<Adapter> adapter = mAdapter;
     return ReturnToAPI(std::move(adapter));
@@ -71,6 +71,10 @@ class Device final : public RefCountedWithExternalCount<ObjectWithEventsBase> {
 
     WGPUBuffer APICreateBuffer(const WGPUBufferDescriptor* descriptor);
     WGPUBuffer APICreateErrorBuffer(const WGPUBufferDescriptor* descriptor);
+    WGPUBindGroupLayout APICreateBindGroupLayout(const WGPUBindGroupLayoutDescriptor* descriptor);
+    WGPUPipelineLayout APICreatePipelineLayout(const WGPUPipelineLayoutDescriptor* descriptor);
+    WGPUSampler APICreateSampler(const WGPUSamplerDescriptor* descriptor);
+    WGPUShaderModule APICreateShaderModule(const WGPUShaderModuleDescriptor* descriptor);
     WGPUFuture APICreateComputePipelineAsync(
         WGPUComputePipelineDescriptor const* descriptor,
         const WGPUCreateComputePipelineAsyncCallbackInfo& callbackInfo);
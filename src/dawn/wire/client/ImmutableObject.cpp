@@ -0,0 +1,62 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/wire/client/ImmutableObject.h"
+
+#include <utility>
+
+#include "dawn/wire/client/Client.h"
+
+namespace dawn::wire::client {
+
+void ImmutableObjectBase::SetCacheKey(std::string key) {
+    DAWN_ASSERT(mCacheKey.empty());
+    mCacheKey = std::move(key);
+}
+
+void ImmutableObjectBase::DeleteThis() {
+    // The object is no longer registered if the client was destroyed first, in which case the
+    // cache is gone too.
+    if (!mCacheKey.empty() && IsRegistered()) {
+        GetClient()->RemoveFromImmutableObjectCache(mCacheKey, this);
+    }
+    ObjectBase::DeleteThis();
+}
+
+ObjectType BindGroupLayout::GetObjectType() const {
+    return ObjectType::BindGroupLayout;
+}
+
+ObjectType PipelineLayout::GetObjectType() const {
+    return ObjectType::PipelineLayout;
+}
+
+ObjectType Sampler::GetObjectType() const {
+    return ObjectType::Sampler;
+}
+
+}  // namespace dawn::wire::client
@@ -0,0 +1,79 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_WIRE_CLIENT_IMMUTABLEOBJECT_H_
+#define SRC_DAWN_WIRE_CLIENT_IMMUTABLEOBJECT_H_
+
+#include <string>
+
+#include "dawn/wire/client/ObjectBase.h"
+
+namespace dawn::wire::client {
+
+// Base class for objects that cannot be modified after creation, such that two objects created
+// with the same command are interchangeable. When WireClientDescriptor::deduplicateImmutableObjects
+// is set, the Client keeps them in a cache keyed by their serialized creation command and hands out
+// new references to the existing object instead of creating another one on the server.
+class ImmutableObjectBase : public ObjectBase {
+  public:
+    using ObjectBase::ObjectBase;
+
+    // Records the key under which the object is in the Client's cache so that it can be removed
+    // when the object is deleted.
+    void SetCacheKey(std::string key);
+
+  protected:
+    void DeleteThis() override;
+
+  private:
+    std::string mCacheKey;
+};
+
+class BindGroupLayout final : public ImmutableObjectBase {
+  public:
+    using ImmutableObjectBase::ImmutableObjectBase;
+
+    ObjectType GetObjectType() const override;
+};
+
+class PipelineLayout final : public ImmutableObjectBase {
+  public:
+    using ImmutableObjectBase::ImmutableObjectBase;
+
+    ObjectType GetObjectType() const override;
+};
+
+class Sampler final : public ImmutableObjectBase {
+  public:
+    using ImmutableObjectBase::ImmutableObjectBase;
+
+    ObjectType GetObjectType() const override;
+};
+
+}  // namespace dawn::wire::client
+
+#endif  // SRC_DAWN_WIRE_CLIENT_IMMUTABLEOBJECT_H_
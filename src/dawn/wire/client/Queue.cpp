@@ -27,6 +27,7 @@
 
 #include "dawn/wire/client/Queue.h"
 
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
@@ -116,12 +117,118 @@ WGPUFuture Queue::APIOnSubmittedWorkDone(const WGPUQueueWorkDoneCallbackInfo& ca
     return {futureIDInternal};
 }
 
+WireResult Client::DoQueueTransferRingConsumed(Queue* queue, uint64_t ringPosition) {
+    if (queue == nullptr) {
+        // The queue might have been deleted or recreated so this isn't an error.
+        return WireResult::Success;
+    }
+    queue->OnTransferRingConsumed(ringPosition);
+    return WireResult::Success;
+}
+
+void Queue::OnTransferRingConsumed(uint64_t ringPosition) {
+    // The server consumes the ring in order, so positions are only ever increasing.
+    if (ringPosition > mTransferRingConsumedPosition && ringPosition <= mTransferRingPosition) {
+        mTransferRingConsumedPosition = ringPosition;
+    }
+}
+
+bool Queue::EnsureTransferRing() {
+    if (mTransferRing != nullptr) {
+        return true;
+    }
+    if (mTransferRingCreationFailed) {
+        return false;
+    }
+
+    Client* client = GetClient();
+    size_t ringSize = client->GetWriteTransferRingSize();
+    std::unique_ptr<MemoryTransferService::WriteHandle> ring(
+        client->GetMemoryTransferService()->CreateWriteHandle(ringSize));
+    if (ring == nullptr || ring->GetData() == nullptr) {
+        // Don't try again, all the writes will go inline in the command stream.
+        mTransferRingCreationFailed = true;
+        return false;
+    }
+
+    size_t createInfoLength = ring->SerializeCreateSize();
+
+    QueueCreateTransferRingCmd cmd;
+    cmd.queueId = GetWireId();
+    cmd.size = ringSize;
+    cmd.writeHandleCreateInfoLength = createInfoLength;
+    cmd.writeHandleCreateInfo = nullptr;
+
+    client->SerializeCommand(cmd, CommandExtension{createInfoLength, [&](char* createInfoBuffer) {
+                                                       // Serialize the WriteHandle into the space
+                                                       // after the command.
+                                                       ring->SerializeCreate(createInfoBuffer);
+                                                   }});
+
+    mTransferRingData = static_cast<uint8_t*>(ring->GetData());
+    mTransferRingSize = ringSize;
+    mTransferRing = std::move(ring);
+    return true;
+}
+
+std::optional<uint64_t> Queue::StageInTransferRing(const void* data, size_t size) {
+    Client* client = GetClient();
+    if (client->GetWriteTransferRingSize() == 0 || size < client->GetWriteTransferThreshold() ||
+        size > client->GetWriteTransferRingSize()) {
+        return std::nullopt;
+    }
+    if (!EnsureTransferRing()) {
+        return std::nullopt;
+    }
+
+    // Allocations don't wrap around the end of the ring: the tail is skipped instead.
+    uint64_t offset = mTransferRingPosition % mTransferRingSize;
+    uint64_t reservedSize = size;
+    if (offset + size > mTransferRingSize) {
+        reservedSize += mTransferRingSize - offset;
+        offset = 0;
+    }
+
+    // The server hasn't consumed enough of the ring yet. Fall back to sending the data inline
+    // rather than blocking, the ring will be available again once the server catches up.
+    uint64_t inFlightSize = mTransferRingPosition - mTransferRingConsumedPosition;
+    if (inFlightSize + reservedSize > mTransferRingSize) {
+        return std::nullopt;
+    }
+
+    mTransferRingPosition += reservedSize;
+    memcpy(mTransferRingData + offset, data, size);
+    return offset;
+}
+
 void Queue::APIWriteBuffer(WGPUBuffer cBuffer,
                            uint64_t bufferOffset,
                            const void* data,
                            size_t size) {
     Buffer* buffer = FromAPI(cBuffer);
 
+    if (std::optional<uint64_t> ringOffset = StageInTransferRing(data, size)) {
+        size_t writeDataUpdateInfoLength =
+            mTransferRing->SizeOfSerializeDataUpdate(*ringOffset, size);
+
+        QueueWriteBufferFromTransferRingCmd cmd;
+        cmd.queueId = GetWireId();
+        cmd.bufferId = buffer->GetWireId();
+        cmd.bufferOffset = bufferOffset;
+        cmd.ringOffset = *ringOffset;
+        cmd.size = size;
+        cmd.ringPosition = mTransferRingPosition;
+        cmd.writeDataUpdateInfoLength = writeDataUpdateInfoLength;
+        cmd.writeDataUpdateInfo = nullptr;
+
+        GetClient()->SerializeCommand(
+            cmd, CommandExtension{writeDataUpdateInfoLength, [&](char* writeHandleBuffer) {
+                                      mTransferRing->SerializeDataUpdate(writeHandleBuffer,
+                                                                         cmd.ringOffset, cmd.size);
+                                  }});
+        return;
+    }
+
     QueueWriteBufferCmd cmd;
     cmd.queueId = GetWireId();
     cmd.bufferId = buffer->GetWireId();
@@ -137,6 +244,29 @@ void Queue::APIWriteTexture(const WGPUTexelCopyTextureInfo* destination,
                             size_t dataSize,
                             const WGPUTexelCopyBufferLayout* dataLayout,
                             const WGPUExtent3D* writeSize) {
+    if (std::optional<uint64_t> ringOffset = StageInTransferRing(data, dataSize)) {
+        size_t writeDataUpdateInfoLength =
+            mTransferRing->SizeOfSerializeDataUpdate(*ringOffset, dataSize);
+
+        QueueWriteTextureFromTransferRingCmd cmd;
+        cmd.queueId = GetWireId();
+        cmd.destination = destination;
+        cmd.ringOffset = *ringOffset;
+        cmd.dataSize = dataSize;
+        cmd.dataLayout = dataLayout;
+        cmd.writeSize = writeSize;
+        cmd.ringPosition = mTransferRingPosition;
+        cmd.writeDataUpdateInfoLength = writeDataUpdateInfoLength;
+        cmd.writeDataUpdateInfo = nullptr;
+
+        GetClient()->SerializeCommand(
+            cmd, CommandExtension{writeDataUpdateInfoLength, [&](char* writeHandleBuffer) {
+                                      mTransferRing->SerializeDataUpdate(
+                                          writeHandleBuffer, cmd.ringOffset, cmd.dataSize);
+                                  }});
+        return;
+    }
+
     QueueWriteTextureCmd cmd;
     cmd.queueId = GetWireId();
     cmd.destination = destination;
@@ -30,8 +30,12 @@
 
 #include <webgpu/webgpu.h>
 
+#include <memory>
+#include <optional>
+
 #include "dawn/wire/WireClient.h"
 #include "dawn/wire/client/ObjectBase.h"
+#include "partition_alloc/pointers/raw_ptr.h"
 
 namespace dawn::wire::client {
 
@@ -50,6 +54,24 @@ class Queue final : public ObjectWithEventsBase {
                          size_t dataSize,
                          const WGPUTexelCopyBufferLayout* dataLayout,
                          const WGPUExtent3D* writeSize);
+
+    // Called when the server has consumed the transfer ring up to |ringPosition|.
+    void OnTransferRingConsumed(uint64_t ringPosition);
+
+  private:
+    // Reserves |size| bytes in the transfer ring and copies |data| into it. Returns the offset of
+    // the data in the ring, or std::nullopt if the data should be sent inline instead.
+    std::optional<uint64_t> StageInTransferRing(const void* data, size_t size);
+    bool EnsureTransferRing();
+
+    // The ring is a single WriteHandle that is created on the first large write. Positions are
+    // monotonically increasing byte counts, the offset in the ring is the position modulo its size.
+    std::unique_ptr<MemoryTransferService::WriteHandle> mTransferRing;
+    raw_ptr<uint8_t, AllowPtrArithmetic> mTransferRingData = nullptr;
+    uint64_t mTransferRingSize = 0;
+    uint64_t mTransferRingPosition = 0;
+    uint64_t mTransferRingConsumedPosition = 0;
+    bool mTransferRingCreationFailed = false;
 };
 
 }  // namespace dawn::wire::client
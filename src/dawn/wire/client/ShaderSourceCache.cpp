@@ -0,0 +1,66 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "dawn/wire/client/ShaderSourceCache.h"
+
+namespace dawn::wire::client {
+
+ShaderSourceCache::ShaderSourceCache(size_t budget) : mBudget(budget) {}
+
+ShaderSourceCache::~ShaderSourceCache() = default;
+
+bool ShaderSourceCache::GetOrInsert(std::string_view source, Lookup* lookup) {
+    auto it = mEntryMap.find(source);
+    if (it != mEntryMap.end()) {
+        mEntries.splice(mEntries.begin(), mEntries, it->second);
+        lookup->id = it->second->id;
+        lookup->isNew = false;
+        return true;
+    }
+
+    if (source.size() < kMinSourceSize || source.size() > mBudget) {
+        return false;
+    }
+
+    while (mSize + source.size() > mBudget) {
+        const Entry& oldest = mEntries.back();
+        lookup->evictedIds.push_back(oldest.id);
+        mSize -= oldest.source.size();
+        mEntryMap.erase(oldest.source);
+        mEntries.pop_back();
+    }
+
+    mEntries.push_front({std::string(source), mNextId++});
+    mEntryMap.emplace(mEntries.front().source, mEntries.begin());
+    mSize += source.size();
+
+    lookup->id = mEntries.front().id;
+    lookup->isNew = true;
+    return true;
+}
+
+}  // namespace dawn::wire::client
@@ -0,0 +1,82 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_DAWN_WIRE_CLIENT_SHADERSOURCECACHE_H_
+#define SRC_DAWN_WIRE_CLIENT_SHADERSOURCECACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+
+namespace dawn::wire::client {
+
+// Tracks the shader sources that the server has been told to keep, so that creating a shader
+// module with a source that was already sent only references it by ID instead of serializing the
+// whole source again. The server's copy of the cache is driven entirely by the client: sources are
+// registered the first time they are used and released when they are evicted, in least recently
+// used order, to stay within the budget.
+class ShaderSourceCache {
+  public:
+    // Sources smaller than this are cheaper to send inline than to track.
+    static constexpr size_t kMinSourceSize = 1024;
+
+    explicit ShaderSourceCache(size_t budget);
+    ~ShaderSourceCache();
+
+    struct Lookup {
+        uint64_t id;
+        // True if the source was not in the cache and must be registered on the server.
+        bool isNew;
+        // Sources that were evicted to make room and must be released on the server first.
+        std::vector<uint64_t> evictedIds;
+    };
+
+    // Returns false if the source cannot be cached, in which case it must be sent inline.
+    bool GetOrInsert(std::string_view source, Lookup* lookup);
+
+  private:
+    struct Entry {
+        std::string source;
+        uint64_t id;
+    };
+
+    const size_t mBudget;
+    size_t mSize = 0;
+    uint64_t mNextId = 1;
+    // Most recently used first. The keys of mEntryMap point into the strings of the list nodes,
+    // which are stable.
+    std::list<Entry> mEntries;
+    absl::flat_hash_map<std::string_view, std::list<Entry>::iterator> mEntryMap;
+};
+
+}  // namespace dawn::wire::client
+
+#endif  // SRC_DAWN_WIRE_CLIENT_SHADERSOURCECACHE_H_
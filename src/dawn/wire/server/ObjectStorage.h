@@ -75,6 +75,15 @@ struct ObjectData<WGPUBuffer> : public ObjectDataBase<WGPUBuffer> {
     bool mappedAtCreation = false;
 };
 
+template <>
+struct ObjectData<WGPUQueue> : public ObjectDataBase<WGPUQueue> {
+    // The ring the client stages large writes in, and the server-side memory its data is
+    // deserialized into before being passed to the backend.
+    std::unique_ptr<MemoryTransferService::WriteHandle> transferRing;
+    std::unique_ptr<uint8_t[]> transferRingStaging;
+    size_t transferRingSize = 0;
+};
+
 struct DeviceInfo {
     raw_ptr<Server> server;
     ObjectHandle self;
@@ -33,18 +33,20 @@ namespace dawn::wire::server {
 CallbackUserdata::CallbackUserdata(const std::weak_ptr<Server>& server) : server(server) {}
 
 // static
-std::shared_ptr<Server> Server::Create(const DawnProcTable& procs,
-                                       CommandSerializer* serializer,
-                                       MemoryTransferService* memoryTransferService) {
-    auto server = std::shared_ptr<Server>(new Server(procs, serializer, memoryTransferService));
+std::shared_ptr<Server> Server::Create(const WireServerDescriptor& descriptor) {
+    auto server = std::shared_ptr<Server>(new Server(descriptor));
     server->mSelf = server;
     return server;
 }
 
-Server::Server(const DawnProcTable& procs,
-               CommandSerializer* serializer,
-               MemoryTransferService* memoryTransferService)
-    : mSerializer(serializer), mProcs(procs), mMemoryTransferService(memoryTransferService) {
+Server::Server(const WireServerDescriptor& descriptor)
+    : mInstrumentation(descriptor.enableInstrumentation ? WireInstrumentation::CreateForServer()
+                                                        : nullptr),
+      mPlatform(descriptor.platform),
+      mSerializer(descriptor.serializer, mInstrumentation.get()),
+      mProcs(*descriptor.procs),
+      mMemoryTransferService(descriptor.memoryTransferService),
+      mMaxShaderSourcesSize(descriptor.maxShaderSourceCacheSize) {
     if (mMemoryTransferService == nullptr) {
         // If a MemoryTransferService is not provided, fallback to inline memory.
         mOwnedMemoryTransferService = CreateInlineMemoryTransferService();
@@ -162,6 +164,16 @@ bool Server::IsDeviceKnown(WGPUDevice device) const {
     return Objects<WGPUDevice>().IsKnown(device);
 }
 
+WireDeserializeAllocatorStats Server::GetDeserializeAllocatorStats() const {
+    const WireDeserializeAllocator::Stats& stats = mAllocator.GetStats();
+    WireDeserializeAllocatorStats result;
+    result.heapAllocationCount = stats.heapAllocationCount;
+    result.heapFreeCount = stats.heapFreeCount;
+    result.retainedBytes = stats.retainedBytes;
+    result.peakBytesInUse = stats.peakBytesInUse;
+    return result;
+}
+
 namespace {
 static constexpr WGPULoggingCallbackInfo kEmptyLoggingCallbackInfo = {nullptr, nullptr, nullptr,
                                                                       nullptr};
@@ -29,10 +29,14 @@
 #define SRC_DAWN_WIRE_SERVER_SERVER_H_
 
 #include <memory>
+#include <string>
 #include <utility>
 
+#include "absl/container/flat_hash_map.h"
 #include "dawn/common/MutexProtected.h"
 #include "dawn/wire/ChunkedCommandSerializer.h"
+#include "dawn/wire/WireInstrumentation.h"
+#include "dawn/wire/WireServer.h"
 #include "dawn/wire/server/ServerBase_autogen.h"
 #include "partition_alloc/pointers/raw_ptr.h"
 
@@ -172,9 +176,7 @@ struct DeviceLostUserdata : CallbackUserdata {
 
 class Server : public ServerBase {
   public:
-    static std::shared_ptr<Server> Create(const DawnProcTable& procs,
-                                          CommandSerializer* serializer,
-                                          MemoryTransferService* memoryTransferService);
+    static std::shared_ptr<Server> Create(const WireServerDescriptor& descriptor);
     ~Server() override;
 
     // ChunkedCommandHandler implementation
@@ -190,6 +192,12 @@ class Server : public ServerBase {
     WGPUDevice GetDevice(uint32_t id, uint32_t generation);
     bool IsDeviceKnown(WGPUDevice device) const;
 
+    WireDeserializeAllocatorStats GetDeserializeAllocatorStats() const;
+
+    // Returns nullptr when instrumentation is disabled.
+    WireInstrumentation* GetInstrumentation() const { return mInstrumentation.get(); }
+    platform::Platform* GetPlatform() const { return mPlatform; }
+
     template <typename T,
               typename Enable = std::enable_if<std::is_base_of<CallbackUserdata, T>::value>>
     std::unique_ptr<T> MakeUserdata() {
@@ -197,9 +205,7 @@ class Server : public ServerBase {
     }
 
   private:
-    Server(const DawnProcTable& procs,
-           CommandSerializer* serializer,
-           MemoryTransferService* memoryTransferService);
+    explicit Server(const WireServerDescriptor& descriptor);
 
     template <typename Cmd>
     void SerializeCommand(const Cmd& cmd) {
@@ -231,6 +237,16 @@ class Server : public ServerBase {
         const DawnProcTable& mProcs;
     };
 
+    // Deserializes |size| bytes at |ringOffset| of the queue's transfer ring and acknowledges
+    // them to the client. |data| is set to the deserialized data.
+    WireResult ConsumeTransferRing(Known<WGPUQueue> queue,
+                                   uint64_t ringOffset,
+                                   uint64_t size,
+                                   uint64_t ringPosition,
+                                   uint64_t writeDataUpdateInfoLength,
+                                   const uint8_t* writeDataUpdateInfo,
+                                   const uint8_t** data);
+
     void SetForwardingDeviceCallbacks(Known<WGPUDevice> device);
     void ClearDeviceCallbacks(WGPUDevice device);
 
@@ -276,10 +292,17 @@ class Server : public ServerBase {
 #include "dawn/wire/server/ServerPrototypes_autogen.inc"
 
     WireDeserializeAllocator mAllocator;
+    // Must be declared before mSerializer which keeps a pointer to it.
+    std::unique_ptr<WireInstrumentation> mInstrumentation;
+    raw_ptr<platform::Platform> mPlatform = nullptr;
     MutexProtected<ChunkedCommandSerializer> mSerializer;
     DawnProcTable mProcs;
     std::unique_ptr<MemoryTransferService> mOwnedMemoryTransferService = nullptr;
     raw_ptr<MemoryTransferService> mMemoryTransferService = nullptr;
+    // Shader sources registered by the client, which decides when they are released.
+    absl::flat_hash_map<uint64_t, std::string> mShaderSources;
+    size_t mShaderSourcesSize = 0;
+    const size_t mMaxShaderSourcesSize;
 
     // Weak pointer to self to facilitate creation of userdata.
     std::weak_ptr<Server> mSelf;
@@ -26,7 +26,10 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <limits>
+#include <memory>
+#include <utility>
 
+#include "dawn/common/Alloc.h"
 #include "dawn/common/Assert.h"
 #include "dawn/wire/server/Server.h"
 
@@ -87,4 +90,108 @@ WireResult Server::DoQueueWriteTexture(Known<WGPUQueue> queue,
     return WireResult::Success;
 }
 
+WireResult Server::DoQueueCreateTransferRing(Known<WGPUQueue> queue,
+                                             uint64_t size,
+                                             uint64_t writeHandleCreateInfoLength,
+                                             const uint8_t* writeHandleCreateInfo) {
+    if (size > std::numeric_limits<size_t>::max() ||
+        writeHandleCreateInfoLength > std::numeric_limits<size_t>::max()) {
+        return WireResult::FatalError;
+    }
+    // The client creates at most one transfer ring per queue.
+    if (queue->transferRing != nullptr) {
+        return WireResult::FatalError;
+    }
+
+    auto staging = std::unique_ptr<uint8_t[]>(AllocNoThrow<uint8_t>(static_cast<size_t>(size)));
+    if (staging == nullptr) {
+        return WireResult::FatalError;
+    }
+
+    MemoryTransferService::WriteHandle* writeHandle = nullptr;
+    // Deserialize metadata produced from the client to create a companion server handle.
+    if (!mMemoryTransferService->DeserializeWriteHandle(
+            writeHandleCreateInfo, static_cast<size_t>(writeHandleCreateInfoLength),
+            &writeHandle)) {
+        return WireResult::FatalError;
+    }
+    DAWN_ASSERT(writeHandle != nullptr);
+    writeHandle->SetTarget(staging.get());
+    writeHandle->SetDataLength(static_cast<size_t>(size));
+
+    queue->transferRing.reset(writeHandle);
+    queue->transferRingStaging = std::move(staging);
+    queue->transferRingSize = static_cast<size_t>(size);
+    return WireResult::Success;
+}
+
+WireResult Server::ConsumeTransferRing(Known<WGPUQueue> queue,
+                                       uint64_t ringOffset,
+                                       uint64_t size,
+                                       uint64_t ringPosition,
+                                       uint64_t writeDataUpdateInfoLength,
+                                       const uint8_t* writeDataUpdateInfo,
+                                       const uint8_t** data) {
+    if (queue->transferRing == nullptr) {
+        return WireResult::FatalError;
+    }
+    if (writeDataUpdateInfoLength > std::numeric_limits<size_t>::max() ||
+        ringOffset > queue->transferRingSize || size > queue->transferRingSize - ringOffset) {
+        return WireResult::FatalError;
+    }
+
+    // Copy the data from the ring into the staging memory at the same offset. With shared memory
+    // there is no data in the command stream, only the offsets.
+    if (!queue->transferRing->DeserializeDataUpdate(
+            writeDataUpdateInfo, static_cast<size_t>(writeDataUpdateInfoLength),
+            static_cast<size_t>(ringOffset), static_cast<size_t>(size))) {
+        return WireResult::FatalError;
+    }
+    *data = queue->transferRingStaging.get() + ringOffset;
+
+    // Let the client know it can reuse this part of the ring.
+    ReturnQueueTransferRingConsumedCmd cmd;
+    cmd.queue = queue.AsHandle();
+    cmd.ringPosition = ringPosition;
+    SerializeCommand(cmd);
+
+    return WireResult::Success;
+}
+
+WireResult Server::DoQueueWriteBufferFromTransferRing(Known<WGPUQueue> queue,
+                                                      Known<WGPUBuffer> buffer,
+                                                      uint64_t bufferOffset,
+                                                      uint64_t ringOffset,
+                                                      uint64_t size,
+                                                      uint64_t ringPosition,
+                                                      uint64_t writeDataUpdateInfoLength,
+                                                      const uint8_t* writeDataUpdateInfo) {
+    const uint8_t* data = nullptr;
+    WIRE_TRY(ConsumeTransferRing(queue, ringOffset, size, ringPosition, writeDataUpdateInfoLength,
+                                 writeDataUpdateInfo, &data));
+
+    mProcs.queueWriteBuffer(queue->handle, buffer->handle, bufferOffset, data,
+                            static_cast<size_t>(size));
+    return WireResult::Success;
+}
+
+WireResult Server::DoQueueWriteTextureFromTransferRing(
+    Known<WGPUQueue> queue,
+    const WGPUTexelCopyTextureInfo* destination,
+    uint64_t ringOffset,
+    uint64_t dataSize,
+    const WGPUTexelCopyBufferLayout* dataLayout,
+    const WGPUExtent3D* writeSize,
+    uint64_t ringPosition,
+    uint64_t writeDataUpdateInfoLength,
+    const uint8_t* writeDataUpdateInfo) {
+    const uint8_t* data = nullptr;
+    WIRE_TRY(ConsumeTransferRing(queue, ringOffset, dataSize, ringPosition,
+                                 writeDataUpdateInfoLength, writeDataUpdateInfo, &data));
+
+    mProcs.queueWriteTexture(queue->handle, destination, data, static_cast<size_t>(dataSize),
+                             dataLayout, writeSize);
+    return WireResult::Success;
+}
+
 }  // namespace dawn::wire::server
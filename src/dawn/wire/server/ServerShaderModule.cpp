@@ -26,11 +26,60 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <memory>
+#include <string>
 
 #include "dawn/wire/server/Server.h"
 
 namespace dawn::wire::server {
 
+WireResult Server::DoShaderSourceRegister(uint64_t sourceId, const uint8_t* data, uint64_t size) {
+    // The client is expected to release sources before going over the budget so a registration
+    // that doesn't fit is an error rather than a reason to evict.
+    if (size > mMaxShaderSourcesSize - mShaderSourcesSize) {
+        return WireResult::FatalError;
+    }
+    auto [_, inserted] =
+        mShaderSources.try_emplace(sourceId, reinterpret_cast<const char*>(data), size);
+    if (!inserted) {
+        return WireResult::FatalError;
+    }
+    mShaderSourcesSize += size;
+    return WireResult::Success;
+}
+
+WireResult Server::DoShaderSourceRelease(uint64_t sourceId) {
+    auto it = mShaderSources.find(sourceId);
+    if (it == mShaderSources.end()) {
+        return WireResult::FatalError;
+    }
+    mShaderSourcesSize -= it->second.size();
+    mShaderSources.erase(it);
+    return WireResult::Success;
+}
+
+WireResult Server::DoDeviceCreateShaderModuleFromSource(Known<WGPUDevice> device,
+                                                        WGPUStringView label,
+                                                        uint64_t sourceId,
+                                                        ObjectHandle shaderModuleHandle) {
+    auto it = mShaderSources.find(sourceId);
+    if (it == mShaderSources.end()) {
+        return WireResult::FatalError;
+    }
+
+    Reserved<WGPUShaderModule> shaderModule;
+    WIRE_TRY(Objects<WGPUShaderModule>().Allocate(&shaderModule, shaderModuleHandle));
+
+    // The device deduplicates shader modules by content, so modules created from the same
+    // registered source share their parsed representation.
+    WGPUShaderSourceWGSL wgslDesc = WGPU_SHADER_SOURCE_WGSL_INIT;
+    wgslDesc.code = {it->second.data(), it->second.size()};
+    WGPUShaderModuleDescriptor descriptor = WGPU_SHADER_MODULE_DESCRIPTOR_INIT;
+    descriptor.nextInChain = &wgslDesc.chain;
+    descriptor.label = label;
+    shaderModule->handle = mProcs.deviceCreateShaderModule(device->handle, &descriptor);
+    return WireResult::Success;
+}
+
 WireResult Server::DoShaderModuleGetCompilationInfo(Known<WGPUShaderModule> shaderModule,
                                                     ObjectHandle eventManager,
                                                     WGPUFuture future) {
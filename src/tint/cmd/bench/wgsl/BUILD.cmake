@@ -77,6 +77,7 @@ if(TINT_BUILD_WGSL_READER)
   tint_target_add_dependencies(tint_cmd_bench_wgsl_bench bench
     tint_cmd_bench_bench
     tint_lang_wgsl_reader
+    tint_lang_wgsl_reader_parser
   )
 endif(TINT_BUILD_WGSL_READER)
 
@@ -28,11 +28,29 @@
 #include <string>
 
 #include "src/tint/cmd/bench/bench.h"
+#include "src/tint/lang/wgsl/reader/parser/lexer.h"
 #include "src/tint/lang/wgsl/reader/reader.h"
 
 namespace tint::wgsl::reader {
 namespace {
 
+void LexWGSL(benchmark::State& state, std::string input_name) {
+    auto res = bench::GetWgslFile(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason);
+        return;
+    }
+    for (auto _ : state) {
+        Lexer lexer(&res.Get());
+        auto tokens = lexer.Lex();
+        if (tokens.back().IsError()) {
+            state.SkipWithError(tokens.back().to_str());
+        }
+    }
+}
+
+TINT_BENCHMARK_PROGRAMS(LexWGSL);
+
 void ParseWGSL(benchmark::State& state, std::string input_name) {
     auto res = bench::GetWgslFile(input_name);
     if (res != Success) {
@@ -49,5 +67,21 @@ void ParseWGSL(benchmark::State& state, std::string input_name) {
 
 TINT_BENCHMARK_PROGRAMS(ParseWGSL);
 
+void ParseWGSLToIR(benchmark::State& state, std::string input_name) {
+    auto res = bench::GetWgslFile(input_name);
+    if (res != Success) {
+        state.SkipWithError(res.Failure().reason);
+        return;
+    }
+    for (auto _ : state) {
+        auto ir = WgslToIR(&res.Get());
+        if (ir != Success) {
+            state.SkipWithError(ir.Failure().reason);
+        }
+    }
+}
+
+TINT_BENCHMARK_PROGRAMS(ParseWGSLToIR);
+
 }  // namespace
 }  // namespace tint::wgsl::reader
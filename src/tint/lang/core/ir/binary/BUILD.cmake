@@ -45,6 +45,9 @@ tint_add_target(tint_lang_core_ir_binary lib
   lang/core/ir/binary/decode.h
   lang/core/ir/binary/encode.cc
   lang/core/ir/binary/encode.h
+  lang/core/ir/binary/flat_decode.cc
+  lang/core/ir/binary/flat_encode.cc
+  lang/core/ir/binary/flat_format.h
 )
 
 tint_target_add_dependencies(tint_lang_core_ir_binary lib
@@ -53,6 +56,7 @@ tint_target_add_dependencies(tint_lang_core_ir_binary lib
   tint_lang_core_constant
   tint_lang_core_intrinsic
   tint_lang_core_ir
+  tint_lang_core_ir_type
   tint_lang_core_type
   tint_utils
   tint_utils_containers
@@ -94,6 +98,7 @@ tint_target_add_dependencies(tint_lang_core_ir_binary_test test
   tint_lang_core_intrinsic
   tint_lang_core_ir
   tint_lang_core_ir_test
+  tint_lang_core_ir_type
   tint_lang_core_type
   tint_utils
   tint_utils_containers
@@ -115,6 +120,7 @@ tint_target_add_external_dependencies(tint_lang_core_ir_binary_test test
 if(TINT_BUILD_IR_BINARY)
   tint_target_add_dependencies(tint_lang_core_ir_binary_test test
     tint_lang_core_ir_binary
+    tint_utils_protos_ir_proto
   )
 endif(TINT_BUILD_IR_BINARY)
 
@@ -1934,17 +1934,6 @@ struct Decoder {
 
 }  // namespace
 
-Result<Module> Decode(Slice<const std::byte> encoded) {
-    GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-    pb::Module mod_in;
-    if (!mod_in.ParseFromArray(encoded.data, static_cast<int>(encoded.len))) {
-        return Failure{"failed to deserialize protobuf"};
-    }
-
-    return Decode(mod_in);
-}
-
 Result<Module> Decode(const pb::Module& mod_in) {
     return Decoder{mod_in}.Decode();
 }
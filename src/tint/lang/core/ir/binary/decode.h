@@ -41,7 +41,7 @@ class Module;
 
 namespace tint::core::ir::binary {
 
-/// @returns the decoded Module from the serialized protobuf.
+/// @returns the decoded Module from the flat binary produced by EncodeToBinary().
 Result<Module> Decode(Slice<const std::byte> encoded);
 
 /// @returns the decoded Module from the protobuf.
@@ -1412,21 +1412,4 @@ Result<std::unique_ptr<pb::Module>> EncodeToProto(const Module& mod_in) {
     return std::make_unique<pb::Module>(mod_out);
 }
 
-Result<Vector<std::byte, 0>> EncodeToBinary(const Module& mod_in) {
-    auto mod_out = EncodeToProto(mod_in);
-    if (mod_out != Success) {
-        return mod_out.Failure();
-    }
-
-    Vector<std::byte, 0> buffer;
-    size_t len = mod_out.Get()->ByteSizeLong();
-    buffer.Resize(len);
-    if (len > 0) {
-        if (!mod_out.Get()->SerializeToArray(&buffer[0], static_cast<int>(len))) {
-            return Failure{"failed to serialize protobuf"};
-        }
-    }
-    return buffer;
-}
-
 }  // namespace tint::core::ir::binary
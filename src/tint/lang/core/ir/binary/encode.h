@@ -47,7 +47,9 @@ namespace tint::core::ir::binary {
 // Encode the module into a proto representation.
 Result<std::unique_ptr<pb::Module>> EncodeToProto(const Module& module);
 
-// Encode the module into a binary representation.
+// Encode the module into the compact flat binary representation described in flat_format.h.
+// Unlike EncodeToProto(), this does not go through protobuf. Returns a failure if the module uses
+// an instruction or type that the format cannot represent.
 Result<Vector<std::byte, 0>> EncodeToBinary(const Module& module);
 
 }  // namespace tint::core::ir::binary
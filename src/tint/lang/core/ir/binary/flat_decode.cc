@@ -0,0 +1,1182 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "src/tint/lang/core/ir/binary/decode.h"
+#include "src/tint/lang/core/ir/binary/flat_format.h"
+#include "src/tint/lang/core/ir/builder.h"
+#include "src/tint/lang/core/ir/control_instruction.h"
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/override.h"
+#include "src/tint/lang/core/ir/type/array_count.h"
+#include "src/tint/lang/core/type/binding_array.h"
+#include "src/tint/lang/core/type/depth_multisampled_texture.h"
+#include "src/tint/lang/core/type/depth_texture.h"
+#include "src/tint/lang/core/type/external_texture.h"
+#include "src/tint/lang/core/type/function.h"
+#include "src/tint/lang/core/type/input_attachment.h"
+#include "src/tint/lang/core/type/invalid.h"
+#include "src/tint/lang/core/type/multisampled_texture.h"
+#include "src/tint/lang/core/type/sampled_texture.h"
+#include "src/tint/lang/core/type/storage_texture.h"
+#include "src/tint/lang/core/type/vector.h"
+#include "src/tint/utils/containers/hashmap.h"
+#include "src/tint/utils/containers/hashset.h"
+#include "src/tint/utils/internal_limits.h"
+#include "src/tint/utils/macros/compiler.h"
+#include "src/tint/utils/math/crc32.h"
+#include "src/tint/utils/math/math.h"
+#include "src/tint/utils/result.h"
+
+namespace tint::core::ir::binary {
+namespace {
+
+/// FlatDecoder decodes a Module from the format described in flat_format.h.
+/// Every section is read exactly once, front to back. Strings are referenced in-place in the
+/// encoded buffer until they are copied into the module's symbol table.
+struct FlatDecoder {
+    Slice<const std::byte> in_;
+
+    Module mod_out_{};
+    Vector<ir::Block*, 32> blocks_{};
+    Vector<const core::type::Type*, 32> types_{};
+    Vector<const core::constant::Value*, 32> constant_values_{};
+    Vector<ir::Value*, 32> values_{};
+    Builder b{mod_out_};
+
+    Vector<ir::ExitIf*, 32> exit_ifs_{};
+    Vector<ir::ExitSwitch*, 32> exit_switches_{};
+    Vector<ir::ExitLoop*, 32> exit_loops_{};
+    Vector<ir::NextIteration*, 32> next_iterations_{};
+    Vector<ir::BreakIf*, 32> break_ifs_{};
+    Vector<ir::Continue*, 32> continues_{};
+
+    /// The instruction results that hold the count of override-sized arrays, keyed by value id.
+    /// These are created when the array type is decoded, before the value table.
+    Hashmap<uint32_t, ir::InstructionResult*, 4> array_count_results_{};
+
+    std::stringstream err_{};
+    Hashset<std::string_view, 4> struct_names_{};
+
+    Result<Module> Decode() {
+        flat::Reader header{in_};
+        if (DAWN_UNLIKELY(in_.len < flat::kHeaderSize)) {
+            return Failure{"IR binary is too small"};
+        }
+        if (DAWN_UNLIKELY(header.U32() != flat::kMagic)) {
+            return Failure{"IR binary has an invalid magic number"};
+        }
+        if (auto version = header.U32(); DAWN_UNLIKELY(version != flat::kVersion)) {
+            return Failure{"IR binary version " + std::to_string(version) +
+                           " is not supported, expected " + std::to_string(flat::kVersion)};
+        }
+        if (DAWN_UNLIKELY(header.U32() != flat::EnumFingerprint())) {
+            return Failure{"IR binary was encoded with incompatible enum definitions"};
+        }
+
+        std::array<Slice<const std::byte>, flat::kNumSections> sections{};
+        for (uint32_t i = 0; i < flat::kNumSections; i++) {
+            uint32_t id = header.U32();
+            uint32_t size = header.U32();
+            uint32_t checksum = header.U32();
+            if (DAWN_UNLIKELY(header.overflow || id != i + 1)) {
+                return Failure{"IR binary section " + std::to_string(i + 1) + " is missing"};
+            }
+            auto data = header.Raw(size);
+            if (DAWN_UNLIKELY(header.overflow)) {
+                return Failure{"IR binary section " + std::to_string(id) + " is truncated"};
+            }
+            if (DAWN_UNLIKELY((size > 0 ? CRC32(data.data, size) : 0) != checksum)) {
+                return Failure{"IR binary section " + std::to_string(id) + " checksum mismatch"};
+            }
+            sections[i] = data;
+        }
+        if (DAWN_UNLIKELY(header.Remaining() != 0)) {
+            return Failure{"IR binary has trailing data"};
+        }
+
+        auto section = [&](flat::FlatSection id) {
+            return flat::Reader{sections[static_cast<uint32_t>(id) - 1]};
+        };
+        auto types_in = section(flat::FlatSection::kTypes);
+        auto constant_values_in = section(flat::FlatSection::kConstants);
+        auto values_in = section(flat::FlatSection::kValues);
+        auto functions_in = section(flat::FlatSection::kFunctions);
+        auto blocks_in = section(flat::FlatSection::kBlocks);
+
+        // Each entry takes at least one byte, so no count can exceed the size of its section. This
+        // bounds all the allocations below by the size of the input.
+        auto module_in = section(flat::FlatSection::kModule);
+        const uint32_t num_types = module_in.U32V();
+        const uint32_t num_constant_values = module_in.U32V();
+        const uint32_t num_values = module_in.U32V();
+        const uint32_t num_functions = module_in.U32V();
+        const uint32_t num_blocks = module_in.Count();
+        const uint32_t root_block = module_in.U32V();
+        if (DAWN_UNLIKELY(num_types > types_in.Remaining() ||
+                          num_constant_values > constant_values_in.Remaining() ||
+                          num_values > values_in.Remaining() ||
+                          num_functions > functions_in.Remaining() || root_block >= num_blocks)) {
+            return Failure{"IR binary has an invalid module section"};
+        }
+
+        mod_out_.functions.Reserve(num_functions);
+        for (uint32_t i = 0; i < num_functions; i++) {
+            auto* fn = mod_out_.CreateValue<ir::Function>();
+            fn->SetType(mod_out_.Types().function());
+            mod_out_.functions.Push(fn);
+        }
+        blocks_.Reserve(num_blocks);
+        for (uint32_t i = 0; i < num_blocks; i++) {
+            auto kind = module_in.U8();
+            if (i == root_block) {
+                if (DAWN_UNLIKELY(kind != 0)) {
+                    err_ << "root block must not be a multi-in block\n";
+                }
+                blocks_.Push(mod_out_.root_block);
+            } else {
+                if (DAWN_UNLIKELY(kind > 1)) {
+                    err_ << "invalid block kind: " << static_cast<uint32_t>(kind) << "\n";
+                }
+                blocks_.Push(kind == 1 ? b.MultiInBlock() : b.Block());
+            }
+        }
+        if (!EndOfSection(module_in, "module")) {
+            return Failure{err_.str()};
+        }
+
+        types_.Reserve(num_types);
+        for (uint32_t i = 0; i < num_types; i++) {
+            types_.Push(CreateType(types_in));
+        }
+        if (!EndOfSection(types_in, "types")) {
+            return Failure{err_.str()};
+        }
+
+        constant_values_.Reserve(num_constant_values);
+        for (uint32_t i = 0; i < num_constant_values; i++) {
+            constant_values_.Push(CreateConstantValue(constant_values_in));
+        }
+        if (!EndOfSection(constant_values_in, "constants")) {
+            return Failure{err_.str()};
+        }
+
+        values_.Reserve(num_values);
+        for (uint32_t i = 0; i < num_values; i++) {
+            values_.Push(CreateValue(values_in, i + 1));
+        }
+        if (!EndOfSection(values_in, "values")) {
+            return Failure{err_.str()};
+        }
+        for (auto& count : array_count_results_) {
+            if (DAWN_UNLIKELY(count.key > num_values)) {
+                err_ << "array count value id " << count.key.Value() << " out of range\n";
+                return Failure{err_.str()};
+            }
+        }
+
+        for (size_t i = 0; i < num_functions; i++) {
+            PopulateFunction(mod_out_.functions[i], functions_in);
+        }
+        if (!EndOfSection(functions_in, "functions")) {
+            return Failure{err_.str()};
+        }
+
+        for (auto* block : blocks_) {
+            PopulateBlock(block, blocks_in);
+        }
+        if (!EndOfSection(blocks_in, "blocks")) {
+            return Failure{err_.str()};
+        }
+
+        auto err = err_.str();
+        if (!err.empty()) {
+            // Note: Its not safe to call InferControlInstruction() with a broken IR.
+            return Failure{err};
+        }
+
+        if (CheckBlocks()) {
+            for (auto* exit : exit_ifs_) {
+                InferControlInstruction(exit, &ExitIf::SetIf);
+            }
+            for (auto* exit : exit_switches_) {
+                InferControlInstruction(exit, &ExitSwitch::SetSwitch);
+            }
+            for (auto* exit : exit_loops_) {
+                InferControlInstruction(exit, &ExitLoop::SetLoop);
+            }
+            for (auto* break_ifs : break_ifs_) {
+                InferControlInstruction(break_ifs, &BreakIf::SetLoop);
+            }
+            for (auto* next_iters : next_iterations_) {
+                InferControlInstruction(next_iters, &NextIteration::SetLoop);
+            }
+            for (auto* cont : continues_) {
+                InferControlInstruction(cont, &Continue::SetLoop);
+            }
+        }
+
+        err = err_.str();
+        if (!err.empty()) {
+            return Failure{err};
+        }
+        return std::move(mod_out_);
+    }
+
+    /// Checks that @p in was read to exactly its end.
+    /// @returns false, and records an error, if it was not.
+    bool EndOfSection(const flat::Reader& in, const char* name) {
+        if (DAWN_UNLIKELY(in.overflow)) {
+            err_ << "malformed or truncated " << name << " section\n";
+            return false;
+        }
+        if (DAWN_UNLIKELY(in.Remaining() != 0)) {
+            err_ << "unexpected data at the end of the " << name << " section\n";
+            return false;
+        }
+        return true;
+    }
+
+    /// Errors if @p number is not finite.
+    /// @returns @p number if finite, otherwise 0.
+    template <typename T>
+    Number<T> CheckFinite(Number<T> number) {
+        if (DAWN_UNLIKELY(!std::isfinite(number.value))) {
+            err_ << "value must be finite\n";
+            return Number<T>{};
+        }
+        return number;
+    }
+
+    /// Errors if @p name contains a '\0' before the end of the string.
+    /// @returns true if @p name is valid.
+    bool CheckName(std::string_view name, const char* what) {
+        if (DAWN_UNLIKELY(name.find('\0') != std::string_view::npos)) {
+            err_ << what << " name '" << name << "' contains '\\0' before end of the string\n";
+            return false;
+        }
+        return true;
+    }
+
+    /// @returns true if all blocks are reachable, acyclic nesting depth is less than or equal to
+    /// kMaxBlockDepth.
+    bool CheckBlocks() {
+        const size_t kMaxBlockDepth = 128;
+        Vector<std::pair<const ir::Block*, size_t>, 32> pending;
+        pending.Push(std::make_pair(mod_out_.root_block, 0));
+        for (auto& fn : mod_out_.functions) {
+            pending.Push(std::make_pair(fn->Block(), 0));
+        }
+        Hashset<const ir::Block*, 32> seen;
+        while (!pending.IsEmpty()) {
+            const auto block_depth = pending.Pop();
+            const auto* block = block_depth.first;
+            const size_t depth = block_depth.second;
+            if (!seen.Add(block)) {
+                err_ << "cyclic nesting of blocks\n";
+                return false;
+            }
+            if (depth > kMaxBlockDepth) {
+                err_ << "block nesting exceeds " << kMaxBlockDepth << "\n";
+                return false;
+            }
+            for (auto* inst = block->Instructions(); inst; inst = inst->next) {
+                if (auto* ctrl = inst->As<ir::ControlInstruction>()) {
+                    ctrl->ForeachBlock([&](const ir::Block* child) {
+                        pending.Push(std::make_pair(child, depth + 1));
+                    });
+                }
+            }
+        }
+
+        for (auto* block : blocks_) {
+            if (!seen.Contains(block)) {
+                err_ << "unreachable block\n";
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <typename EXIT, typename CTRL_INST>
+    void InferControlInstruction(EXIT* exit, void (EXIT::*set)(CTRL_INST*)) {
+        for (auto* block = exit->Block(); block;) {
+            auto* parent = block->Parent();
+            if (!parent) {
+                break;
+            }
+            if (auto* ctrl_inst = parent->template As<CTRL_INST>()) {
+                (exit->*set)(ctrl_inst);
+                break;
+            }
+            block = parent->Block();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Functions
+    ////////////////////////////////////////////////////////////////////////////
+    void PopulateFunction(ir::Function* fn_out, flat::Reader& in) {
+        auto name = in.String();
+        if (!name.empty() && CheckName(name, "function")) {
+            mod_out_.SetName(fn_out, name);
+        }
+        fn_out->SetReturnType(Type(in.U32V()));
+        auto stage = Enum(in, flat::kMaxPipelineStage, Function::PipelineStage::kUndefined,
+                          "pipeline stage");
+        if (stage != Function::PipelineStage::kUndefined) {
+            fn_out->SetStage(stage);
+        }
+        const uint32_t mask = in.U32V();
+        if (mask & flat::kAttrWorkgroupSize) {
+            auto* x = Value(in.U32V());
+            auto* y = Value(in.U32V());
+            auto* z = Value(in.U32V());
+            fn_out->SetWorkgroupSize(x, y, z);
+        }
+
+        Vector<FunctionParam*, 8> params_out;
+        for (uint32_t i = 0, n = in.Count(); i < n; i++) {
+            auto* param_out = ValueAs<FunctionParam>(in.U32V());
+            if (DAWN_LIKELY(param_out)) {
+                params_out.Push(param_out);
+            }
+        }
+        if (mask & flat::kAttrLocation) {
+            fn_out->SetReturnLocation(in.U32V());
+        }
+        if (mask & flat::kAttrInterpolation) {
+            fn_out->SetReturnInterpolation(Interpolation(in));
+        }
+        if (mask & flat::kAttrBuiltin) {
+            fn_out->SetReturnBuiltin(BuiltinValue(in));
+        }
+        if (mask & flat::kAttrInvariant) {
+            fn_out->SetReturnInvariant(true);
+        }
+        fn_out->SetParams(std::move(params_out));
+        fn_out->SetBlock(Block(in.U32V()));
+    }
+
+    ir::Function* Function(uint32_t id) {
+        if (DAWN_UNLIKELY(id >= mod_out_.functions.Length())) {
+            err_ << "function id " << id << " out of range\n";
+            return nullptr;
+        }
+        return mod_out_.functions[id];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Blocks
+    ////////////////////////////////////////////////////////////////////////////
+    void PopulateBlock(ir::Block* block_out, flat::Reader& in) {
+        for (uint32_t i = 0, n = in.Count(); i < n; i++) {
+            block_out->Append(Instruction(in));
+        }
+        if (auto* mib = block_out->As<ir::MultiInBlock>()) {
+            Vector<ir::BlockParam*, 8> params;
+            for (uint32_t i = 0, n = in.Count(); i < n; i++) {
+                auto* param_out = ValueAs<BlockParam>(in.U32V());
+                if (DAWN_LIKELY(param_out)) {
+                    params.Push(param_out);
+                }
+            }
+            mib->SetParams(std::move(params));
+        }
+    }
+
+    ir::Block* Block(uint32_t id) {
+        if (DAWN_UNLIKELY(id >= blocks_.Length())) {
+            err_ << "block id " << id << " out of range\n";
+            return b.Block();
+        }
+        return blocks_[id];
+    }
+
+    template <typename T>
+    T* BlockAs(uint32_t id) {
+        auto* block = Block(id);
+        if (auto cast = As<T>(block); DAWN_LIKELY(cast)) {
+            return cast;
+        }
+        err_ << "block " << id << " is " << (block ? block->TypeInfo().name : "<null>")
+             << " expected " << TypeInfo::Of<T>().name << "\n";
+        return nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Instructions
+    ////////////////////////////////////////////////////////////////////////////
+    ir::Instruction* Instruction(flat::Reader& in) {
+        ir::Instruction* inst_out = nullptr;
+        uint32_t num_next_iter_values = 0;
+        const auto kind = static_cast<flat::InstructionKind>(in.U8());
+        switch (kind) {
+            case flat::InstructionKind::kAccess:
+                inst_out = mod_out_.CreateInstruction<ir::Access>();
+                break;
+            case flat::InstructionKind::kBinary:
+                inst_out = CreateInstructionBinary(in);
+                break;
+            case flat::InstructionKind::kBitcast:
+                inst_out = mod_out_.CreateInstruction<ir::Bitcast>();
+                break;
+            case flat::InstructionKind::kBreakIf: {
+                num_next_iter_values = in.U32V();
+                auto* break_if_out = mod_out_.CreateInstruction<ir::BreakIf>();
+                break_ifs_.Push(break_if_out);
+                inst_out = break_if_out;
+                break;
+            }
+            case flat::InstructionKind::kBuiltinCall:
+                inst_out = CreateInstructionBuiltinCall(in);
+                break;
+            case flat::InstructionKind::kConstruct:
+                inst_out = mod_out_.CreateInstruction<ir::Construct>();
+                break;
+            case flat::InstructionKind::kContinue: {
+                auto* continue_ = mod_out_.CreateInstruction<ir::Continue>();
+                continues_.Push(continue_);
+                inst_out = continue_;
+                break;
+            }
+            case flat::InstructionKind::kConvert:
+                inst_out = mod_out_.CreateInstruction<ir::Convert>();
+                break;
+            case flat::InstructionKind::kDiscard:
+                inst_out = mod_out_.CreateInstruction<ir::Discard>();
+                break;
+            case flat::InstructionKind::kExitIf: {
+                auto* exit_out = mod_out_.CreateInstruction<ir::ExitIf>();
+                exit_ifs_.Push(exit_out);
+                inst_out = exit_out;
+                break;
+            }
+            case flat::InstructionKind::kExitLoop: {
+                auto* exit_out = mod_out_.CreateInstruction<ir::ExitLoop>();
+                exit_loops_.Push(exit_out);
+                inst_out = exit_out;
+                break;
+            }
+            case flat::InstructionKind::kExitSwitch: {
+                auto* exit_out = mod_out_.CreateInstruction<ir::ExitSwitch>();
+                exit_switches_.Push(exit_out);
+                inst_out = exit_out;
+                break;
+            }
+            case flat::InstructionKind::kIf:
+                inst_out = CreateInstructionIf(in);
+                break;
+            case flat::InstructionKind::kLet:
+                inst_out = mod_out_.CreateInstruction<ir::Let>();
+                break;
+            case flat::InstructionKind::kLoad:
+                inst_out = mod_out_.CreateInstruction<ir::Load>();
+                break;
+            case flat::InstructionKind::kLoadVectorElement:
+                inst_out = mod_out_.CreateInstruction<ir::LoadVectorElement>();
+                break;
+            case flat::InstructionKind::kLoop:
+                inst_out = CreateInstructionLoop(in);
+                break;
+            case flat::InstructionKind::kOverride:
+                inst_out = CreateInstructionOverride(in);
+                break;
+            case flat::InstructionKind::kNextIteration: {
+                auto* next_it_out = mod_out_.CreateInstruction<ir::NextIteration>();
+                next_iterations_.Push(next_it_out);
+                inst_out = next_it_out;
+                break;
+            }
+            case flat::InstructionKind::kReturn:
+                inst_out = mod_out_.CreateInstruction<ir::Return>();
+                break;
+            case flat::InstructionKind::kStore:
+                inst_out = mod_out_.CreateInstruction<ir::Store>();
+                break;
+            case flat::InstructionKind::kStoreVectorElement:
+                inst_out = mod_out_.CreateInstruction<ir::StoreVectorElement>();
+                break;
+            case flat::InstructionKind::kSwitch:
+                inst_out = CreateInstructionSwitch(in);
+                break;
+            case flat::InstructionKind::kSwizzle:
+                inst_out = CreateInstructionSwizzle(in);
+                break;
+            case flat::InstructionKind::kUnary:
+                inst_out = CreateInstructionUnary(in);
+                break;
+            case flat::InstructionKind::kUserCall:
+                inst_out = mod_out_.CreateInstruction<ir::UserCall>();
+                break;
+            case flat::InstructionKind::kVar:
+                inst_out = CreateInstructionVar(in);
+                break;
+            case flat::InstructionKind::kUnreachable:
+                inst_out = b.Unreachable();
+                break;
+            default:
+                // The layout of the remaining data is unknown, so stop reading the section.
+                err_ << "invalid instruction kind: " << static_cast<uint32_t>(kind) << "\n";
+                in.Fail();
+                break;
+        }
+
+        Vector<ir::Value*, 4> operands;
+        for (uint32_t i = 0, n = in.Count(); i < n; i++) {
+            operands.Push(Value(in.U32V()));
+        }
+        Vector<ir::InstructionResult*, 4> results;
+        for (uint32_t i = 0, n = in.Count(); i < n; i++) {
+            results.Push(ValueAs<ir::InstructionResult>(in.U32V()));
+        }
+
+        if (!inst_out) {
+            return b.Let(mod_out_.Types().invalid());
+        }
+
+        inst_out->SetOperands(std::move(operands));
+        inst_out->SetResults(std::move(results));
+
+        if (kind == flat::InstructionKind::kBreakIf) {
+            bool is_valid =
+                inst_out->Operands().Length() >= num_next_iter_values + BreakIf::kArgsOperandOffset;
+            if (DAWN_LIKELY(is_valid)) {
+                static_cast<BreakIf*>(inst_out)->SetNumNextIterValues(num_next_iter_values);
+            } else {
+                err_ << "invalid value for num_next_iter_values()\n";
+            }
+        }
+
+        return inst_out;
+    }
+
+    ir::CoreBinary* CreateInstructionBinary(flat::Reader& in) {
+        const uint32_t op = in.U32V();
+        if (DAWN_UNLIKELY(op > flat::kMaxBinaryOp)) {
+            err_ << "invalid binary op, " << op << "\n";
+            return nullptr;
+        }
+        auto* binary_out = mod_out_.CreateInstruction<ir::CoreBinary>();
+        binary_out->SetOp(static_cast<core::BinaryOp>(op));
+        return binary_out;
+    }
+
+    ir::CoreBuiltinCall* CreateInstructionBuiltinCall(flat::Reader& in) {
+        auto* call_out = mod_out_.CreateInstruction<ir::CoreBuiltinCall>();
+        call_out->SetFunc(
+            Enum(in, flat::kMaxBuiltinFn, core::BuiltinFn::kNone, "builtin function"));
+        Vector<const core::type::Type*, 1> params;
+        for (uint32_t i = 0, n = in.Count(); i < n; i++) {
+            params.Push(Type(in.U32V()));
+        }
+        call_out->SetExplicitTemplateParams(params);
+        return call_out;
+    }
+
+    ir::If* CreateInstructionIf(flat::Reader& in) {
+        auto* if_out = mod_out_.CreateInstruction<ir::If>();
+        const uint8_t mask = in.U8();
+        if_out->SetTrue((mask & 1) ? Block(in.U32V()) : b.Block());
+        if_out->SetFalse((mask & 2) ? Block(in.U32V()) : b.Block());
+        return if_out;
+    }
+
+    ir::Loop* CreateInstructionLoop(flat::Reader& in) {
+        auto* loop_out = mod_out_.CreateInstruction<ir::Loop>();
+        const uint8_t mask = in.U8();
+        loop_out->SetInitializer((mask & 1) ? Block(in.U32V()) : b.Block());
+        loop_out->SetBody(BlockAs<ir::MultiInBlock>(in.U32V()));
+        if (mask & 2) {
+            loop_out->SetContinuing(BlockAs<ir::MultiInBlock>(in.U32V()));
+        } else {
+            loop_out->SetContinuing(b.MultiInBlock());
+        }
+        return loop_out;
+    }
+
+    ir::Override* CreateInstructionOverride(flat::Reader& in) {
+        auto* override_out = mod_out_.CreateInstruction<ir::Override>();
+        if (in.U8() != 0) {
+            const uint32_t id = in.U32V();
+            if (DAWN_UNLIKELY(id > UINT16_MAX)) {
+                err_ << "invalid override id, " << id << "\n";
+                return nullptr;
+            }
+            override_out->SetOverrideId(OverrideId{static_cast<uint16_t>(id)});
+        }
+        return override_out;
+    }
+
+    ir::Swizzle* CreateInstructionSwizzle(flat::Reader& in) {
+        auto* swizzle_out = mod_out_.CreateInstruction<ir::Swizzle>();
+        Vector<uint32_t, 4> indices;
+        for (uint32_t i = 0, n = in.Count(); i < n; i++) {
+            indices.Push(in.U32V());
+        }
+        swizzle_out->SetIndices(indices);
+        return swizzle_out;
+    }
+
+    ir::Switch* CreateInstructionSwitch(flat::Reader& in) {
+        auto* switch_out = mod_out_.CreateInstruction<ir::Switch>();
+        for (uint32_t i = 0, n = in.Count(); i < n; i++) {
+            ir::Switch::Case case_out{};
+            case_out.block = Block(in.U32V());
+            case_out.block->SetParent(switch_out);
+            const bool is_default = in.U8() != 0;
+            for (uint32_t s = 0, num_selectors = in.Count(); s < num_selectors; s++) {
+                ir::Switch::CaseSelector selector_out{};
+                selector_out.val = Constant(in.U32V());
+                case_out.selectors.Push(std::move(selector_out));
+            }
+            if (is_default) {
+                ir::Switch::CaseSelector selector_out{};
+                case_out.selectors.Push(std::move(selector_out));
+            }
+            switch_out->Cases().Push(std::move(case_out));
+        }
+        return switch_out;
+    }
+
+    ir::CoreUnary* CreateInstructionUnary(flat::Reader& in) {
+        const uint32_t op = in.U32V();
+        if (DAWN_UNLIKELY(op > flat::kMaxUnaryOp)) {
+            err_ << "invalid unary op, " << op << "\n";
+            return nullptr;
+        }
+        auto* unary_out = mod_out_.CreateInstruction<ir::CoreUnary>();
+        unary_out->SetOp(static_cast<core::UnaryOp>(op));
+        return unary_out;
+    }
+
+    ir::Var* CreateInstructionVar(flat::Reader& in) {
+        auto* var_out = mod_out_.CreateInstruction<ir::Var>();
+        const uint32_t mask = in.U32V();
+        if (mask & flat::kAttrBindingPoint) {
+            const uint32_t group = in.U32V();
+            const uint32_t binding = in.U32V();
+            var_out->SetBindingPoint(group, binding);
+        }
+        if (mask & flat::kAttrInputAttachmentIndex) {
+            var_out->SetInputAttachmentIndex(in.U32V());
+        }
+        return var_out;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////////////////////
+    const core::type::Type* CreateType(flat::Reader& in) {
+        auto& ty = mod_out_.Types();
+        const auto kind = static_cast<flat::TypeKind>(in.U8());
+        switch (kind) {
+            case flat::TypeKind::kVoid:
+                return ty.void_();
+            case flat::TypeKind::kBool:
+                return ty.bool_();
+            case flat::TypeKind::kI32:
+                return ty.i32();
+            case flat::TypeKind::kU32:
+                return ty.u32();
+            case flat::TypeKind::kF32:
+                return ty.f32();
+            case flat::TypeKind::kF16:
+                return ty.f16();
+            case flat::TypeKind::kI8:
+                return ty.i8();
+            case flat::TypeKind::kU8:
+                return ty.u8();
+            case flat::TypeKind::kVector: {
+                const uint32_t width = in.U32V();
+                auto* el_ty = Type(in.U32V());
+                if (DAWN_UNLIKELY(width < 2 || width > 4)) {
+                    err_ << "invalid vector width\n";
+                    return ty.invalid();
+                }
+                return ty.vec(el_ty, width);
+            }
+            case flat::TypeKind::kMatrix: {
+                const uint32_t cols = in.U32V();
+                const uint32_t rows = in.U32V();
+                auto* el_ty = Type(in.U32V());
+                if (DAWN_UNLIKELY(rows < 2 || rows > 4 || cols < 2 || cols > 4)) {
+                    err_ << "invalid matrix dimensions\n";
+                    return ty.invalid();
+                }
+                return ty.mat(ty.vec(el_ty, rows), cols);
+            }
+            case flat::TypeKind::kPointer: {
+                auto address_space = Enum(in, flat::kMaxAddressSpace,
+                                          core::AddressSpace::kUndefined, "address space");
+                auto* store_ty = Type(in.U32V());
+                auto access = AccessControl(in);
+                return ty.ptr(address_space, store_ty, access);
+            }
+            case flat::TypeKind::kStruct:
+                return CreateTypeStruct(in);
+            case flat::TypeKind::kAtomic:
+                return ty.atomic(Type(in.U32V()));
+            case flat::TypeKind::kArray: {
+                auto* element = Type(in.U32V());
+                const uint32_t stride = in.U32V();
+                const uint32_t count = in.U32V();
+                if (count >= internal_limits::kMaxArrayElementCount) {
+                    err_ << "array count (" << count << ") must be less than "
+                         << internal_limits::kMaxArrayElementCount << "\n";
+                    return ty.invalid();
+                }
+                return count > 0 ? ty.array(element, count, stride)
+                                 : ty.runtime_array(element, stride);
+            }
+            case flat::TypeKind::kValueArray:
+                return CreateTypeValueArray(in);
+            case flat::TypeKind::kBindingArray: {
+                auto* element = Type(in.U32V());
+                const uint32_t count = in.U32V();
+                if (count >= internal_limits::kMaxArrayElementCount) {
+                    err_ << "binding_array count (" << count << ") must be less than "
+                         << internal_limits::kMaxArrayElementCount << "\n";
+                    return ty.invalid();
+                }
+                return ty.binding_array(element, count);
+            }
+            case flat::TypeKind::kDepthTexture: {
+                auto dimension = TextureDimension(in);
+                if (!core::type::DepthTexture::IsValidDimension(dimension)) {
+                    err_ << "invalid DepthTexture dimension\n";
+                    return ty.invalid();
+                }
+                return ty.depth_texture(dimension);
+            }
+            case flat::TypeKind::kSampledTexture: {
+                auto dimension = TextureDimension(in);
+                return ty.sampled_texture(dimension, Type(in.U32V()));
+            }
+            case flat::TypeKind::kMultisampledTexture: {
+                auto dimension = TextureDimension(in);
+                return ty.multisampled_texture(dimension, Type(in.U32V()));
+            }
+            case flat::TypeKind::kDepthMultisampledTexture: {
+                auto dimension = TextureDimension(in);
+                if (!core::type::DepthMultisampledTexture::IsValidDimension(dimension)) {
+                    err_ << "invalid DepthMultisampledTexture dimension\n";
+                    return ty.invalid();
+                }
+                return ty.depth_multisampled_texture(dimension);
+            }
+            case flat::TypeKind::kStorageTexture: {
+                auto dimension = TextureDimension(in);
+                auto texel_format = TexelFormat(in);
+                auto access = AccessControl(in);
+                return ty.storage_texture(dimension, texel_format, access);
+            }
+            case flat::TypeKind::kTexelBuffer: {
+                auto texel_format = TexelFormat(in);
+                auto access = AccessControl(in);
+                return ty.texel_buffer(texel_format, access);
+            }
+            case flat::TypeKind::kExternalTexture:
+                return ty.external_texture();
+            case flat::TypeKind::kSampler: {
+                const uint32_t kind_in = in.U32V();
+                if (DAWN_UNLIKELY(kind_in > flat::kMaxSamplerKind)) {
+                    err_ << "invalid sampler kind, " << kind_in << "\n";
+                    return ty.invalid();
+                }
+                return ty.Get<core::type::Sampler>(static_cast<core::type::SamplerKind>(kind_in));
+            }
+            case flat::TypeKind::kInputAttachment:
+                return ty.input_attachment(Type(in.U32V()));
+            case flat::TypeKind::kSubgroupMatrix: {
+                auto matrix_kind = Enum(in, flat::kMaxSubgroupMatrixKind,
+                                        SubgroupMatrixKind::kUndefined, "subgroup matrix kind");
+                auto* sub_type = Type(in.U32V());
+                const uint32_t columns = in.U32V();
+                const uint32_t rows = in.U32V();
+                if (DAWN_UNLIKELY(matrix_kind == SubgroupMatrixKind::kUndefined)) {
+                    err_ << "invalid subgroup matrix kind\n";
+                    return ty.invalid();
+                }
+                return ty.subgroup_matrix(matrix_kind, sub_type, columns, rows);
+            }
+        }
+
+        // The layout of the remaining data is unknown, so stop reading the section.
+        err_ << "invalid type kind: " << static_cast<uint32_t>(kind) << "\n";
+        in.Fail();
+        return ty.invalid();
+    }
+
+    const core::type::Type* CreateTypeValueArray(flat::Reader& in) {
+        auto& ty = mod_out_.Types();
+        auto* element = Type(in.U32V());
+        const uint32_t stride = in.U32V();
+        const uint32_t size = in.U32V();
+        const uint32_t count_id = in.U32V();
+        const uint32_t implicit_stride = tint::RoundUp(element->Align(), element->Size());
+        if (DAWN_UNLIKELY(count_id == 0 || stride < implicit_stride)) {
+            err_ << "invalid override-sized array\n";
+            return ty.invalid();
+        }
+        // The value table is decoded after the types, so create the result that holds the count
+        // now. CreateValue() gives it its type when it reaches the result in the value table.
+        auto* count = array_count_results_.GetOrAdd(
+            count_id, [&] { return b.InstructionResult(ty.invalid()); });
+        return ty.Get<core::type::Array>(element, ty.Get<core::ir::type::ValueArrayCount>(count),
+                                         element->Align(), size, stride, implicit_stride);
+    }
+
+    const core::type::Type* CreateTypeStruct(flat::Reader& in) {
+        // All members are read before any error is reported, so that the reader remains in sync.
+        bool valid = true;
+        auto struct_name = in.String();
+        if (DAWN_UNLIKELY(struct_name.empty())) {
+            err_ << "struct must have a name\n";
+            valid = false;
+        } else if (!CheckName(struct_name, "structure")) {
+            valid = false;
+        } else if (!struct_names_.Add(struct_name)) {
+            err_ << "duplicate struct name: " << struct_name << "\n";
+            valid = false;
+        }
+
+        Vector<const core::type::StructMember*, 8> members_out;
+        uint32_t offset = 0;
+        for (uint32_t i = 0, n = in.Count(); i < n; i++) {
+            auto member_name = in.String();
+            auto* type = Type(in.U32V());
+            const uint32_t size = in.U32V();
+            const uint32_t align = in.U32V();
+            core::IOAttributes attributes_out{};
+            const uint32_t mask = in.U32V();
+            if (mask & flat::kAttrLocation) {
+                attributes_out.location = in.U32V();
+            }
+            if (mask & flat::kAttrBlendSrc) {
+                attributes_out.blend_src = in.U32V();
+            }
+            if (mask & flat::kAttrColor) {
+                attributes_out.color = in.U32V();
+            }
+            if (mask & flat::kAttrBuiltin) {
+                attributes_out.builtin = BuiltinValue(in);
+            }
+            if (mask & flat::kAttrInterpolation) {
+                attributes_out.interpolation = Interpolation(in);
+            }
+            attributes_out.invariant = (mask & flat::kAttrInvariant) != 0;
+
+            if (DAWN_UNLIKELY(member_name.empty())) {
+                err_ << "struct member must have a name\n";
+                valid = false;
+            } else if (!CheckName(member_name, "member")) {
+                valid = false;
+            }
+            if (!valid) {
+                continue;
+            }
+
+            auto symbol = mod_out_.symbols.Register(member_name);
+            auto index = static_cast<uint32_t>(members_out.Length());
+            offset = RoundUp(align, offset);
+            auto* member_out = mod_out_.Types().Get<core::type::StructMember>(
+                symbol, type, index, offset, align, size, std::move(attributes_out));
+            offset += size;
+            members_out.Push(member_out);
+        }
+        if (!valid) {
+            return mod_out_.Types().invalid();
+        }
+        if (DAWN_UNLIKELY(members_out.IsEmpty())) {
+            err_ << "struct requires at least one member\n";
+            return mod_out_.Types().invalid();
+        }
+        auto name = mod_out_.symbols.Register(struct_name);
+        return mod_out_.Types().Struct(name, std::move(members_out));
+    }
+
+    const core::type::Type* Type(uint32_t id) {
+        if (DAWN_UNLIKELY(id >= types_.Length())) {
+            err_ << "type id " << id << " out of range\n";
+            return mod_out_.Types().invalid();
+        }
+        return types_[id];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Values
+    ////////////////////////////////////////////////////////////////////////////
+    ir::Value* CreateValue(flat::Reader& in, uint32_t id) {
+        const auto kind = static_cast<flat::ValueKind>(in.U8());
+        auto array_count = array_count_results_.Get(id);
+        if (DAWN_UNLIKELY(array_count && kind != flat::ValueKind::kInstructionResult)) {
+            err_ << "array count value " << id << " is not an instruction result\n";
+        }
+        switch (kind) {
+            case flat::ValueKind::kInstructionResult: {
+                auto* type = Type(in.U32V());
+                ir::InstructionResult* res_out = nullptr;
+                if (array_count) {
+                    res_out = *array_count;
+                    res_out->SetType(type);
+                } else {
+                    res_out = b.InstructionResult(type);
+                }
+                SetName(res_out, in.String(), "result");
+                return res_out;
+            }
+            case flat::ValueKind::kFunctionParameter:
+                return FunctionParameter(in);
+            case flat::ValueKind::kBlockParameter: {
+                auto* param_out = b.BlockParam(Type(in.U32V()));
+                SetName(param_out, in.String(), "param");
+                return param_out;
+            }
+            case flat::ValueKind::kFunction:
+                if (auto* fn = Function(in.U32V())) {
+                    return fn;
+                }
+                return b.InvalidConstant();
+            case flat::ValueKind::kConstant:
+                return Constant(in.U32V());
+        }
+
+        // The layout of the remaining data is unknown, so stop reading the section.
+        err_ << "invalid value kind: " << static_cast<uint32_t>(kind) << "\n";
+        in.Fail();
+        return b.InvalidConstant();
+    }
+
+    ir::FunctionParam* FunctionParameter(flat::Reader& in) {
+        auto* param_out = b.FunctionParam(Type(in.U32V()));
+        SetName(param_out, in.String(), "param");
+
+        const uint32_t mask = in.U32V();
+        if (mask & flat::kAttrBindingPoint) {
+            const uint32_t group = in.U32V();
+            const uint32_t binding = in.U32V();
+            param_out->SetBindingPoint(group, binding);
+        }
+        if (mask & flat::kAttrLocation) {
+            param_out->SetLocation(in.U32V());
+        }
+        if (mask & flat::kAttrColor) {
+            param_out->SetColor(in.U32V());
+        }
+        if (mask & flat::kAttrInterpolation) {
+            param_out->SetInterpolation(Interpolation(in));
+        }
+        if (mask & flat::kAttrBuiltin) {
+            param_out->SetBuiltin(BuiltinValue(in));
+        }
+        if (mask & flat::kAttrInvariant) {
+            param_out->SetInvariant(true);
+        }
+        return param_out;
+    }
+
+    void SetName(ir::Value* value, std::string_view name, const char* what) {
+        if (!name.empty() && CheckName(name, what)) {
+            mod_out_.SetName(value, name);
+        }
+    }
+
+    ir::Constant* Constant(uint32_t value_id) { return b.Constant(ConstantValue(value_id)); }
+
+    ir::Value* Value(uint32_t id) {
+        if (DAWN_UNLIKELY(id > values_.Length())) {
+            err_ << "value id " << id << " out of range\n";
+            return nullptr;
+        }
+        return id > 0 ? values_[id - 1] : nullptr;
+    }
+
+    template <typename T>
+    T* ValueAs(uint32_t id) {
+        auto* value = Value(id);
+        if (auto cast = As<T>(value); DAWN_LIKELY(cast)) {
+            return cast;
+        }
+        err_ << "value " << id << " is " << (value ? value->TypeInfo().name : "<null>")
+             << " expected " << TypeInfo::Of<T>().name << "\n";
+        return nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // ConstantValues
+    ////////////////////////////////////////////////////////////////////////////
+    const core::constant::Value* CreateConstantValue(flat::Reader& in) {
+        const auto kind = static_cast<flat::ConstantKind>(in.U8());
+        switch (kind) {
+            case flat::ConstantKind::kBool:
+                return b.ConstantValue(in.U8() != 0);
+            case flat::ConstantKind::kI32: {
+                const int64_t value = in.I();
+                if (DAWN_UNLIKELY(value < INT32_MIN || value > INT32_MAX)) {
+                    err_ << "i32 constant out of range\n";
+                    return b.InvalidConstant()->Value();
+                }
+                return b.ConstantValue(i32(static_cast<int32_t>(value)));
+            }
+            case flat::ConstantKind::kU32:
+                return b.ConstantValue(u32(in.U32V()));
+            case flat::ConstantKind::kF32:
+                return b.ConstantValue(CheckFinite(f32(in.F32())));
+            case flat::ConstantKind::kF16:
+                return b.ConstantValue(CheckFinite(f16(in.F32())));
+            case flat::ConstantKind::kComposite:
+                return CreateConstantComposite(in);
+            case flat::ConstantKind::kSplat:
+                return CreateConstantSplat(in);
+        }
+
+        // The layout of the remaining data is unknown, so stop reading the section.
+        err_ << "invalid constant value kind: " << static_cast<uint32_t>(kind) << "\n";
+        in.Fail();
+        return b.InvalidConstant()->Value();
+    }
+
+    const core::constant::Value* CreateConstantComposite(flat::Reader& in) {
+        auto* type = Type(in.U32V());
+        Vector<const core::constant::Value*, 8> elements_out;
+        for (uint32_t i = 0, n = in.Count(); i < n; i++) {
+            elements_out.Push(ConstantValue(in.U32V()));
+        }
+        auto type_elements = type->Elements();
+        if (DAWN_UNLIKELY(type_elements.count == 0)) {
+            err_ << "cannot create a composite of type " << type->FriendlyName() << "\n";
+            return b.InvalidConstant()->Value();
+        }
+        if (DAWN_UNLIKELY(type_elements.count != elements_out.Length())) {
+            err_ << "constant composite type " << type->FriendlyName() << " expects "
+                 << type_elements.count << " elements, but " << elements_out.Length()
+                 << " values encoded\n";
+            return b.InvalidConstant()->Value();
+        }
+        for (uint32_t i = 0; i < elements_out.Length(); i++) {
+            auto* value = elements_out[i];
+            if (auto* el_type = type->Element(i); DAWN_UNLIKELY(value->Type() != el_type)) {
+                err_ << "constant composite element value type " << value->Type()->FriendlyName()
+                     << " does not match element type " << el_type->FriendlyName() << "\n";
+                return b.InvalidConstant()->Value();
+            }
+        }
+        return mod_out_.constant_values.Composite(type, std::move(elements_out));
+    }
+
+    const core::constant::Value* CreateConstantSplat(flat::Reader& in) {
+        auto* type = Type(in.U32V());
+        auto* value = ConstantValue(in.U32V());
+        in.U32V();  // The count is implied by the type.
+        uint32_t num_elements = type->Elements().count;
+        if (DAWN_UNLIKELY(num_elements == 0)) {
+            err_ << "cannot create a splat of type " << type->FriendlyName() << "\n";
+            return b.InvalidConstant()->Value();
+        }
+        if (DAWN_UNLIKELY(num_elements > internal_limits::kMaxArrayConstructorElements)) {
+            err_ << "array constructor has excessive number of elements (>"
+                 << internal_limits::kMaxArrayConstructorElements << ")\n";
+            return b.InvalidConstant()->Value();
+        }
+        for (uint32_t i = 0; i < num_elements; i++) {
+            auto* el_type = type->Element(i);
+            if (DAWN_UNLIKELY(el_type != value->Type())) {
+                err_ << "constant splat element value type " << value->Type()->FriendlyName()
+                     << " does not match element " << i << " type " << el_type->FriendlyName()
+                     << "\n";
+                return b.InvalidConstant()->Value();
+            }
+        }
+        return mod_out_.constant_values.Splat(type, value);
+    }
+
+    const core::constant::Value* ConstantValue(uint32_t id) {
+        if (DAWN_UNLIKELY(id >= constant_values_.Length())) {
+            err_ << "constant value id " << id << " out of range\n";
+            return b.InvalidConstant()->Value();
+        }
+        return constant_values_[id];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Attributes and enums
+    ////////////////////////////////////////////////////////////////////////////
+    core::Interpolation Interpolation(flat::Reader& in) {
+        core::Interpolation interpolation_out{};
+        interpolation_out.type = Enum(in, flat::kMaxInterpolationType,
+                                      core::InterpolationType::kUndefined, "interpolation type");
+        interpolation_out.sampling =
+            Enum(in, flat::kMaxInterpolationSampling, core::InterpolationSampling::kUndefined,
+                 "interpolation sampling");
+        return interpolation_out;
+    }
+
+    core::BuiltinValue BuiltinValue(flat::Reader& in) {
+        return Enum(in, flat::kMaxBuiltinValue, core::BuiltinValue::kUndefined, "builtin value");
+    }
+
+    core::Access AccessControl(flat::Reader& in) {
+        return Enum(in, flat::kMaxAccess, core::Access::kUndefined, "access control");
+    }
+
+    core::type::TextureDimension TextureDimension(flat::Reader& in) {
+        return Enum(in, flat::kMaxTextureDimension, core::type::TextureDimension::kNone,
+                    "texture dimension");
+    }
+
+    core::TexelFormat TexelFormat(flat::Reader& in) {
+        return Enum(in, flat::kMaxTexelFormat, core::TexelFormat::kUndefined, "texel format");
+    }
+
+    /// Reads an enum stored by value.
+    /// @returns the enum, or @p fallback if the value is greater than @p max
+    template <typename T>
+    T Enum(flat::Reader& in, uint32_t max, T fallback, const char* what) {
+        const uint32_t value = in.U32V();
+        if (DAWN_UNLIKELY(value > max)) {
+            err_ << "invalid " << what << ", " << value << "\n";
+            return fallback;
+        }
+        return static_cast<T>(value);
+    }
+};
+
+}  // namespace
+
+Result<Module> Decode(Slice<const std::byte> encoded) {
+    return FlatDecoder{encoded}.Decode();
+}
+
+}  // namespace tint::core::ir::binary
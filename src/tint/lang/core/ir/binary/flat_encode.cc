@@ -0,0 +1,821 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/binary/encode.h"
+
+#include <sstream>
+#include <utility>
+
+#include "src/tint/lang/core/constant/composite.h"
+#include "src/tint/lang/core/constant/scalar.h"
+#include "src/tint/lang/core/constant/splat.h"
+#include "src/tint/lang/core/ir/access.h"
+#include "src/tint/lang/core/ir/binary/flat_format.h"
+#include "src/tint/lang/core/ir/bitcast.h"
+#include "src/tint/lang/core/ir/break_if.h"
+#include "src/tint/lang/core/ir/construct.h"
+#include "src/tint/lang/core/ir/continue.h"
+#include "src/tint/lang/core/ir/convert.h"
+#include "src/tint/lang/core/ir/core_binary.h"
+#include "src/tint/lang/core/ir/core_builtin_call.h"
+#include "src/tint/lang/core/ir/core_unary.h"
+#include "src/tint/lang/core/ir/discard.h"
+#include "src/tint/lang/core/ir/exit_if.h"
+#include "src/tint/lang/core/ir/exit_loop.h"
+#include "src/tint/lang/core/ir/exit_switch.h"
+#include "src/tint/lang/core/ir/function_param.h"
+#include "src/tint/lang/core/ir/if.h"
+#include "src/tint/lang/core/ir/let.h"
+#include "src/tint/lang/core/ir/load.h"
+#include "src/tint/lang/core/ir/load_vector_element.h"
+#include "src/tint/lang/core/ir/loop.h"
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/multi_in_block.h"
+#include "src/tint/lang/core/ir/next_iteration.h"
+#include "src/tint/lang/core/ir/override.h"
+#include "src/tint/lang/core/ir/return.h"
+#include "src/tint/lang/core/ir/store.h"
+#include "src/tint/lang/core/ir/store_vector_element.h"
+#include "src/tint/lang/core/ir/switch.h"
+#include "src/tint/lang/core/ir/swizzle.h"
+#include "src/tint/lang/core/ir/type/array_count.h"
+#include "src/tint/lang/core/ir/unreachable.h"
+#include "src/tint/lang/core/ir/user_call.h"
+#include "src/tint/lang/core/ir/var.h"
+#include "src/tint/lang/core/type/array.h"
+#include "src/tint/lang/core/type/binding_array.h"
+#include "src/tint/lang/core/type/bool.h"
+#include "src/tint/lang/core/type/depth_multisampled_texture.h"
+#include "src/tint/lang/core/type/depth_texture.h"
+#include "src/tint/lang/core/type/external_texture.h"
+#include "src/tint/lang/core/type/f16.h"
+#include "src/tint/lang/core/type/f32.h"
+#include "src/tint/lang/core/type/i32.h"
+#include "src/tint/lang/core/type/i8.h"
+#include "src/tint/lang/core/type/input_attachment.h"
+#include "src/tint/lang/core/type/matrix.h"
+#include "src/tint/lang/core/type/multisampled_texture.h"
+#include "src/tint/lang/core/type/pointer.h"
+#include "src/tint/lang/core/type/sampled_texture.h"
+#include "src/tint/lang/core/type/sampler.h"
+#include "src/tint/lang/core/type/storage_texture.h"
+#include "src/tint/lang/core/type/u32.h"
+#include "src/tint/lang/core/type/u8.h"
+#include "src/tint/lang/core/type/void.h"
+#include "src/tint/utils/internal_limits.h"
+#include "src/tint/utils/math/crc32.h"
+#include "src/tint/utils/rtti/switch.h"
+
+namespace tint::core::ir::binary {
+namespace {
+
+/// FlatEncoder encodes a Module into the format described in flat_format.h.
+/// Each section is written to its own buffer, as encoding one entity may discover types, constants,
+/// values and blocks that need to be appended to the other sections.
+struct FlatEncoder {
+    const Module& mod_in_;
+
+    Hashmap<const core::ir::Function*, uint32_t, 32> functions_{};
+    Hashmap<const core::ir::Block*, uint32_t, 32> blocks_{};
+    Hashmap<const core::type::Type*, uint32_t, 32> types_{};
+    Hashmap<const core::ir::Value*, uint32_t, 32> values_{};
+    Hashmap<const core::constant::Value*, uint32_t, 32> constant_values_{};
+
+    /// The blocks in id order. Blocks are assigned an id when first referenced, and their bodies
+    /// are encoded in id order once all the functions have been encoded.
+    Vector<const ir::Block*, 32> pending_blocks_{};
+    uint32_t num_types_ = 0;
+    uint32_t num_constant_values_ = 0;
+    uint32_t num_values_ = 0;
+
+    flat::Writer block_kinds_out_{};
+    flat::Writer types_out_{};
+    flat::Writer constant_values_out_{};
+    flat::Writer values_out_{};
+    flat::Writer functions_out_{};
+    flat::Writer blocks_out_{};
+
+    std::stringstream err_{};
+
+    Result<Vector<std::byte, 0>> Encode() {
+        // Encode all user-declared structures first. This is to ensure that the IR disassembly
+        // (which prints structure types first) does not reorder after encoding and decoding.
+        for (auto* ty : mod_in_.Types()) {
+            if (auto* str = ty->As<core::type::Struct>()) {
+                Type(str);
+            }
+        }
+        for (size_t i = 0, n = mod_in_.functions.Length(); i < n; i++) {
+            functions_.Add(mod_in_.functions[i], static_cast<uint32_t>(i));
+        }
+        for (auto& fn_in : mod_in_.functions) {
+            PopulateFunction(fn_in);
+        }
+        uint32_t root_block = Block(mod_in_.root_block);
+        // Note: BlockBody() may append to pending_blocks_, so the length must be re-evaluated.
+        for (size_t i = 0; i < pending_blocks_.Length(); i++) {
+            BlockBody(pending_blocks_[i]);
+        }
+
+        auto err = err_.str();
+        if (!err.empty()) {
+            return Failure{err};
+        }
+
+        flat::Writer module_out;
+        module_out.U(num_types_);
+        module_out.U(num_constant_values_);
+        module_out.U(num_values_);
+        module_out.U(mod_in_.functions.Length());
+        module_out.U(pending_blocks_.Length());
+        module_out.U(root_block);
+        module_out.Raw(block_kinds_out_.bytes.Slice());
+
+        flat::Writer out;
+        out.bytes.Reserve(flat::kHeaderSize + flat::kNumSections * flat::kSectionHeaderSize +
+                          module_out.bytes.Length() + types_out_.bytes.Length() +
+                          constant_values_out_.bytes.Length() + values_out_.bytes.Length() +
+                          functions_out_.bytes.Length() + blocks_out_.bytes.Length());
+        out.U32(flat::kMagic);
+        out.U32(flat::kVersion);
+        out.U32(flat::EnumFingerprint());
+        Section(out, flat::FlatSection::kModule, module_out);
+        Section(out, flat::FlatSection::kTypes, types_out_);
+        Section(out, flat::FlatSection::kConstants, constant_values_out_);
+        Section(out, flat::FlatSection::kValues, values_out_);
+        Section(out, flat::FlatSection::kFunctions, functions_out_);
+        Section(out, flat::FlatSection::kBlocks, blocks_out_);
+        return std::move(out.bytes);
+    }
+
+    void Section(flat::Writer& out, flat::FlatSection id, const flat::Writer& section) {
+        auto size = section.bytes.Length();
+        out.U32(static_cast<uint32_t>(id));
+        out.U32(static_cast<uint32_t>(size));
+        out.U32(size > 0 ? CRC32(&section.bytes[0], size) : 0);
+        out.Raw(section.bytes.Slice());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Functions
+    ////////////////////////////////////////////////////////////////////////////
+    void PopulateFunction(const ir::Function* fn_in) {
+        auto& out = functions_out_;
+        auto name = mod_in_.NameOf(fn_in);
+        out.String(name ? name.NameView() : std::string_view{});
+        out.U(Type(fn_in->ReturnType()));
+        out.U(static_cast<uint32_t>(fn_in->Stage()));
+
+        auto wg_size_in = fn_in->WorkgroupSize();
+        auto ret_loc_in = fn_in->ReturnLocation();
+        auto ret_interp_in = fn_in->ReturnInterpolation();
+        auto builtin_in = fn_in->ReturnBuiltin();
+        uint32_t mask = 0;
+        mask |= wg_size_in ? flat::kAttrWorkgroupSize : 0;
+        mask |= ret_loc_in ? flat::kAttrLocation : 0;
+        mask |= ret_interp_in ? flat::kAttrInterpolation : 0;
+        mask |= builtin_in ? flat::kAttrBuiltin : 0;
+        mask |= fn_in->ReturnInvariant() ? flat::kAttrInvariant : 0;
+
+        // Gather the value ids before writing, as Value() may encode types and constants.
+        uint32_t wg_size_out[3] = {};
+        if (wg_size_in) {
+            for (size_t i = 0; i < 3; i++) {
+                wg_size_out[i] = Value((*wg_size_in)[i]);
+            }
+        }
+        Vector<uint32_t, 8> params_out;
+        for (auto* param_in : fn_in->Params()) {
+            params_out.Push(Value(param_in));
+        }
+
+        out.U(mask);
+        if (wg_size_in) {
+            for (auto id : wg_size_out) {
+                out.U(id);
+            }
+        }
+        out.U(params_out.Length());
+        for (auto id : params_out) {
+            out.U(id);
+        }
+        if (ret_loc_in) {
+            out.U(*ret_loc_in);
+        }
+        if (ret_interp_in) {
+            Interpolation(out, *ret_interp_in);
+        }
+        if (builtin_in) {
+            out.U(static_cast<uint32_t>(*builtin_in));
+        }
+        out.U(Block(fn_in->Block()));
+    }
+
+    uint32_t Function(const ir::Function* fn_in) const { return *functions_.Get(fn_in); }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Blocks
+    ////////////////////////////////////////////////////////////////////////////
+    uint32_t Block(const ir::Block* block_in) {
+        TINT_ASSERT(block_in != nullptr);
+
+        return blocks_.GetOrAdd(block_in, [&]() -> uint32_t {
+            auto id = static_cast<uint32_t>(pending_blocks_.Length());
+            pending_blocks_.Push(block_in);
+            block_kinds_out_.U8(block_in->Is<ir::MultiInBlock>() ? 1 : 0);
+            return id;
+        });
+    }
+
+    void BlockBody(const ir::Block* block_in) {
+        // Instruction() only appends to blocks_out_ after all referenced ids have been resolved,
+        // so the body of each block is contiguous.
+        blocks_out_.U(block_in->Length());
+        for (auto* inst : *block_in) {
+            Instruction(inst);
+        }
+        if (auto* mib = block_in->As<ir::MultiInBlock>()) {
+            Vector<uint32_t, 4> params;
+            for (auto* param : mib->Params()) {
+                params.Push(Value(param));
+            }
+            Ids(blocks_out_, params);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Instructions
+    ////////////////////////////////////////////////////////////////////////////
+    void Instruction(const ir::Instruction* inst_in) {
+        flat::Writer payload;
+        flat::InstructionKind kind = tint::Switch(
+            inst_in,  //
+            [&](const ir::Access*) { return flat::InstructionKind::kAccess; },
+            [&](const ir::Bitcast*) { return flat::InstructionKind::kBitcast; },
+            [&](const ir::BreakIf* i) {
+                payload.U(i->NextIterValues().Length());
+                return flat::InstructionKind::kBreakIf;
+            },
+            [&](const ir::CoreBinary* i) {
+                payload.U(static_cast<uint32_t>(i->Op()));
+                return flat::InstructionKind::kBinary;
+            },
+            [&](const ir::CoreBuiltinCall* i) {
+                payload.U(static_cast<uint32_t>(i->Func()));
+                auto params = i->ExplicitTemplateParams();
+                payload.U(params.Length());
+                for (auto* param : params) {
+                    payload.U(Type(param));
+                }
+                return flat::InstructionKind::kBuiltinCall;
+            },
+            [&](const ir::CoreUnary* i) {
+                payload.U(static_cast<uint32_t>(i->Op()));
+                return flat::InstructionKind::kUnary;
+            },
+            [&](const ir::Construct*) { return flat::InstructionKind::kConstruct; },
+            [&](const ir::Continue*) { return flat::InstructionKind::kContinue; },
+            [&](const ir::Convert*) { return flat::InstructionKind::kConvert; },
+            [&](const ir::Discard*) { return flat::InstructionKind::kDiscard; },
+            [&](const ir::ExitIf*) { return flat::InstructionKind::kExitIf; },
+            [&](const ir::ExitLoop*) { return flat::InstructionKind::kExitLoop; },
+            [&](const ir::ExitSwitch*) { return flat::InstructionKind::kExitSwitch; },
+            [&](const ir::If* i) {
+                InstructionIf(payload, i);
+                return flat::InstructionKind::kIf;
+            },
+            [&](const ir::Let*) { return flat::InstructionKind::kLet; },
+            [&](const ir::Load*) { return flat::InstructionKind::kLoad; },
+            [&](const ir::LoadVectorElement*) { return flat::InstructionKind::kLoadVectorElement; },
+            [&](const ir::Loop* i) {
+                InstructionLoop(payload, i);
+                return flat::InstructionKind::kLoop;
+            },
+            [&](const ir::NextIteration*) { return flat::InstructionKind::kNextIteration; },
+            [&](const ir::Override* i) {
+                auto id = i->OverrideId();
+                payload.U8(id ? 1 : 0);
+                if (id) {
+                    payload.U(id->value);
+                }
+                return flat::InstructionKind::kOverride;
+            },
+            [&](const ir::Return*) { return flat::InstructionKind::kReturn; },
+            [&](const ir::Store*) { return flat::InstructionKind::kStore; },
+            [&](const ir::StoreVectorElement*) {
+                return flat::InstructionKind::kStoreVectorElement;
+            },
+            [&](const ir::Switch* i) {
+                InstructionSwitch(payload, i);
+                return flat::InstructionKind::kSwitch;
+            },
+            [&](const ir::Swizzle* i) {
+                auto indices = i->Indices();
+                payload.U(indices.Length());
+                for (auto idx : indices) {
+                    payload.U(idx);
+                }
+                return flat::InstructionKind::kSwizzle;
+            },
+            [&](const ir::UserCall*) { return flat::InstructionKind::kUserCall; },
+            [&](const ir::Var* i) {
+                InstructionVar(payload, i);
+                return flat::InstructionKind::kVar;
+            },
+            [&](const ir::Unreachable*) { return flat::InstructionKind::kUnreachable; },
+            [&](Default) {
+                Unsupported("instruction", inst_in->FriendlyName());
+                return flat::InstructionKind::kUnreachable;
+            });
+
+        Vector<uint32_t, 8> operands;
+        for (auto* operand : inst_in->Operands()) {
+            operands.Push(Value(operand));
+        }
+        Vector<uint32_t, 4> results;
+        for (auto* result : inst_in->Results()) {
+            results.Push(Value(result));
+        }
+
+        blocks_out_.U8(static_cast<uint8_t>(kind));
+        blocks_out_.Raw(payload.bytes.Slice());
+        Ids(blocks_out_, operands);
+        Ids(blocks_out_, results);
+    }
+
+    void InstructionIf(flat::Writer& out, const ir::If* if_in) {
+        auto* true_in = if_in->True();
+        auto* false_in = if_in->False();
+        out.U8(static_cast<uint8_t>((true_in ? 1 : 0) | (false_in ? 2 : 0)));
+        if (true_in) {
+            out.U(Block(true_in));
+        }
+        if (false_in) {
+            out.U(Block(false_in));
+        }
+    }
+
+    void InstructionLoop(flat::Writer& out, const ir::Loop* loop_in) {
+        bool has_initializer = loop_in->HasInitializer();
+        bool has_continuing = loop_in->HasContinuing();
+        out.U8(static_cast<uint8_t>((has_initializer ? 1 : 0) | (has_continuing ? 2 : 0)));
+        if (has_initializer) {
+            out.U(Block(loop_in->Initializer()));
+        }
+        out.U(Block(loop_in->Body()));
+        if (has_continuing) {
+            out.U(Block(loop_in->Continuing()));
+        }
+    }
+
+    void InstructionSwitch(flat::Writer& out, const ir::Switch* switch_in) {
+        out.U(switch_in->Cases().Length());
+        for (auto& case_in : switch_in->Cases()) {
+            out.U(Block(case_in.block));
+            bool is_default = false;
+            Vector<uint32_t, 4> selectors;
+            for (auto& selector_in : case_in.selectors) {
+                if (selector_in.IsDefault()) {
+                    is_default = true;
+                } else {
+                    selectors.Push(ConstantValue(selector_in.val->Value()));
+                }
+            }
+            out.U8(is_default ? 1 : 0);
+            Ids(out, selectors);
+        }
+    }
+
+    void InstructionVar(flat::Writer& out, const ir::Var* var_in) {
+        auto bp_in = var_in->BindingPoint();
+        auto iidx_in = var_in->InputAttachmentIndex();
+        uint32_t mask = 0;
+        mask |= bp_in ? flat::kAttrBindingPoint : 0;
+        mask |= iidx_in ? flat::kAttrInputAttachmentIndex : 0;
+        out.U(mask);
+        if (bp_in) {
+            out.U(bp_in->group);
+            out.U(bp_in->binding);
+        }
+        if (iidx_in) {
+            out.U(*iidx_in);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////////////////////
+    uint32_t Type(const core::type::Type* type_in) {
+        TINT_ASSERT(type_in != nullptr);
+        return types_.GetOrAdd(type_in, [&]() -> uint32_t {
+            // Types are emitted in dependency order, so any element types must be encoded before
+            // the tag of this type is written.
+            tint::Switch(
+                type_in,  //
+                [&](const core::type::Void*) { TypeBasic(flat::TypeKind::kVoid); },
+                [&](const core::type::Bool*) { TypeBasic(flat::TypeKind::kBool); },
+                [&](const core::type::I32*) { TypeBasic(flat::TypeKind::kI32); },
+                [&](const core::type::U32*) { TypeBasic(flat::TypeKind::kU32); },
+                [&](const core::type::F32*) { TypeBasic(flat::TypeKind::kF32); },
+                [&](const core::type::F16*) { TypeBasic(flat::TypeKind::kF16); },
+                [&](const core::type::I8*) { TypeBasic(flat::TypeKind::kI8); },
+                [&](const core::type::U8*) { TypeBasic(flat::TypeKind::kU8); },
+                [&](const core::type::Vector* v) {
+                    auto el = Type(v->Type());
+                    TypeBasic(flat::TypeKind::kVector);
+                    types_out_.U(v->Width());
+                    types_out_.U(el);
+                },
+                [&](const core::type::Matrix* m) {
+                    auto el = Type(m->Type());
+                    TypeBasic(flat::TypeKind::kMatrix);
+                    types_out_.U(m->Columns());
+                    types_out_.U(m->Rows());
+                    types_out_.U(el);
+                },
+                [&](const core::type::Pointer* p) {
+                    auto store = Type(p->StoreType());
+                    TypeBasic(flat::TypeKind::kPointer);
+                    types_out_.U(static_cast<uint32_t>(p->AddressSpace()));
+                    types_out_.U(store);
+                    types_out_.U(static_cast<uint32_t>(p->Access()));
+                },
+                [&](const core::type::Struct* s) { TypeStruct(s); },
+                [&](const core::type::Atomic* a) {
+                    auto el = Type(a->Type());
+                    TypeBasic(flat::TypeKind::kAtomic);
+                    types_out_.U(el);
+                },
+                [&](const core::type::Array* a) { TypeArray(a); },
+                [&](const core::type::BindingArray* a) { TypeBindingArray(a); },
+                [&](const core::type::DepthTexture* t) {
+                    TypeBasic(flat::TypeKind::kDepthTexture);
+                    types_out_.U(static_cast<uint32_t>(t->Dim()));
+                },
+                [&](const core::type::SampledTexture* t) {
+                    auto sub = Type(t->Type());
+                    TypeBasic(flat::TypeKind::kSampledTexture);
+                    types_out_.U(static_cast<uint32_t>(t->Dim()));
+                    types_out_.U(sub);
+                },
+                [&](const core::type::MultisampledTexture* t) {
+                    auto sub = Type(t->Type());
+                    TypeBasic(flat::TypeKind::kMultisampledTexture);
+                    types_out_.U(static_cast<uint32_t>(t->Dim()));
+                    types_out_.U(sub);
+                },
+                [&](const core::type::DepthMultisampledTexture* t) {
+                    TypeBasic(flat::TypeKind::kDepthMultisampledTexture);
+                    types_out_.U(static_cast<uint32_t>(t->Dim()));
+                },
+                [&](const core::type::StorageTexture* t) {
+                    TypeBasic(flat::TypeKind::kStorageTexture);
+                    types_out_.U(static_cast<uint32_t>(t->Dim()));
+                    types_out_.U(static_cast<uint32_t>(t->TexelFormat()));
+                    types_out_.U(static_cast<uint32_t>(t->Access()));
+                },
+                [&](const core::type::TexelBuffer* t) {
+                    TypeBasic(flat::TypeKind::kTexelBuffer);
+                    types_out_.U(static_cast<uint32_t>(t->TexelFormat()));
+                    types_out_.U(static_cast<uint32_t>(t->Access()));
+                },
+                [&](const core::type::ExternalTexture*) {
+                    TypeBasic(flat::TypeKind::kExternalTexture);
+                },
+                [&](const core::type::Sampler* s) {
+                    TypeBasic(flat::TypeKind::kSampler);
+                    types_out_.U(static_cast<uint32_t>(s->Kind()));
+                },
+                [&](const core::type::InputAttachment* i) {
+                    auto sub = Type(i->Type());
+                    TypeBasic(flat::TypeKind::kInputAttachment);
+                    types_out_.U(sub);
+                },
+                [&](const core::type::SubgroupMatrix* s) {
+                    auto sub = Type(s->Type());
+                    TypeBasic(flat::TypeKind::kSubgroupMatrix);
+                    types_out_.U(static_cast<uint32_t>(s->Kind()));
+                    types_out_.U(sub);
+                    types_out_.U(s->Columns());
+                    types_out_.U(s->Rows());
+                },
+                [&](Default) {
+                    Unsupported("type", type_in->FriendlyName());
+                    TypeBasic(flat::TypeKind::kVoid);
+                });
+            return num_types_++;
+        });
+    }
+
+    void TypeBasic(flat::TypeKind kind) { types_out_.U8(static_cast<uint8_t>(kind)); }
+
+    void TypeStruct(const core::type::Struct* struct_in) {
+        Vector<uint32_t, 8> member_types;
+        for (auto* member_in : struct_in->Members()) {
+            member_types.Push(Type(member_in->Type()));
+        }
+
+        auto& out = types_out_;
+        TypeBasic(flat::TypeKind::kStruct);
+        out.String(struct_in->Name().NameView());
+        out.U(struct_in->Members().Length());
+        for (auto* member_in : struct_in->Members()) {
+            out.String(member_in->Name().NameView());
+            out.U(member_types[member_in->Index()]);
+            out.U(member_in->Size());
+            out.U(member_in->Align());
+
+            auto& attrs_in = member_in->Attributes();
+            uint32_t mask = 0;
+            mask |= attrs_in.location ? flat::kAttrLocation : 0;
+            mask |= attrs_in.blend_src ? flat::kAttrBlendSrc : 0;
+            mask |= attrs_in.color ? flat::kAttrColor : 0;
+            mask |= attrs_in.builtin ? flat::kAttrBuiltin : 0;
+            mask |= attrs_in.interpolation ? flat::kAttrInterpolation : 0;
+            mask |= attrs_in.invariant ? flat::kAttrInvariant : 0;
+            out.U(mask);
+            if (attrs_in.location) {
+                out.U(*attrs_in.location);
+            }
+            if (attrs_in.blend_src) {
+                out.U(*attrs_in.blend_src);
+            }
+            if (attrs_in.color) {
+                out.U(*attrs_in.color);
+            }
+            if (attrs_in.builtin) {
+                out.U(static_cast<uint32_t>(*attrs_in.builtin));
+            }
+            if (attrs_in.interpolation) {
+                Interpolation(out, *attrs_in.interpolation);
+            }
+        }
+    }
+
+    void TypeArray(const core::type::Array* array_in) {
+        auto el = Type(array_in->ElemType());
+        if (auto* value_count = array_in->Count()->As<core::ir::type::ValueArrayCount>()) {
+            TypeValueArray(array_in, el, value_count);
+            return;
+        }
+        uint32_t count = tint::Switch(
+            array_in->Count(),  //
+            [&](const core::type::ConstantArrayCount* c) {
+                if (c->value >= internal_limits::kMaxArrayElementCount) {
+                    err_ << "array count (" << c->value << ") must be less than "
+                         << internal_limits::kMaxArrayElementCount << "\n";
+                }
+                return c->value;
+            },
+            [&](const core::type::RuntimeArrayCount*) { return 0u; },
+            [&](Default) {
+                Unsupported("array count", array_in->Count()->FriendlyName());
+                return 0u;
+            });
+        TypeBasic(flat::TypeKind::kArray);
+        types_out_.U(el);
+        types_out_.U(array_in->Stride());
+        types_out_.U(count);
+    }
+
+    /// Encodes an array sized by an override expression. The count is the id of the instruction
+    /// result that holds the count, which the decoder creates when it decodes the array type.
+    void TypeValueArray(const core::type::Array* array_in,
+                        uint32_t el,
+                        const core::ir::type::ValueArrayCount* count_in) {
+        uint32_t count = 0;
+        if (count_in->value->Is<ir::InstructionResult>()) {
+            count = Value(count_in->value);
+        } else {
+            Unsupported("array count value", count_in->value->TypeInfo().name);
+        }
+        TypeBasic(flat::TypeKind::kValueArray);
+        types_out_.U(el);
+        types_out_.U(array_in->Stride());
+        types_out_.U(array_in->Size());
+        types_out_.U(count);
+    }
+
+    void TypeBindingArray(const core::type::BindingArray* array_in) {
+        auto el = Type(array_in->ElemType());
+        uint32_t count = tint::Switch(
+            array_in->Count(),  //
+            [&](const core::type::ConstantArrayCount* c) {
+                if (c->value >= internal_limits::kMaxArrayElementCount) {
+                    err_ << "binding_array count (" << c->value << ") must be less than "
+                         << internal_limits::kMaxArrayElementCount << "\n";
+                }
+                return c->value;
+            },
+            [&](Default) {
+                Unsupported("binding_array count", array_in->Count()->FriendlyName());
+                return 0u;
+            });
+        TypeBasic(flat::TypeKind::kBindingArray);
+        types_out_.U(el);
+        types_out_.U(count);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Values
+    ////////////////////////////////////////////////////////////////////////////
+    uint32_t Value(const ir::Value* value_in) {
+        if (!value_in) {
+            return 0;
+        }
+        return values_.GetOrAdd(value_in, [&] {
+            // Values never reference other values, so the record can be written immediately.
+            auto& out = values_out_;
+            tint::Switch(
+                value_in,
+                [&](const ir::InstructionResult* v) {
+                    auto type = Type(v->Type());
+                    out.U8(static_cast<uint8_t>(flat::ValueKind::kInstructionResult));
+                    out.U(type);
+                    Name(out, v);
+                },
+                [&](const ir::FunctionParam* v) { FunctionParameter(v); },
+                [&](const ir::BlockParam* v) {
+                    auto type = Type(v->Type());
+                    out.U8(static_cast<uint8_t>(flat::ValueKind::kBlockParameter));
+                    out.U(type);
+                    Name(out, v);
+                },
+                [&](const ir::Function* v) {
+                    out.U8(static_cast<uint8_t>(flat::ValueKind::kFunction));
+                    out.U(Function(v));
+                },
+                [&](const ir::Constant* v) {
+                    auto constant = ConstantValue(v->Value());
+                    out.U8(static_cast<uint8_t>(flat::ValueKind::kConstant));
+                    out.U(constant);
+                },
+                [&](Default) {
+                    Unsupported("value", value_in->TypeInfo().name);
+                    out.U8(static_cast<uint8_t>(flat::ValueKind::kConstant));
+                    out.U(0);
+                });
+            return ++num_values_;
+        });
+    }
+
+    void FunctionParameter(const ir::FunctionParam* param_in) {
+        auto type = Type(param_in->Type());
+        auto& out = values_out_;
+        out.U8(static_cast<uint8_t>(flat::ValueKind::kFunctionParameter));
+        out.U(type);
+        Name(out, param_in);
+
+        auto bp_in = param_in->BindingPoint();
+        auto location_in = param_in->Location();
+        auto color_in = param_in->Color();
+        auto interpolation_in = param_in->Interpolation();
+        auto builtin_in = param_in->Builtin();
+        uint32_t mask = 0;
+        mask |= bp_in ? flat::kAttrBindingPoint : 0;
+        mask |= location_in ? flat::kAttrLocation : 0;
+        mask |= color_in ? flat::kAttrColor : 0;
+        mask |= interpolation_in ? flat::kAttrInterpolation : 0;
+        mask |= builtin_in ? flat::kAttrBuiltin : 0;
+        mask |= param_in->Invariant() ? flat::kAttrInvariant : 0;
+        out.U(mask);
+        if (bp_in) {
+            out.U(bp_in->group);
+            out.U(bp_in->binding);
+        }
+        if (location_in) {
+            out.U(*location_in);
+        }
+        if (color_in) {
+            out.U(*color_in);
+        }
+        if (interpolation_in) {
+            Interpolation(out, *interpolation_in);
+        }
+        if (builtin_in) {
+            out.U(static_cast<uint32_t>(*builtin_in));
+        }
+    }
+
+    void Name(flat::Writer& out, const ir::Value* value) {
+        auto name = mod_in_.NameOf(value);
+        out.String(name.IsValid() ? name.NameView() : std::string_view{});
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // ConstantValues
+    ////////////////////////////////////////////////////////////////////////////
+    uint32_t ConstantValue(const core::constant::Value* constant_in) {
+        TINT_ASSERT(constant_in != nullptr);
+        return constant_values_.GetOrAdd(constant_in, [&] {
+            auto& out = constant_values_out_;
+            auto kind = [&](flat::ConstantKind k) { out.U8(static_cast<uint8_t>(k)); };
+            tint::Switch(
+                constant_in,  //
+                [&](const core::constant::Scalar<bool>* b) {
+                    kind(flat::ConstantKind::kBool);
+                    out.U8(b->value ? 1 : 0);
+                },
+                [&](const core::constant::Scalar<core::i32>* i32) {
+                    kind(flat::ConstantKind::kI32);
+                    out.I(i32->value);
+                },
+                [&](const core::constant::Scalar<core::u32>* u32) {
+                    kind(flat::ConstantKind::kU32);
+                    out.U(u32->value);
+                },
+                [&](const core::constant::Scalar<core::f32>* f32) {
+                    kind(flat::ConstantKind::kF32);
+                    out.F32(f32->value);
+                },
+                [&](const core::constant::Scalar<core::f16>* f16) {
+                    kind(flat::ConstantKind::kF16);
+                    out.F32(f16->value);
+                },
+                [&](const core::constant::Composite* composite) {
+                    auto type = Type(composite->type);
+                    Vector<uint32_t, 8> elements;
+                    for (auto* el : composite->elements) {
+                        elements.Push(ConstantValue(el));
+                    }
+                    kind(flat::ConstantKind::kComposite);
+                    out.U(type);
+                    Ids(out, elements);
+                },
+                [&](const core::constant::Splat* splat) {
+                    auto type = Type(splat->type);
+                    if (DAWN_UNLIKELY(splat->count >
+                                      internal_limits::kMaxArrayConstructorElements)) {
+                        err_ << "array constructor has excessive number of elements (>"
+                             << internal_limits::kMaxArrayConstructorElements << ")\n";
+                    }
+                    auto element = ConstantValue(splat->el);
+                    kind(flat::ConstantKind::kSplat);
+                    out.U(type);
+                    out.U(element);
+                    out.U(splat->count);
+                },
+                [&](Default) {
+                    Unsupported("constant", constant_in->Type()->FriendlyName());
+                    kind(flat::ConstantKind::kBool);
+                    out.U8(0);
+                });
+            return num_constant_values_++;
+        });
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Attributes
+    ////////////////////////////////////////////////////////////////////////////
+    void Interpolation(flat::Writer& out, const core::Interpolation& interpolation_in) {
+        out.U(static_cast<uint32_t>(interpolation_in.type));
+        out.U(static_cast<uint32_t>(interpolation_in.sampling));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Helpers
+    ////////////////////////////////////////////////////////////////////////////
+    /// Records that the module cannot be encoded, as it contains an unsupported @p what.
+    void Unsupported(const char* what, std::string_view name) {
+        err_ << "unsupported " << what << ": " << name << "\n";
+    }
+
+    void Ids(flat::Writer& out, VectorRef<uint32_t> ids) {
+        out.U(ids.Length());
+        for (auto id : ids) {
+            out.U(id);
+        }
+    }
+};
+
+}  // namespace
+
+Result<Vector<std::byte, 0>> EncodeToBinary(const Module& mod_in) {
+    return FlatEncoder{mod_in}.Encode();
+}
+
+}  // namespace tint::core::ir::binary
@@ -0,0 +1,416 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_LANG_CORE_IR_BINARY_FLAT_FORMAT_H_
+#define SRC_TINT_LANG_CORE_IR_BINARY_FLAT_FORMAT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "src/tint/lang/core/binary_op.h"
+#include "src/tint/lang/core/enums.h"
+#include "src/tint/lang/core/ir/function.h"
+#include "src/tint/lang/core/type/sampler_kind.h"
+#include "src/tint/lang/core/type/texture_dimension.h"
+#include "src/tint/lang/core/unary_op.h"
+#include "src/tint/utils/containers/slice.h"
+#include "src/tint/utils/containers/vector.h"
+#include "src/tint/utils/macros/compiler.h"
+
+/// The flat binary IR format is the format produced by EncodeToBinary() and consumed by
+/// Decode(Slice). Unlike the protobuf form it has no third-party dependencies and is designed to be
+/// decoded in a single forward pass over a (possibly memory-mapped) buffer.
+///
+/// Layout:
+///   Header:  magic (u32) | version (u32) | enum fingerprint (u32)
+///   Section: id (u32) | payload size (u32) | payload CRC32 (u32) | payload bytes
+///
+/// All fixed-width integers are little-endian. The sections always appear in the order of
+/// FlatSection. Within a payload, ids, counts and enums are unsigned LEB128 varints, signed
+/// integers are zig-zag encoded varints, floats are stored as their IEEE-754 bit pattern and
+/// strings are a varint length followed by the (unterminated) bytes.
+///
+/// Ids follow the same numbering as the protobuf form: type, constant, function and block ids are
+/// 0-based indices into their tables, value ids are 1-based with 0 meaning 'no value'. Types and
+/// constants are stored in dependency order, so every id referenced by a table entry refers to an
+/// earlier entry. The exception is the count of an array sized by an override expression, which
+/// refers to the instruction result in the value table that holds the count.
+namespace tint::core::ir::binary::flat {
+
+/// The magic number at the start of every encoded module ('TIRB').
+inline constexpr uint32_t kMagic = 0x42524954;
+
+/// The version of the format. Must be incremented whenever the encoding changes.
+inline constexpr uint32_t kVersion = 2;
+
+/// The size in bytes of the module header.
+inline constexpr size_t kHeaderSize = 12;
+
+/// The size in bytes of each section header.
+inline constexpr size_t kSectionHeaderSize = 12;
+
+/// The identifiers of the sections, in the order that they are encoded.
+enum class FlatSection : uint32_t {
+    /// Function and block counts, block kinds and the root block id.
+    kModule = 1,
+    /// The type table.
+    kTypes,
+    /// The constant value table.
+    kConstants,
+    /// The value table.
+    kValues,
+    /// The function bodies.
+    kFunctions,
+    /// The block bodies.
+    kBlocks,
+};
+
+/// The number of sections in an encoded module.
+inline constexpr uint32_t kNumSections = 6;
+
+/// Tags of the entries in the type table.
+enum class TypeKind : uint8_t {
+    kVoid,
+    kBool,
+    kI32,
+    kU32,
+    kF32,
+    kF16,
+    kI8,
+    kU8,
+    kVector,
+    kMatrix,
+    kPointer,
+    kStruct,
+    kAtomic,
+    kArray,
+    kBindingArray,
+    kDepthTexture,
+    kSampledTexture,
+    kMultisampledTexture,
+    kDepthMultisampledTexture,
+    kStorageTexture,
+    kTexelBuffer,
+    kExternalTexture,
+    kSampler,
+    kInputAttachment,
+    kSubgroupMatrix,
+    kValueArray,
+};
+
+/// Tags of the entries in the constant value table.
+enum class ConstantKind : uint8_t {
+    kBool,
+    kI32,
+    kU32,
+    kF32,
+    kF16,
+    kComposite,
+    kSplat,
+};
+
+/// Tags of the entries in the value table.
+enum class ValueKind : uint8_t {
+    kInstructionResult,
+    kFunctionParameter,
+    kBlockParameter,
+    kFunction,
+    kConstant,
+};
+
+/// Tags of the encoded instructions.
+enum class InstructionKind : uint8_t {
+    kAccess,
+    kBinary,
+    kBitcast,
+    kBreakIf,
+    kBuiltinCall,
+    kConstruct,
+    kContinue,
+    kConvert,
+    kDiscard,
+    kExitIf,
+    kExitLoop,
+    kExitSwitch,
+    kIf,
+    kLet,
+    kLoad,
+    kLoadVectorElement,
+    kLoop,
+    kNextIteration,
+    kReturn,
+    kStore,
+    kStoreVectorElement,
+    kSwitch,
+    kSwizzle,
+    kUnary,
+    kUserCall,
+    kVar,
+    kUnreachable,
+    kOverride,
+};
+
+/// Bits of the optional-attribute masks used by struct members, function parameters, functions and
+/// variables.
+inline constexpr uint32_t kAttrLocation = 1 << 0;
+inline constexpr uint32_t kAttrBlendSrc = 1 << 1;
+inline constexpr uint32_t kAttrColor = 1 << 2;
+inline constexpr uint32_t kAttrBuiltin = 1 << 3;
+inline constexpr uint32_t kAttrInterpolation = 1 << 4;
+inline constexpr uint32_t kAttrInvariant = 1 << 5;
+inline constexpr uint32_t kAttrBindingPoint = 1 << 6;
+inline constexpr uint32_t kAttrWorkgroupSize = 1 << 7;
+inline constexpr uint32_t kAttrInputAttachmentIndex = 1 << 8;
+
+/// The largest encodable value of each of the core enums that are stored by value.
+inline constexpr uint32_t kMaxAccess = static_cast<uint32_t>(core::Access::kWrite);
+inline constexpr uint32_t kMaxAddressSpace = static_cast<uint32_t>(core::AddressSpace::kWorkgroup);
+inline constexpr uint32_t kMaxBinaryOp = static_cast<uint32_t>(core::BinaryOp::kModulo);
+inline constexpr uint32_t kMaxBuiltinFn = static_cast<uint32_t>(core::BuiltinFn::kNone) - 1;
+inline constexpr uint32_t kMaxBuiltinValue =
+    static_cast<uint32_t>(core::BuiltinValue::kWorkgroupId);
+inline constexpr uint32_t kMaxInterpolationSampling =
+    static_cast<uint32_t>(core::InterpolationSampling::kSample);
+inline constexpr uint32_t kMaxInterpolationType =
+    static_cast<uint32_t>(core::InterpolationType::kPerspective);
+inline constexpr uint32_t kMaxPipelineStage =
+    static_cast<uint32_t>(ir::Function::PipelineStage::kVertex);
+inline constexpr uint32_t kMaxSamplerKind =
+    static_cast<uint32_t>(core::type::SamplerKind::kComparisonSampler);
+inline constexpr uint32_t kMaxSubgroupMatrixKind =
+    static_cast<uint32_t>(core::SubgroupMatrixKind::kRight);
+inline constexpr uint32_t kMaxTexelFormat = static_cast<uint32_t>(core::TexelFormat::kRgba8Unorm);
+inline constexpr uint32_t kMaxTextureDimension =
+    static_cast<uint32_t>(core::type::TextureDimension::kNone) - 1;
+inline constexpr uint32_t kMaxUnaryOp = static_cast<uint32_t>(core::UnaryOp::kNot);
+
+/// @returns a fingerprint of the core enums that are encoded by value. Encoded modules are rejected
+/// if this does not match, so that adding or removing enum entries cannot silently reinterpret a
+/// module encoded by a different build.
+constexpr uint32_t EnumFingerprint() {
+    uint32_t hash = 2166136261u;
+    for (uint32_t max : {kMaxAccess, kMaxAddressSpace, kMaxBinaryOp, kMaxBuiltinFn,
+                         kMaxBuiltinValue, kMaxInterpolationSampling, kMaxInterpolationType,
+                         kMaxPipelineStage, kMaxSamplerKind, kMaxSubgroupMatrixKind,
+                         kMaxTexelFormat, kMaxTextureDimension, kMaxUnaryOp}) {
+        hash = (hash ^ max) * 16777619u;
+    }
+    return hash;
+}
+
+/// Writer appends flat-encoded data to a byte vector.
+class Writer {
+  public:
+    /// Appends the unsigned varint @p value.
+    /// @param value the value to write
+    void U(uint64_t value) {
+        while (value >= 0x80) {
+            bytes.Push(static_cast<std::byte>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        bytes.Push(static_cast<std::byte>(value));
+    }
+
+    /// Appends the signed varint @p value.
+    /// @param value the value to write
+    void I(int64_t value) {
+        U((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    /// Appends the byte @p value.
+    /// @param value the value to write
+    void U8(uint8_t value) { bytes.Push(static_cast<std::byte>(value)); }
+
+    /// Appends @p value as a fixed-width little-endian integer.
+    /// @param value the value to write
+    void U32(uint32_t value) {
+        for (uint32_t i = 0; i < 4; i++) {
+            bytes.Push(static_cast<std::byte>(value >> (i * 8)));
+        }
+    }
+
+    /// Appends the bit pattern of @p value.
+    /// @param value the value to write
+    void F32(float value) {
+        uint32_t bits = 0;
+        memcpy(&bits, &value, sizeof(bits));
+        U32(bits);
+    }
+
+    /// Appends the length-prefixed string @p str.
+    /// @param str the string to write
+    void String(std::string_view str) {
+        U(str.size());
+        Raw(Slice<const std::byte>{reinterpret_cast<const std::byte*>(str.data()), str.size()});
+    }
+
+    /// Appends the raw bytes @p data.
+    /// @param data the bytes to append
+    void Raw(Slice<const std::byte> data) {
+        if (data.len > 0) {
+            size_t offset = bytes.Length();
+            bytes.Resize(offset + data.len);
+            memcpy(&bytes[offset], data.data, data.len);
+        }
+    }
+
+    /// The written bytes.
+    Vector<std::byte, 0> bytes;
+};
+
+/// Reader reads flat-encoded data from a byte slice.
+/// Reads past the end of the slice return zero values and set #overflow.
+class Reader {
+  public:
+    /// Constructor
+    /// @param data the bytes to read
+    explicit Reader(Slice<const std::byte> data) : data_(data) {}
+
+    /// @returns the next unsigned varint.
+    uint64_t U() {
+        uint64_t value = 0;
+        for (uint32_t shift = 0; shift < 64; shift += 7) {
+            if (DAWN_UNLIKELY(offset_ >= data_.len)) {
+                return Fail();
+            }
+            auto byte = static_cast<uint8_t>(data_[offset_++]);
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) {
+                return value;
+            }
+        }
+        return Fail();
+    }
+
+    /// @returns the next unsigned varint, which must fit in 32 bits.
+    uint32_t U32V() {
+        uint64_t value = U();
+        if (DAWN_UNLIKELY(value > UINT32_MAX)) {
+            return static_cast<uint32_t>(Fail());
+        }
+        return static_cast<uint32_t>(value);
+    }
+
+    /// @returns the next signed varint.
+    int64_t I() {
+        uint64_t value = U();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    /// @returns the next byte.
+    uint8_t U8() {
+        if (DAWN_UNLIKELY(offset_ >= data_.len)) {
+            return static_cast<uint8_t>(Fail());
+        }
+        return static_cast<uint8_t>(data_[offset_++]);
+    }
+
+    /// @returns the next fixed-width little-endian integer.
+    uint32_t U32() {
+        if (DAWN_UNLIKELY(Remaining() < 4)) {
+            return static_cast<uint32_t>(Fail());
+        }
+        uint32_t value = 0;
+        for (uint32_t i = 0; i < 4; i++) {
+            value |= static_cast<uint32_t>(data_[offset_++]) << (i * 8);
+        }
+        return value;
+    }
+
+    /// @returns the next float.
+    float F32() {
+        uint32_t bits = U32();
+        float value = 0;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    /// @returns the next length-prefixed string, as a view into the read buffer.
+    std::string_view String() {
+        uint64_t len = U();
+        if (len == 0) {
+            return {};
+        }
+        if (DAWN_UNLIKELY(len > Remaining())) {
+            Fail();
+            return {};
+        }
+        std::string_view str(reinterpret_cast<const char*>(&data_[offset_]),
+                             static_cast<size_t>(len));
+        offset_ += static_cast<size_t>(len);
+        return str;
+    }
+
+    /// @returns the next @p size bytes, as a view into the read buffer.
+    /// @param size the number of bytes
+    Slice<const std::byte> Raw(size_t size) {
+        if (DAWN_UNLIKELY(size > Remaining())) {
+            Fail();
+            return {};
+        }
+        auto raw = data_.Offset(offset_).Truncate(size);
+        offset_ += size;
+        return raw;
+    }
+
+    /// Reads a varint element count, checking that it does not exceed the number of remaining
+    /// bytes. Every encoded element takes at least one byte, so larger counts can only come from
+    /// corrupt data, and must not be used to size allocations.
+    /// @returns the count, or 0 if the count is invalid
+    uint32_t Count() {
+        uint64_t count = U();
+        if (DAWN_UNLIKELY(count > Remaining())) {
+            return static_cast<uint32_t>(Fail());
+        }
+        return static_cast<uint32_t>(count);
+    }
+
+    /// @returns the number of unread bytes
+    size_t Remaining() const { return data_.len - offset_; }
+
+    /// Flags the data as malformed and skips to the end of the data. Used when the remaining data
+    /// cannot be interpreted.
+    /// @returns 0
+    uint64_t Fail() {
+        overflow = true;
+        offset_ = data_.len;
+        return 0;
+    }
+
+    /// Set to true if a read went past the end of the data or a value was malformed.
+    bool overflow = false;
+
+  private:
+    Slice<const std::byte> data_;
+    size_t offset_ = 0;
+};
+
+}  // namespace tint::core::ir::binary::flat
+
+#endif  // SRC_TINT_LANG_CORE_IR_BINARY_FLAT_FORMAT_H_
@@ -38,9 +38,9 @@ Result<SuccessType> IRBinaryRoundtripFuzzer(core::ir::Module& module, const fuzz
     auto encoded = EncodeToBinary(module);
     if (encoded != Success) {
         // Failing to encode, not ICE'ing, indicates that an internal limit to the IR binary
-        // encoding/decoding logic was hit. Due to differences between the AST and IR
-        // implementations, there exist corner cases where these internal limits are hit for IR,
-        // but not AST.
+        // encoding/decoding logic was hit, or that the module uses a node that the binary format
+        // does not support. Due to differences between the AST and IR implementations, there
+        // exist corner cases where these internal limits are hit for IR, but not AST.
         return Failure{"Failed to encode module to binary"};
     }
 
@@ -27,10 +27,15 @@
 
 #include "src/tint/lang/core/ir/ir_helper_test.h"
 
+#include <string>
+#include <tuple>
+#include <utility>
+
 #include "src/tint/lang/core/io_attributes.h"
 #include "src/tint/lang/core/ir/binary/decode.h"
 #include "src/tint/lang/core/ir/binary/encode.h"
 #include "src/tint/lang/core/ir/disassembler.h"
+#include "src/tint/lang/core/ir/type/array_count.h"
 #include "src/tint/lang/core/type/depth_multisampled_texture.h"
 #include "src/tint/lang/core/type/depth_texture.h"
 #include "src/tint/lang/core/type/external_texture.h"
@@ -38,6 +43,11 @@
 #include "src/tint/lang/core/type/multisampled_texture.h"
 #include "src/tint/lang/core/type/sampled_texture.h"
 #include "src/tint/lang/core/type/storage_texture.h"
+#include "src/tint/utils/macros/compiler.h"
+
+TINT_BEGIN_DISABLE_PROTOBUF_WARNINGS();
+#include "src/tint/utils/protos/ir/ir.pb.h"
+TINT_END_DISABLE_PROTOBUF_WARNINGS();
 
 namespace tint::core::ir::binary {
 namespace {
@@ -45,22 +55,59 @@ namespace {
 using namespace tint::core::number_suffixes;  // NOLINT
 using namespace tint::core::fluent_types;     // NOLINT
 
-template <typename T = testing::Test>
+/// The encoding used to round-trip the module.
+enum class Codec {
+    /// EncodeToBinary() / Decode(Slice<const std::byte>)
+    kFlat,
+    /// EncodeToProto() / Decode(const pb::Module&)
+    kProto,
+};
+
+std::string PrintCodec(const testing::TestParamInfo<Codec>& info) {
+    return info.param == Codec::kFlat ? "Flat" : "Proto";
+}
+
+/// @returns the codec of a test parameterized over the codec only
+Codec CodecOf(Codec param) {
+    return param;
+}
+
+/// @returns the codec of a test parameterized over the codec and another value
+template <typename T>
+Codec CodecOf(const std::tuple<Codec, T>& param) {
+    return std::get<0>(param);
+}
+
+template <typename T = Codec>
 class IRBinaryRoundtripTestBase : public IRTestParamHelper<T> {
   public:
     std::pair<std::string, std::string> Roundtrip() {
         auto pre = Disassembler(this->mod).Plain();
-        auto encoded = EncodeToBinary(this->mod);
-        if (encoded != Success) {
-            return {pre, encoded.Failure().reason};
-        }
-        auto decoded = Decode(encoded->Slice());
+        auto decoded =
+            CodecOf(this->GetParam()) == Codec::kFlat ? RoundtripFlat() : RoundtripProto();
         if (decoded != Success) {
             return {pre, decoded.Failure().reason};
         }
         auto post = Disassembler(decoded.Get()).Plain();
         return {pre, post};
     }
+
+  private:
+    Result<Module> RoundtripFlat() {
+        auto encoded = EncodeToBinary(this->mod);
+        if (encoded != Success) {
+            return encoded.Failure();
+        }
+        return Decode(encoded->Slice());
+    }
+
+    Result<Module> RoundtripProto() {
+        auto encoded = EncodeToProto(this->mod);
+        if (encoded != Success) {
+            return encoded.Failure();
+        }
+        return Decode(*encoded.Get());
+    }
 };
 
 #define RUN_TEST()                      \
@@ -71,24 +118,29 @@ class IRBinaryRoundtripTestBase : public IRTestParamHelper<T> {
     TINT_REQUIRE_SEMICOLON
 
 using IRBinaryRoundtripTest = IRBinaryRoundtripTestBase<>;
-TEST_F(IRBinaryRoundtripTest, EmptyModule) {
+INSTANTIATE_TEST_SUITE_P(,
+                         IRBinaryRoundtripTest,
+                         testing::Values(Codec::kFlat, Codec::kProto),
+                         PrintCodec);
+
+TEST_P(IRBinaryRoundtripTest, EmptyModule) {
     RUN_TEST();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 // Root block
 ////////////////////////////////////////////////////////////////////////////////
-TEST_F(IRBinaryRoundtripTest, RootBlock_Var_private_i32_Unnamed) {
+TEST_P(IRBinaryRoundtripTest, RootBlock_Var_private_i32_Unnamed) {
     b.Append(b.ir.root_block, [&] { b.Var<private_, i32>(); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, RootBlock_Var_workgroup_f32_Named) {
+TEST_P(IRBinaryRoundtripTest, RootBlock_Var_workgroup_f32_Named) {
     b.Append(b.ir.root_block, [&] { b.Var<workgroup, f32>("WG"); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, RootBlock_Var_storage_binding) {
+TEST_P(IRBinaryRoundtripTest, RootBlock_Var_storage_binding) {
     b.Append(b.ir.root_block, [&] {
         auto* v = b.Var<storage, f32>();
         v->SetBindingPoint(10, 20);
@@ -99,28 +151,30 @@ TEST_F(IRBinaryRoundtripTest, RootBlock_Var_storage_binding) {
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
-TEST_F(IRBinaryRoundtripTest, Fn_i32_ret) {
+TEST_P(IRBinaryRoundtripTest, Fn_i32_ret) {
     b.Function("Function", ty.i32());
     RUN_TEST();
 }
 
-using IRBinaryRoundtripTest_FnPipelineStage = IRBinaryRoundtripTestBase<Function::PipelineStage>;
+using IRBinaryRoundtripTest_FnPipelineStage =
+    IRBinaryRoundtripTestBase<std::tuple<Codec, Function::PipelineStage>>;
 TEST_P(IRBinaryRoundtripTest_FnPipelineStage, Test) {
-    b.Function("Function", ty.i32(), GetParam());
+    b.Function("Function", ty.i32(), std::get<1>(GetParam()));
     RUN_TEST();
 }
 INSTANTIATE_TEST_SUITE_P(,
                          IRBinaryRoundtripTest_FnPipelineStage,
-                         testing::Values(Function::PipelineStage::kCompute,
-                                         Function::PipelineStage::kFragment,
-                                         Function::PipelineStage::kVertex));
+                         testing::Combine(testing::Values(Codec::kFlat, Codec::kProto),
+                                          testing::Values(Function::PipelineStage::kCompute,
+                                                          Function::PipelineStage::kFragment,
+                                                          Function::PipelineStage::kVertex)));
 
-TEST_F(IRBinaryRoundtripTest, Fn_WorkgroupSize) {
+TEST_P(IRBinaryRoundtripTest, Fn_WorkgroupSize) {
     b.ComputeFunction("Function", 1_u, 2_u, 3_u);
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Fn_Parameters) {
+TEST_P(IRBinaryRoundtripTest, Fn_Parameters) {
     auto* fn = b.Function("Function", ty.void_());
     auto* p0 = b.FunctionParam(ty.i32());
     auto* p1 = b.FunctionParam(ty.u32());
@@ -130,7 +184,7 @@ TEST_F(IRBinaryRoundtripTest, Fn_Parameters) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Fn_ParameterAttributes) {
+TEST_P(IRBinaryRoundtripTest, Fn_ParameterAttributes) {
     auto* fn = b.Function("Function", ty.void_());
     auto* p0 = b.FunctionParam(ty.i32());
     auto* p1 = b.FunctionParam(ty.u32());
@@ -146,21 +200,21 @@ TEST_F(IRBinaryRoundtripTest, Fn_ParameterAttributes) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Fn_ReturnBuiltin) {
+TEST_P(IRBinaryRoundtripTest, Fn_ReturnBuiltin) {
     auto* fn = b.Function("Function", ty.void_());
     fn->SetReturnBuiltin(BuiltinValue::kFragDepth);
     b.ir.SetName(fn, "Function");
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Fn_ReturnLocation) {
+TEST_P(IRBinaryRoundtripTest, Fn_ReturnLocation) {
     auto* fn = b.Function("Function", ty.void_());
     fn->SetReturnLocation(42);
     b.ir.SetName(fn, "Function");
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Fn_ReturnLocation_Interpolation) {
+TEST_P(IRBinaryRoundtripTest, Fn_ReturnLocation_Interpolation) {
     auto* fn = b.Function("Function", ty.void_());
     fn->SetReturnLocation(0);
     fn->SetReturnInterpolation(core::Interpolation{
@@ -171,7 +225,7 @@ TEST_F(IRBinaryRoundtripTest, Fn_ReturnLocation_Interpolation) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Fn_ReturnInvariant) {
+TEST_P(IRBinaryRoundtripTest, Fn_ReturnInvariant) {
     auto* fn = b.Function("Function", ty.void_());
     fn->SetReturnInvariant(true);
     b.ir.SetName(fn, "Function");
@@ -181,57 +235,57 @@ TEST_F(IRBinaryRoundtripTest, Fn_ReturnInvariant) {
 ////////////////////////////////////////////////////////////////////////////////
 // Types
 ////////////////////////////////////////////////////////////////////////////////
-TEST_F(IRBinaryRoundtripTest, bool) {
+TEST_P(IRBinaryRoundtripTest, bool) {
     b.Append(b.ir.root_block, [&] { b.Var<private_, bool>(); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, i32) {
+TEST_P(IRBinaryRoundtripTest, i32) {
     b.Append(b.ir.root_block, [&] { b.Var<private_, i32>(); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, u32) {
+TEST_P(IRBinaryRoundtripTest, u32) {
     b.Append(b.ir.root_block, [&] { b.Var<private_, u32>(); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, f32) {
+TEST_P(IRBinaryRoundtripTest, f32) {
     b.Append(b.ir.root_block, [&] { b.Var<private_, f32>(); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, f16) {
+TEST_P(IRBinaryRoundtripTest, f16) {
     b.Append(b.ir.root_block, [&] { b.Var<private_, f16>(); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, vec2_f32) {
+TEST_P(IRBinaryRoundtripTest, vec2_f32) {
     b.Append(b.ir.root_block, [&] { b.Var<private_, vec2<f32>>(); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, vec3_i32) {
+TEST_P(IRBinaryRoundtripTest, vec3_i32) {
     b.Append(b.ir.root_block, [&] { b.Var<private_, vec3<i32>>(); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, vec4_bool) {
+TEST_P(IRBinaryRoundtripTest, vec4_bool) {
     b.Append(b.ir.root_block, [&] { b.Var<private_, vec4<bool>>(); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, mat4x2_f32) {
+TEST_P(IRBinaryRoundtripTest, mat4x2_f32) {
     b.Append(b.ir.root_block, [&] { b.Var<private_, vec4<mat4x2<f32>>>(); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, mat2x4_f16) {
+TEST_P(IRBinaryRoundtripTest, mat2x4_f16) {
     b.Append(b.ir.root_block, [&] { b.Var<private_, vec4<mat2x4<f16>>>(); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, ptr_function_f32_read_write) {
+TEST_P(IRBinaryRoundtripTest, ptr_function_f32_read_write) {
     auto p = b.FunctionParam<ptr<function, f32, read_write>>("p");
     auto* fn = b.Function("Function", ty.void_());
     fn->SetParams({p});
@@ -239,7 +293,7 @@ TEST_F(IRBinaryRoundtripTest, ptr_function_f32_read_write) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, ptr_workgroup_i32_read) {
+TEST_P(IRBinaryRoundtripTest, ptr_workgroup_i32_read) {
     auto p = b.FunctionParam<ptr<workgroup, i32, read>>("p");
     auto* fn = b.Function("Function", ty.void_());
     fn->SetParams({p});
@@ -247,17 +301,17 @@ TEST_F(IRBinaryRoundtripTest, ptr_workgroup_i32_read) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, array_i32_4) {
+TEST_P(IRBinaryRoundtripTest, array_i32_4) {
     b.Append(b.ir.root_block, [&] { b.Var<private_, array<i32, 4>>(); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, array_i32_runtime_sized) {
+TEST_P(IRBinaryRoundtripTest, array_i32_runtime_sized) {
     b.Append(b.ir.root_block, [&] { b.Var<storage, array<i32>>(); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, struct) {
+TEST_P(IRBinaryRoundtripTest, struct) {
     Vector members{
         ty.Get<core::type::StructMember>(b.ir.symbols.New("a"), ty.i32(), /* index */ 0u,
                                          /* offset */ 0u, /* align */ 4u, /* size */ 4u,
@@ -277,7 +331,7 @@ TEST_F(IRBinaryRoundtripTest, struct) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, IOAttributes) {
+TEST_P(IRBinaryRoundtripTest, IOAttributes) {
     core::IOAttributes attrs{};
     attrs.location = 1;
     attrs.blend_src = 2;
@@ -297,61 +351,61 @@ TEST_F(IRBinaryRoundtripTest, IOAttributes) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, atomic_i32) {
+TEST_P(IRBinaryRoundtripTest, atomic_i32) {
     b.Append(b.ir.root_block, [&] { b.Var<storage, atomic<i32>>(); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, depth_texture) {
+TEST_P(IRBinaryRoundtripTest, depth_texture) {
     auto* tex = ty.depth_texture(core::type::TextureDimension::k2d);
     b.Append(b.ir.root_block, [&] { b.Var(ty.ptr(handle, tex, read)); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, sampled_texture) {
+TEST_P(IRBinaryRoundtripTest, sampled_texture) {
     auto* tex = ty.sampled_texture(core::type::TextureDimension::k3d, ty.i32());
     b.Append(b.ir.root_block, [&] { b.Var(ty.ptr(handle, tex, read)); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, multisampled_texture) {
+TEST_P(IRBinaryRoundtripTest, multisampled_texture) {
     auto* tex = ty.multisampled_texture(core::type::TextureDimension::k2d, ty.f32());
     b.Append(b.ir.root_block, [&] { b.Var(ty.ptr(handle, tex, read)); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, depth_multisampled_texture) {
+TEST_P(IRBinaryRoundtripTest, depth_multisampled_texture) {
     auto* tex = ty.depth_multisampled_texture(core::type::TextureDimension::k2d);
     b.Append(b.ir.root_block, [&] { b.Var(ty.ptr(handle, tex, read)); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, storage_texture) {
+TEST_P(IRBinaryRoundtripTest, storage_texture) {
     auto* tex = ty.storage_texture(core::type::TextureDimension::k2dArray,
                                    core::TexelFormat::kRg32Float, core::Access::kReadWrite);
     b.Append(b.ir.root_block, [&] { b.Var(ty.ptr(handle, tex, read)); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, texel_buffer) {
+TEST_P(IRBinaryRoundtripTest, texel_buffer) {
     auto* buf = ty.texel_buffer(core::TexelFormat::kRgba32Float, core::Access::kReadWrite);
     b.Append(b.ir.root_block, [&] { b.Var(ty.ptr(handle, buf, read)); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, external_texture) {
+TEST_P(IRBinaryRoundtripTest, external_texture) {
     auto* tex = ty.external_texture();
     b.Append(b.ir.root_block, [&] { b.Var(ty.ptr(handle, tex, read)); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, sampler) {
+TEST_P(IRBinaryRoundtripTest, sampler) {
     auto* sampler = ty.sampler();
     b.Append(b.ir.root_block, [&] { b.Var(ty.ptr(handle, sampler, read)); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, comparision_sampler) {
+TEST_P(IRBinaryRoundtripTest, comparision_sampler) {
     auto* sampler = ty.comparison_sampler();
     b.Append(b.ir.root_block, [&] { b.Var(ty.ptr(handle, sampler, read)); });
     RUN_TEST();
@@ -360,55 +414,55 @@ TEST_F(IRBinaryRoundtripTest, comparision_sampler) {
 ////////////////////////////////////////////////////////////////////////////////
 // Instructions
 ////////////////////////////////////////////////////////////////////////////////
-TEST_F(IRBinaryRoundtripTest, Return) {
+TEST_P(IRBinaryRoundtripTest, Return) {
     auto* fn = b.Function("Function", ty.void_());
     b.Append(fn->Block(), [&] { b.Return(fn); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Return_bool) {
+TEST_P(IRBinaryRoundtripTest, Return_bool) {
     auto* fn = b.Function("Function", ty.bool_());
     b.Append(fn->Block(), [&] { b.Return(fn, true); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Return_i32) {
+TEST_P(IRBinaryRoundtripTest, Return_i32) {
     auto* fn = b.Function("Function", ty.i32());
     b.Append(fn->Block(), [&] { b.Return(fn, 42_i); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Return_u32) {
+TEST_P(IRBinaryRoundtripTest, Return_u32) {
     auto* fn = b.Function("Function", ty.u32());
     b.Append(fn->Block(), [&] { b.Return(fn, 42_u); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Return_f32) {
+TEST_P(IRBinaryRoundtripTest, Return_f32) {
     auto* fn = b.Function("Function", ty.f32());
     b.Append(fn->Block(), [&] { b.Return(fn, 42_f); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Return_f16) {
+TEST_P(IRBinaryRoundtripTest, Return_f16) {
     auto* fn = b.Function("Function", ty.f16());
     b.Append(fn->Block(), [&] { b.Return(fn, 42_h); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Return_vec3f_Composite) {
+TEST_P(IRBinaryRoundtripTest, Return_vec3f_Composite) {
     auto* fn = b.Function("Function", ty.vec3<f32>());
     b.Append(fn->Block(), [&] { b.Return(fn, b.Composite<vec3<f32>>(1_f, 2_f, 3_f)); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Return_vec3f_Splat) {
+TEST_P(IRBinaryRoundtripTest, Return_vec3f_Splat) {
     auto* fn = b.Function("Function", ty.vec3<f32>());
     b.Append(fn->Block(), [&] { b.Return(fn, b.Splat<vec3<f32>>(1_f)); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Return_mat2x3f_Composite) {
+TEST_P(IRBinaryRoundtripTest, Return_mat2x3f_Composite) {
     auto* fn = b.Function("Function", ty.mat2x3<f32>());
     b.Append(fn->Block(), [&] {
         b.Return(fn, b.Composite<mat2x3<f32>>(b.Composite<vec3<f32>>(1_f, 2_f, 3_f),
@@ -417,25 +471,25 @@ TEST_F(IRBinaryRoundtripTest, Return_mat2x3f_Composite) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Return_mat2x3f_Splat) {
+TEST_P(IRBinaryRoundtripTest, Return_mat2x3f_Splat) {
     auto* fn = b.Function("Function", ty.mat2x3<f32>());
     b.Append(fn->Block(), [&] { b.Return(fn, b.Splat<mat2x3<f32>>(b.Splat<vec3<f32>>(1_f))); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Return_array_f32_Composite) {
+TEST_P(IRBinaryRoundtripTest, Return_array_f32_Composite) {
     auto* fn = b.Function("Function", ty.array<f32, 3>());
     b.Append(fn->Block(), [&] { b.Return(fn, b.Composite<array<f32, 3>>(1_f, 2_f, 3_f)); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Return_array_f32_Splat) {
+TEST_P(IRBinaryRoundtripTest, Return_array_f32_Splat) {
     auto* fn = b.Function("Function", ty.array<f32, 3>());
     b.Append(fn->Block(), [&] { b.Return(fn, b.Splat<array<f32, 3>>(1_f)); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Construct) {
+TEST_P(IRBinaryRoundtripTest, Construct) {
     auto* fn = b.Function("Function", ty.void_());
     b.Append(fn->Block(), [&] {
         b.Construct<vec3<f32>>(1_f, 2_f, 3_f);
@@ -444,7 +498,7 @@ TEST_F(IRBinaryRoundtripTest, Construct) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Discard) {
+TEST_P(IRBinaryRoundtripTest, Discard) {
     auto* fn = b.Function("Function", ty.void_());
     b.Append(fn->Block(), [&] {
         b.Discard();
@@ -453,7 +507,7 @@ TEST_F(IRBinaryRoundtripTest, Discard) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Let) {
+TEST_P(IRBinaryRoundtripTest, Let) {
     auto* fn = b.Function("Function", ty.void_());
     b.Append(fn->Block(), [&] {
         b.Let("Let", b.Constant(42_i));
@@ -462,7 +516,7 @@ TEST_F(IRBinaryRoundtripTest, Let) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Var) {
+TEST_P(IRBinaryRoundtripTest, Var) {
     auto* fn = b.Function("Function", ty.void_());
     b.Append(fn->Block(), [&] {
         b.Var<function>("Var", b.Constant(42_i));
@@ -471,14 +525,14 @@ TEST_F(IRBinaryRoundtripTest, Var) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Access) {
+TEST_P(IRBinaryRoundtripTest, Access) {
     auto* fn = b.Function("Function", ty.f32());
     b.Append(fn->Block(),
              [&] { b.Return(fn, b.Access<f32>(b.Construct<mat4x4<f32>>(), 1_u, 2_u)); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, UserCall) {
+TEST_P(IRBinaryRoundtripTest, UserCall) {
     auto* fn_a = b.Function("A", ty.f32());
     b.Append(fn_a->Block(), [&] { b.Return(fn_a, 42_f); });
     auto* fn_b = b.Function("B", ty.f32());
@@ -486,13 +540,13 @@ TEST_F(IRBinaryRoundtripTest, UserCall) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, BuiltinCall) {
+TEST_P(IRBinaryRoundtripTest, BuiltinCall) {
     auto* fn = b.Function("Function", ty.f32());
     b.Append(fn->Block(), [&] { b.Return(fn, b.Call<i32>(core::BuiltinFn::kMax, 1_i, 2_i)); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Load) {
+TEST_P(IRBinaryRoundtripTest, Load) {
     auto p = b.FunctionParam<ptr<function, f32, read_write>>("p");
     auto* fn = b.Function("Function", ty.f32());
     fn->SetParams({p});
@@ -500,7 +554,7 @@ TEST_F(IRBinaryRoundtripTest, Load) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Store) {
+TEST_P(IRBinaryRoundtripTest, Store) {
     auto p = b.FunctionParam<ptr<function, f32, read_write>>("p");
     auto* fn = b.Function("Function", ty.void_());
     fn->SetParams({p});
@@ -511,7 +565,7 @@ TEST_F(IRBinaryRoundtripTest, Store) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, LoadVectorElement) {
+TEST_P(IRBinaryRoundtripTest, LoadVectorElement) {
     auto p = b.FunctionParam<ptr<function, vec3<f32>, read_write>>("p");
     auto* fn = b.Function("Function", ty.f32());
     fn->SetParams({p});
@@ -519,7 +573,7 @@ TEST_F(IRBinaryRoundtripTest, LoadVectorElement) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, StoreVectorElement) {
+TEST_P(IRBinaryRoundtripTest, StoreVectorElement) {
     auto p = b.FunctionParam<ptr<function, vec3<f32>, read_write>>("p");
     auto* fn = b.Function("Function", ty.void_());
     fn->SetParams({p});
@@ -530,7 +584,7 @@ TEST_F(IRBinaryRoundtripTest, StoreVectorElement) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, UnaryOp) {
+TEST_P(IRBinaryRoundtripTest, UnaryOp) {
     auto* x = b.FunctionParam<bool>("x");
     auto* fn = b.Function("Function", ty.bool_());
     fn->SetParams({x});
@@ -538,7 +592,7 @@ TEST_F(IRBinaryRoundtripTest, UnaryOp) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, BinaryOp) {
+TEST_P(IRBinaryRoundtripTest, BinaryOp) {
     auto* x = b.FunctionParam<f32>("x");
     auto* y = b.FunctionParam<f32>("y");
     auto* fn = b.Function("Function", ty.f32());
@@ -547,7 +601,7 @@ TEST_F(IRBinaryRoundtripTest, BinaryOp) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Swizzle) {
+TEST_P(IRBinaryRoundtripTest, Swizzle) {
     auto* x = b.FunctionParam<vec4<f32>>("x");
     auto* fn = b.Function("Function", ty.vec3<f32>());
     fn->SetParams({x});
@@ -557,7 +611,7 @@ TEST_F(IRBinaryRoundtripTest, Swizzle) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Bitcast) {
+TEST_P(IRBinaryRoundtripTest, Bitcast) {
     auto* x = b.FunctionParam<vec4<f32>>("x");
     auto* fn = b.Function("Function", ty.vec4<u32>());
     fn->SetParams({x});
@@ -565,7 +619,7 @@ TEST_F(IRBinaryRoundtripTest, Bitcast) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Convert) {
+TEST_P(IRBinaryRoundtripTest, Convert) {
     auto* x = b.FunctionParam<vec4<f32>>("x");
     auto* fn = b.Function("Function", ty.vec4<u32>());
     fn->SetParams({x});
@@ -573,7 +627,7 @@ TEST_F(IRBinaryRoundtripTest, Convert) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, IfTrue) {
+TEST_P(IRBinaryRoundtripTest, IfTrue) {
     auto* cond = b.FunctionParam<bool>("cond");
     auto* x = b.FunctionParam<i32>("x");
     auto* fn = b.Function("Function", ty.i32());
@@ -585,7 +639,7 @@ TEST_F(IRBinaryRoundtripTest, IfTrue) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, IfFalse) {
+TEST_P(IRBinaryRoundtripTest, IfFalse) {
     auto* cond = b.FunctionParam<bool>("cond");
     auto* x = b.FunctionParam<i32>("x");
     auto* fn = b.Function("Function", ty.i32());
@@ -597,7 +651,7 @@ TEST_F(IRBinaryRoundtripTest, IfFalse) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, IfTrueFalse) {
+TEST_P(IRBinaryRoundtripTest, IfTrueFalse) {
     auto* cond = b.FunctionParam<bool>("cond");
     auto* x = b.FunctionParam<i32>("x");
     auto* y = b.FunctionParam<i32>("y");
@@ -611,7 +665,7 @@ TEST_F(IRBinaryRoundtripTest, IfTrueFalse) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, IfResults) {
+TEST_P(IRBinaryRoundtripTest, IfResults) {
     auto* cond = b.FunctionParam<bool>("cond");
     auto* fn = b.Function("Function", ty.i32());
     fn->SetParams({cond});
@@ -627,7 +681,7 @@ TEST_F(IRBinaryRoundtripTest, IfResults) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Switch) {
+TEST_P(IRBinaryRoundtripTest, Switch) {
     auto* x = b.FunctionParam<i32>("x");
     auto* fn = b.Function("Function", ty.i32());
     fn->SetParams({x});
@@ -640,7 +694,7 @@ TEST_F(IRBinaryRoundtripTest, Switch) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, SwitchResults) {
+TEST_P(IRBinaryRoundtripTest, SwitchResults) {
     auto* x = b.FunctionParam<i32>("x");
     auto* fn = b.Function("Function", ty.i32());
     fn->SetParams({x});
@@ -657,7 +711,7 @@ TEST_F(IRBinaryRoundtripTest, SwitchResults) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, LoopBody) {
+TEST_P(IRBinaryRoundtripTest, LoopBody) {
     auto* fn = b.Function("Function", ty.i32());
     b.Append(fn->Block(), [&] {
         auto* loop = b.Loop();
@@ -666,7 +720,7 @@ TEST_F(IRBinaryRoundtripTest, LoopBody) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, LoopInitBody) {
+TEST_P(IRBinaryRoundtripTest, LoopInitBody) {
     auto* fn = b.Function("Function", ty.i32());
     b.Append(fn->Block(), [&] {
         auto* loop = b.Loop();
@@ -679,7 +733,7 @@ TEST_F(IRBinaryRoundtripTest, LoopInitBody) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, LoopInitBodyCont) {
+TEST_P(IRBinaryRoundtripTest, LoopInitBodyCont) {
     auto* fn = b.Function("Function", ty.i32());
     b.Append(fn->Block(), [&] {
         auto* loop = b.Loop();
@@ -693,7 +747,7 @@ TEST_F(IRBinaryRoundtripTest, LoopInitBodyCont) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, LoopResults) {
+TEST_P(IRBinaryRoundtripTest, LoopResults) {
     auto* fn = b.Function("Function", ty.i32());
     b.Append(fn->Block(), [&] {
         auto* loop = b.Loop();
@@ -705,7 +759,7 @@ TEST_F(IRBinaryRoundtripTest, LoopResults) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, LoopBlockParams) {
+TEST_P(IRBinaryRoundtripTest, LoopBlockParams) {
     auto* fn = b.Function("Function", ty.void_());
     b.Append(fn->Block(), [&] {
         auto* loop_res_a = b.InstructionResult(ty.i32());
@@ -734,13 +788,13 @@ TEST_F(IRBinaryRoundtripTest, LoopBlockParams) {
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, Unreachable) {
+TEST_P(IRBinaryRoundtripTest, Unreachable) {
     auto* fn = b.Function("Function", ty.i32());
     b.Append(fn->Block(), [&] { b.Unreachable(); });
     RUN_TEST();
 }
 
-TEST_F(IRBinaryRoundtripTest, InputAttachment) {
+TEST_P(IRBinaryRoundtripTest, InputAttachment) {
     b.Append(b.ir.root_block, [&] {
         auto* input_type = ty.input_attachment(ty.i32());
         auto* v = b.Var(ty.ptr(handle, input_type, read));
@@ -754,5 +808,168 @@ TEST_F(IRBinaryRoundtripTest, InputAttachment) {
     RUN_TEST();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Overrides
+////////////////////////////////////////////////////////////////////////////////
+// The protobuf form does not support overrides, so these only use the flat form.
+using IRBinaryFlatRoundtripTest = IRBinaryRoundtripTestBase<>;
+INSTANTIATE_TEST_SUITE_P(, IRBinaryFlatRoundtripTest, testing::Values(Codec::kFlat), PrintCodec);
+
+TEST_P(IRBinaryFlatRoundtripTest, Override_NoInitializer) {
+    b.Append(b.ir.root_block, [&] { b.Override("o", ty.u32()); });
+    RUN_TEST();
+}
+
+TEST_P(IRBinaryFlatRoundtripTest, Override_Initializer) {
+    b.Append(b.ir.root_block, [&] { b.Override("o", 42_i); });
+    RUN_TEST();
+}
+
+TEST_P(IRBinaryFlatRoundtripTest, Override_Id) {
+    b.Append(b.ir.root_block, [&] {
+        auto* o = b.Override("o", 1.5_f);
+        o->SetOverrideId({1234});
+    });
+    RUN_TEST();
+}
+
+TEST_P(IRBinaryFlatRoundtripTest, Override_Expression) {
+    b.Append(b.ir.root_block, [&] {
+        auto* x = b.Override("x", ty.u32());
+        auto* y = b.Multiply(ty.u32(), x, 2_u);
+        b.Override("y", y);
+    });
+    RUN_TEST();
+}
+
+TEST_P(IRBinaryFlatRoundtripTest, OverrideSizedArray) {
+    b.Append(b.ir.root_block, [&] {
+        auto* x = b.Override("x", ty.u32());
+        x->SetOverrideId({2});
+        auto* cnt = ty.Get<core::ir::type::ValueArrayCount>(x->Result());
+        auto* ary = ty.Get<core::type::Array>(ty.i32(), cnt, 4_u, 4_u, 4_u, 4_u);
+        b.Var("v", ty.ptr(workgroup, ary, read_write));
+    });
+    RUN_TEST();
+}
+
+TEST_P(IRBinaryFlatRoundtripTest, OverrideSizedArray_Expression) {
+    b.Append(b.ir.root_block, [&] {
+        auto* x = b.Override("x", ty.u32());
+        auto* count = b.Multiply(ty.u32(), x, 2_u);
+        auto* cnt = ty.Get<core::ir::type::ValueArrayCount>(count->Result());
+        auto* ary = ty.Get<core::type::Array>(ty.vec4<f32>(), cnt, 16_u, 32_u, 32_u, 16_u);
+        b.Var("v", ty.ptr(workgroup, ary, read_write));
+    });
+    RUN_TEST();
+}
+
+// The count is encoded as the workgroup size of the function before the type of the array.
+TEST_P(IRBinaryFlatRoundtripTest, OverrideSizedArray_CountUsedByFunction) {
+    ir::Var* v = nullptr;
+    ir::Override* x = nullptr;
+    b.Append(b.ir.root_block, [&] {
+        x = b.Override("x", 4_u);
+        auto* cnt = ty.Get<core::ir::type::ValueArrayCount>(x->Result());
+        auto* ary = ty.Get<core::type::Array>(ty.u32(), cnt, 4_u, 4_u, 4_u, 4_u);
+        v = b.Var("v", ty.ptr(workgroup, ary, read_write));
+    });
+
+    auto* fn = b.ComputeFunction("main");
+    fn->SetWorkgroupSize(x->Result(), b.Constant(1_u), b.Constant(1_u));
+    b.Append(fn->Block(), [&] {
+        b.Store(b.Access(ty.ptr<workgroup, u32>(), v, 0_u), 1_u);
+        b.Return(fn);
+    });
+    RUN_TEST();
+}
+
+// A single encoding of a module with overrides can be decoded once per pipeline, each with
+// different override values substituted afterwards.
+TEST_P(IRBinaryFlatRoundtripTest, Override_DecodeTwice) {
+    ir::Override* x = nullptr;
+    b.Append(b.ir.root_block, [&] {
+        x = b.Override("x", 1_u);
+        x->SetOverrideId({0});
+    });
+
+    auto* fn = b.ComputeFunction("main");
+    b.Append(fn->Block(), [&] {
+        b.Let("y", b.Multiply(ty.u32(), x, 2_u));
+        b.Return(fn);
+    });
+
+    auto pre = Disassembler(mod).Plain();
+    auto encoded = EncodeToBinary(mod);
+    ASSERT_TRUE(encoded == Success) << encoded.Failure().reason;
+
+    auto first = Decode(encoded->Slice());
+    ASSERT_EQ(first, Success) << first.Failure().reason;
+    auto second = Decode(encoded->Slice());
+    ASSERT_EQ(second, Success) << second.Failure().reason;
+    EXPECT_EQ(pre, Disassembler(first.Get()).Plain());
+    EXPECT_EQ(pre, Disassembler(second.Get()).Plain());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Malformed input
+////////////////////////////////////////////////////////////////////////////////
+class IRBinaryDecodeTest : public IRTestHelper {
+  public:
+    Vector<std::byte, 0> Encode() {
+        b.Append(b.ir.root_block, [&] { b.Var<private_, i32>("v"); });
+        auto* fn = b.Function("Function", ty.i32());
+        b.Append(fn->Block(), [&] { b.Return(fn, 42_i); });
+        auto encoded = EncodeToBinary(mod);
+        TINT_ASSERT(encoded == Success);
+        return encoded.Get();
+    }
+};
+
+TEST_F(IRBinaryDecodeTest, InvalidMagic) {
+    auto encoded = Encode();
+    encoded[0] = std::byte{0};
+    auto decoded = Decode(encoded.Slice());
+    ASSERT_NE(decoded, Success);
+    EXPECT_EQ(decoded.Failure().reason, "IR binary has an invalid magic number");
+}
+
+TEST_F(IRBinaryDecodeTest, ChecksumMismatch) {
+    auto encoded = Encode();
+    encoded.Back() ^= std::byte{1};
+    auto decoded = Decode(encoded.Slice());
+    ASSERT_NE(decoded, Success);
+    EXPECT_EQ(decoded.Failure().reason, "IR binary section 6 checksum mismatch");
+}
+
+TEST_F(IRBinaryDecodeTest, Truncated) {
+    auto encoded = Encode();
+    encoded.Pop();
+    auto decoded = Decode(encoded.Slice());
+    ASSERT_NE(decoded, Success);
+    EXPECT_EQ(decoded.Failure().reason, "IR binary section 6 is truncated");
+}
+
+TEST_F(IRBinaryDecodeTest, TrailingData) {
+    auto encoded = Encode();
+    encoded.Push(std::byte{0});
+    auto decoded = Decode(encoded.Slice());
+    ASSERT_NE(decoded, Success);
+    EXPECT_EQ(decoded.Failure().reason, "IR binary has trailing data");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Unsupported input
+////////////////////////////////////////////////////////////////////////////////
+using IRBinaryEncodeTest = IRTestHelper;
+
+TEST_F(IRBinaryEncodeTest, UnsupportedInstruction) {
+    auto* fn = b.Function("Function", ty.void_(), Function::PipelineStage::kFragment);
+    b.Append(fn->Block(), [&] { b.TerminateInvocation(); });
+    auto encoded = EncodeToBinary(mod);
+    ASSERT_TRUE(encoded != Success);
+    EXPECT_EQ(encoded.Failure().reason, "unsupported instruction: terminate_invocation\n");
+}
+
 }  // namespace
 }  // namespace tint::core::ir::binary
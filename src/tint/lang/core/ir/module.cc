@@ -112,7 +112,10 @@ struct FunctionSorter {
 
 }  // namespace
 
-Module::Module() : root_block(blocks.Create<ir::Block>()) {}
+Module::Module()
+    : root_block(blocks.Create<ir::Block>()),
+      allocators_{BlockAllocator<Instruction>{*arena_.allocator},
+                  BlockAllocator<Value>{*arena_.allocator}} {}
 
 Module::Module(Module&&) = default;
 
@@ -28,6 +28,7 @@
 #ifndef SRC_TINT_LANG_CORE_IR_MODULE_H_
 #define SRC_TINT_LANG_CORE_IR_MODULE_H_
 
+#include <memory>
 #include <utility>
 
 #include "src/tint/lang/core/constant/manager.h"
@@ -43,12 +44,29 @@
 #include "src/tint/utils/diagnostic/source.h"
 #include "src/tint/utils/generation_id.h"
 #include "src/tint/utils/memory/block_allocator.h"
+#include "src/tint/utils/memory/bump_allocator.h"
 #include "src/tint/utils/symbol/symbol_table.h"
 
 namespace tint::core::ir {
 
 /// Main module class for the IR.
 class Module {
+    /// Holds the arena that backs the memory of the module's blocks, instructions and values.
+    /// Move-assignment swaps the arenas, so that the objects allocated from the previously held
+    /// arena are destructed before the arena is freed along with the moved-from module.
+    struct Arena {
+        Arena() = default;
+        Arena(Arena&&) = default;
+        Arena& operator=(Arena&& o) {
+            std::swap(allocator, o.allocator);
+            return *this;
+        }
+        std::unique_ptr<BumpAllocator> allocator = std::make_unique<BumpAllocator>();
+    };
+
+    /// The arena. This must be declared before the allocators that use it.
+    Arena arena_;
+
     /// Program Id required to create other components
     GenerationID prog_id_;
 
@@ -182,8 +200,14 @@ class Module {
     /// @param func the function to destroy
     void Destroy(Function* func);
 
+    /// @returns the number of bytes of heap memory held by the arena for the module's blocks,
+    /// instructions and values. The arena only grows, so this is also its peak usage.
+    size_t ArenaBytesReserved() const {
+        return arena_.allocator ? arena_.allocator->BytesReserved() : 0;
+    }
+
     /// The block allocator
-    BlockAllocator<Block> blocks;
+    BlockAllocator<Block> blocks{*arena_.allocator};
 
     /// The constant value manager
     core::constant::Manager constant_values;
@@ -98,5 +98,34 @@ TEST_F(IR_ModuleTest, DependencyOrderedFunctions) {
     EXPECT_THAT(mod.DependencyOrderedFunctions(), ElementsAre(fd, fc, fb, fa));
 }
 
+TEST_F(IR_ModuleTest, ArenaBytesReserved) {
+    size_t reserved = mod.ArenaBytesReserved();
+    EXPECT_GT(reserved, 0u);  // The root block
+
+    auto* f = b.Function("f", ty.void_());
+    b.Append(f->Block(), [&] {
+        for (size_t i = 0; i < 10000; i++) {
+            b.Var(ty.ptr<function, i32>());
+        }
+        b.Return(f);
+    });
+    EXPECT_GT(mod.ArenaBytesReserved(), reserved);
+}
+
+TEST_F(IR_ModuleTest, MoveAssign) {
+    Module other;
+    auto* f = Builder{other}.Function("f", other.Types().void_());
+    other.SetName(f, "g");
+
+    mod = std::move(other);
+    ASSERT_EQ(mod.functions.Length(), 1u);
+    EXPECT_EQ(mod.functions[0], f);
+    EXPECT_EQ(mod.NameOf(f).Name(), "g");
+    EXPECT_GT(mod.ArenaBytesReserved(), 0u);
+
+    // The moved module can still be built.
+    b.Append(f->Block(), [&] { b.Return(f); });
+}
+
 }  // namespace
 }  // namespace tint::core::ir
@@ -60,7 +60,9 @@ tint_add_target(tint_lang_core_ir_transform lib
   lang/core/ir/transform/change_immediate_to_uniform.cc
   lang/core/ir/transform/change_immediate_to_uniform.h
   lang/core/ir/transform/combine_access_instructions.cc
+  lang/core/ir/transform/constant_propagation.cc
   lang/core/ir/transform/combine_access_instructions.h
+  lang/core/ir/transform/constant_propagation.h
   lang/core/ir/transform/conversion_polyfill.cc
   lang/core/ir/transform/conversion_polyfill.h
   lang/core/ir/transform/dead_code_elimination.cc
@@ -147,6 +149,7 @@ tint_add_target(tint_lang_core_ir_transform_test test
   lang/core/ir/transform/builtin_scalarize_test.cc
   lang/core/ir/transform/change_immediate_to_uniform_test.cc
   lang/core/ir/transform/combine_access_instructions_test.cc
+  lang/core/ir/transform/constant_propagation_test.cc
   lang/core/ir/transform/conversion_polyfill_test.cc
   lang/core/ir/transform/dead_code_elimination_test.cc
   lang/core/ir/transform/demote_to_helper_test.cc
@@ -209,6 +212,7 @@ tint_add_target(tint_lang_core_ir_transform_fuzz fuzz
   lang/core/ir/transform/block_decorated_structs_fuzz.cc
   lang/core/ir/transform/builtin_polyfill_fuzz.cc
   lang/core/ir/transform/combine_access_instructions_fuzz.cc
+  lang/core/ir/transform/constant_propagation_fuzz.cc
   lang/core/ir/transform/conversion_polyfill_fuzz.cc
   lang/core/ir/transform/dead_code_elimination_fuzz.cc
   lang/core/ir/transform/demote_to_helper_fuzz.cc
@@ -0,0 +1,411 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/transform/constant_propagation.h"
+
+#include <cstdint>
+
+#include "src/tint/lang/core/ir/access.h"
+#include "src/tint/lang/core/ir/bitcast.h"
+#include "src/tint/lang/core/ir/builder.h"
+#include "src/tint/lang/core/ir/construct.h"
+#include "src/tint/lang/core/ir/convert.h"
+#include "src/tint/lang/core/ir/core_binary.h"
+#include "src/tint/lang/core/ir/core_builtin_call.h"
+#include "src/tint/lang/core/ir/core_unary.h"
+#include "src/tint/lang/core/ir/evaluator.h"
+#include "src/tint/lang/core/ir/exit.h"
+#include "src/tint/lang/core/ir/if.h"
+#include "src/tint/lang/core/ir/let.h"
+#include "src/tint/lang/core/ir/module.h"
+#include "src/tint/lang/core/ir/switch.h"
+#include "src/tint/lang/core/ir/swizzle.h"
+#include "src/tint/lang/core/ir/traverse.h"
+#include "src/tint/lang/core/ir/validator.h"
+#include "src/tint/utils/rtti/switch.h"
+
+using namespace tint::core::fluent_types;     // NOLINT
+using namespace tint::core::number_suffixes;  // NOLINT
+
+namespace tint::core::ir::transform {
+
+namespace {
+
+/// @returns true if @p pred returns true for every scalar element of @p value
+template <typename PREDICATE>
+bool AllScalars(const core::constant::Value* value, PREDICATE&& pred) {
+    if (value->Type()->Is<core::type::Scalar>()) {
+        return pred(value);
+    }
+    for (size_t i = 0; i < value->NumElements(); i++) {
+        if (!AllScalars(value->Index(i), pred)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @returns true if every element of @p value is one
+bool IsOne(const core::constant::Value* value) {
+    return AllScalars(value, [](const core::constant::Value* v) {
+        return v->Type()->IsFloatScalar() ? v->ValueAs<AFloat>() == 1.0 : v->ValueAs<AInt>() == 1;
+    });
+}
+
+/// @returns true if every element of @p value has all of its bits set
+bool IsAllOnes(const core::constant::Value* value) {
+    return AllScalars(value, [](const core::constant::Value* v) {
+        return tint::Switch(
+            v->Type(),  //
+            [&](const core::type::Bool*) { return v->ValueAs<bool>(); },
+            [&](const core::type::I32*) { return v->ValueAs<AInt>() == -1; },
+            [&](const core::type::U32*) { return v->ValueAs<AInt>() == 0xffffffff; },
+            [&](Default) { return false; });
+    });
+}
+
+/// @returns true if @p inst has no side effects, and can be removed if its result is unused
+bool IsPure(Instruction* inst) {
+    return inst->IsAnyOf<Access, Bitcast, Construct, Convert, CoreBinary, CoreUnary, Let, Swizzle>();
+}
+
+/// PIMPL state for the transform.
+struct State {
+    /// The IR module.
+    Module& ir;
+
+    /// The IR builder.
+    Builder b{ir};
+
+    /// The evaluator used to fold instructions.
+    Evaluator evaluator{b};
+
+    /// The instructions that need to be visited. Instructions are appended as the values that
+    /// they use become constant, and may appear more than once.
+    Vector<Instruction*, 64> worklist;
+
+    /// Process the module.
+    void Process() {
+        for (auto func : ir.functions) {
+            Traverse(func->Block(), [&](Instruction* inst) { worklist.Push(inst); });
+        }
+
+        for (size_t i = 0; i < worklist.Length(); i++) {
+            auto* inst = worklist[i];
+            // Instructions in the root block may be referenced by non-usages, such as array counts
+            // and workgroup sizes, so are never modified.
+            if (!inst->Alive() || inst->Block() == ir.root_block) {
+                continue;
+            }
+            tint::Switch(
+                inst,  //
+                [&](If* if_) { FoldIf(if_); },
+                [&](Switch* switch_) { FoldSwitch(switch_); },
+                [&](Let* let) {
+                    if (auto* value = let->Value()->As<Constant>()) {
+                        ReplaceResult(let, value);
+                    }
+                },
+                [&](CoreBinary* binary) {
+                    if (!Fold(binary)) {
+                        Simplify(binary);
+                    }
+                },
+                [&](CoreBuiltinCall* call) {
+                    if (!Fold(call)) {
+                        FoldSelect(call);
+                    }
+                },
+                [&](Default) { Fold(inst); });
+        }
+    }
+
+    /// Attempts to evaluate @p inst, replacing it with the resulting constant.
+    /// @param inst the instruction
+    /// @returns true if @p inst was replaced
+    bool Fold(Instruction* inst) {
+        bool evaluable = tint::Switch(
+            inst,  //
+            [&](Access*) { return true; },
+            [&](Bitcast*) { return true; },
+            [&](Construct*) { return true; },
+            [&](Convert*) { return true; },
+            [&](CoreBinary* binary) {
+                // Short-circuiting operators are never evaluated by the evaluator.
+                return binary->Op() != BinaryOp::kLogicalAnd &&
+                       binary->Op() != BinaryOp::kLogicalOr;
+            },
+            [&](CoreBuiltinCall*) { return true; },
+            [&](CoreUnary*) { return true; },
+            [&](Swizzle*) { return true; },
+            [&](Default) { return false; });
+        if (!evaluable || inst->Results().Length() != 1 ||
+            inst->Result()->Type()->Is<core::type::Void>()) {
+            return false;
+        }
+
+        // Only fold instructions whose operands are all constant. This keeps the evaluation local
+        // to the instruction, and prevents the evaluator from looking through an `override` to its
+        // default initializer.
+        auto operands = inst->Operands();
+        if (operands.IsEmpty()) {
+            return false;
+        }
+        for (auto* operand : operands) {
+            if (!operand || !operand->Is<Constant>()) {
+                return false;
+            }
+        }
+
+        // Failing to evaluate is not an error, as the instruction may fail at shader-creation time
+        // but be well defined at runtime (such as an integer division by zero).
+        auto folded = evaluator.Evaluate(inst->Result());
+        if (folded != Success || !folded.Get()) {
+            return false;
+        }
+        ReplaceResult(inst, folded.Get());
+        return true;
+    }
+
+    /// Applies algebraic identities to @p binary, replacing it with one of its operands.
+    /// @param binary the binary instruction
+    void Simplify(CoreBinary* binary) {
+        auto* lhs = binary->LHS();
+        auto* rhs = binary->RHS();
+        auto* lhs_const = lhs->As<Constant>();
+        auto* rhs_const = rhs->As<Constant>();
+        auto* type = binary->Result()->Type();
+
+        auto lhs_is = [&](auto&& pred) { return lhs_const && pred(lhs_const->Value()); };
+        auto rhs_is = [&](auto&& pred) { return rhs_const && pred(rhs_const->Value()); };
+        auto is_zero = [](const core::constant::Value* v) { return v->AllZero(); };
+        auto is_one = [](const core::constant::Value* v) {
+            // An all-ones matrix is not an identity for matrix multiplication.
+            return !v->Type()->Is<core::type::Matrix>() && IsOne(v);
+        };
+
+        Value* replacement = nullptr;
+        switch (binary->Op()) {
+            case BinaryOp::kAdd:
+                // `-0.0 + 0.0` is `0.0`, so this only holds for integers.
+                if (type->IsIntegerScalarOrVector()) {
+                    if (rhs_is(is_zero)) {
+                        replacement = lhs;
+                    } else if (lhs_is(is_zero)) {
+                        replacement = rhs;
+                    }
+                }
+                break;
+            case BinaryOp::kSubtract:
+            case BinaryOp::kShiftLeft:
+            case BinaryOp::kShiftRight:
+                if (rhs_is(is_zero)) {
+                    replacement = lhs;
+                }
+                break;
+            case BinaryOp::kMultiply:
+                if (rhs_is(is_one)) {
+                    replacement = lhs;
+                } else if (lhs_is(is_one)) {
+                    replacement = rhs;
+                }
+                break;
+            case BinaryOp::kDivide:
+                if (rhs_is(is_one)) {
+                    replacement = lhs;
+                }
+                break;
+            case BinaryOp::kOr:
+            case BinaryOp::kXor:
+                if (rhs_is(is_zero)) {
+                    replacement = lhs;
+                } else if (lhs_is(is_zero)) {
+                    replacement = rhs;
+                }
+                break;
+            case BinaryOp::kAnd:
+                if (rhs_is(IsAllOnes)) {
+                    replacement = lhs;
+                } else if (lhs_is(IsAllOnes)) {
+                    replacement = rhs;
+                }
+                break;
+            default:
+                break;
+        }
+
+        // The identity does not hold if the operand is splatted by the operation (such as in
+        // `scalar * vec3(1)`).
+        if (replacement && replacement->Type() == type) {
+            ReplaceResult(binary, replacement);
+        }
+    }
+
+    /// Replaces a `select` call that has a uniform constant condition with the selected operand.
+    /// @param call the builtin call
+    void FoldSelect(CoreBuiltinCall* call) {
+        if (call->Func() != core::BuiltinFn::kSelect) {
+            return;
+        }
+        auto* cond = call->Args()[2]->As<Constant>();
+        if (!cond) {
+            return;
+        }
+        auto* value = cond->Value();
+        Value* replacement = nullptr;
+        if (value->AllZero()) {
+            replacement = call->Args()[0];
+        } else if (IsAllOnes(value)) {
+            replacement = call->Args()[1];
+        }
+        if (replacement) {
+            ReplaceResult(call, replacement);
+        }
+    }
+
+    /// Replaces an `if` that has a constant condition with the block that it would execute.
+    /// @param if_ the if instruction
+    void FoldIf(If* if_) {
+        if (auto* cond = if_->Condition()->As<Constant>()) {
+            InlineBlock(if_, cond->Value()->ValueAs<bool>() ? if_->True() : if_->False());
+        }
+    }
+
+    /// Replaces a `switch` that has a constant condition with the case block that it would
+    /// execute.
+    /// @param switch_ the switch instruction
+    void FoldSwitch(Switch* switch_) {
+        auto* cond = switch_->Condition()->As<Constant>();
+        if (!cond) {
+            return;
+        }
+        ir::Block* taken = nullptr;
+        for (auto& c : switch_->Cases()) {
+            for (auto& selector : c.selectors) {
+                if (!selector.IsDefault() && selector.val->Value()->Equal(cond->Value())) {
+                    taken = c.block;
+                }
+            }
+        }
+        InlineBlock(switch_, taken ? taken : switch_->DefaultBlock());
+    }
+
+    /// Replaces the control instruction @p ctrl with the contents of @p block, which must be the
+    /// only block of @p ctrl that can be executed. All other blocks of @p ctrl are destroyed.
+    /// @param ctrl the control instruction
+    /// @param block the block that will be executed
+    void InlineBlock(ControlInstruction* ctrl, ir::Block* block) {
+        // An exit from a nested instruction (such as a `break` in an `if` inside a `switch` case)
+        // would need to be rewritten to a different construct, so leave these unmodified.
+        for (auto& exit : ctrl->Exits()) {
+            if (exit.Value()->Block()->Parent() != ctrl) {
+                return;
+            }
+        }
+
+        auto* terminator = block->Terminator();
+        TINT_ASSERT(terminator);
+        while (block->Front() != terminator) {
+            auto* inst = block->Front();
+            inst->Remove();
+            inst->InsertBefore(ctrl);
+        }
+
+        if (auto* exit = terminator->As<Exit>(); exit && exit->ControlInstruction() == ctrl) {
+            // The block falls through, so the results of `ctrl` are the values that it exits with.
+            auto results = ctrl->Results();
+            auto args = exit->Args();
+            for (size_t i = 0; i < results.Length(); i++) {
+                ReplaceAllUsesWith(results[i], args[i]);
+            }
+            ctrl->Destroy();
+            return;
+        }
+
+        // The block never falls through, so the terminator replaces `ctrl`, and everything after it
+        // is unreachable.
+        terminator->Remove();
+        terminator->InsertBefore(ctrl);
+        auto* parent = terminator->Block();
+        while (parent->Back() != terminator) {
+            Destroy(parent->Back());
+        }
+    }
+
+    /// Replaces all uses of the result of @p inst with @p replacement, then destroys @p inst.
+    /// @param inst the instruction
+    /// @param replacement the replacement value
+    void ReplaceResult(Instruction* inst, Value* replacement) {
+        ReplaceAllUsesWith(inst->Result(), replacement);
+        Destroy(inst);
+    }
+
+    /// Destroys @p inst, along with any instructions without side effects that were only used by
+    /// @p inst.
+    /// @param inst the instruction
+    void Destroy(Instruction* inst) {
+        Vector<Instruction*, 4> operands;
+        for (auto* operand : inst->Operands()) {
+            if (auto* result = As<InstructionResult>(operand)) {
+                operands.Push(result->Instruction());
+            }
+        }
+        inst->Destroy();
+        for (auto* operand : operands) {
+            if (operand->Alive() && operand->Block() != ir.root_block && IsPure(operand) &&
+                !operand->Result()->IsUsed()) {
+                Destroy(operand);
+            }
+        }
+    }
+
+    /// Replaces all uses of @p value with @p replacement, and adds the users to the worklist.
+    /// @param value the value to replace
+    /// @param replacement the replacement value
+    void ReplaceAllUsesWith(Value* value, Value* replacement) {
+        for (auto& usage : value->UsagesSorted()) {
+            worklist.Push(usage.instruction);
+        }
+        value->ReplaceAllUsesWith(replacement);
+    }
+};
+
+}  // namespace
+
+Result<SuccessType> ConstantPropagation(Module& ir) {
+    auto result =
+        ValidateAndDumpIfNeeded(ir, "core.ConstantPropagation", kConstantPropagationCapabilities);
+    if (result != Success) {
+        return result;
+    }
+
+    State{ir}.Process();
+
+    return Success;
+}
+
+}  // namespace tint::core::ir::transform
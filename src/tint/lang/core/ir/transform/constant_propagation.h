@@ -0,0 +1,76 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_LANG_CORE_IR_TRANSFORM_CONSTANT_PROPAGATION_H_
+#define SRC_TINT_LANG_CORE_IR_TRANSFORM_CONSTANT_PROPAGATION_H_
+
+#include "src/tint/lang/core/ir/validator.h"
+#include "src/tint/utils/result.h"
+
+// Forward declarations.
+namespace tint::core::ir {
+class Module;
+}
+
+namespace tint::core::ir::transform {
+
+/// The capabilities that the transform can support.
+const core::ir::Capabilities kConstantPropagationCapabilities{
+    core::ir::Capability::kAllowOverrides,
+    core::ir::Capability::kAllowVectorElementPointer,
+    core::ir::Capability::kAllowPhonyInstructions,
+    core::ir::Capability::kAllowUnannotatedModuleIOVariables,
+};
+
+/// ConstantPropagation is a transform that folds instructions whose operands are all constant and
+/// propagates the folded values to their users, using a worklist so that only the users of newly
+/// constant values are revisited.
+///
+/// The transform will also:
+///  * Replace `if` and `switch` instructions that have a constant condition with the contents of
+///    the block that would be executed, removing the blocks that can never be executed and any
+///    instructions that follow a block that never falls through.
+///  * Replace `select` calls that have a constant condition with the selected operand.
+///  * Apply simple algebraic identities, such as `x * 1`, `x / 1`, `x - 0` and, for integers,
+///    `x + 0`.
+///
+/// Instructions without side effects whose results become unused are removed.
+///
+/// Instructions that fail to evaluate (for example, an integer division by zero) are left
+/// unmodified, as are instructions that use an unsubstituted `override`. Values carried around a
+/// loop by block parameters are not propagated.
+///
+/// This is intended to run after SubstituteOverrides, so that code paths made dead by the
+/// pipeline's override values are removed before the module is handed to the driver.
+///
+/// @param module the module to transform
+/// @returns success or failure
+Result<SuccessType> ConstantPropagation(Module& module);
+
+}  // namespace tint::core::ir::transform
+
+#endif  // SRC_TINT_LANG_CORE_IR_TRANSFORM_CONSTANT_PROPAGATION_H_
@@ -0,0 +1,653 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/core/ir/transform/constant_propagation.h"
+
+#include "src/tint/lang/core/ir/transform/helper_test.h"
+
+namespace tint::core::ir::transform {
+namespace {
+
+using namespace tint::core::fluent_types;     // NOLINT
+using namespace tint::core::number_suffixes;  // NOLINT
+
+using IR_ConstantPropagationTest = TransformTest;
+
+TEST_F(IR_ConstantPropagationTest, NoModify) {
+    auto* x = b.FunctionParam("x", ty.i32());
+    auto* func = b.Function("foo", ty.i32());
+    func->SetParams({x});
+    b.Append(func->Block(), [&] {  //
+        b.Return(func, b.Add<i32>(x, 2_i));
+    });
+
+    auto* src = R"(
+%foo = func(%x:i32):i32 {
+  $B1: {
+    %3:i32 = add %x, 2i
+    ret %3
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = src;
+
+    Run(ConstantPropagation);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_ConstantPropagationTest, FoldChain) {
+    auto* func = b.Function("foo", ty.vec2<f32>());
+    b.Append(func->Block(), [&] {
+        auto* add = b.Add<i32>(1_i, 2_i);
+        auto* let = b.Let("a", b.Multiply<i32>(add, 3_i));
+        auto* conv = b.Convert<f32>(let);
+        auto* vec = b.Construct<vec2<f32>>(conv, 0.5_f);
+        b.Return(func, b.Swizzle<vec2<f32>>(vec, Vector{1u, 0u}));
+    });
+
+    auto* src = R"(
+%foo = func():vec2<f32> {
+  $B1: {
+    %2:i32 = add 1i, 2i
+    %3:i32 = mul %2, 3i
+    %a:i32 = let %3
+    %5:f32 = convert %a
+    %6:vec2<f32> = construct %5, 0.5f
+    %7:vec2<f32> = swizzle %6, yx
+    ret %7
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func():vec2<f32> {
+  $B1: {
+    ret vec2<f32>(0.5f, 9.0f)
+  }
+}
+)";
+
+    Run(ConstantPropagation);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_ConstantPropagationTest, EvaluationFailure) {
+    auto* func = b.Function("foo", ty.i32());
+    b.Append(func->Block(), [&] {  //
+        b.Return(func, b.Divide<i32>(b.Add<i32>(1_i, 1_i), 0_i));
+    });
+
+    auto* src = R"(
+%foo = func():i32 {
+  $B1: {
+    %2:i32 = add 1i, 1i
+    %3:i32 = div %2, 0i
+    ret %3
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func():i32 {
+  $B1: {
+    %2:i32 = div 2i, 0i
+    ret %2
+  }
+}
+)";
+
+    Run(ConstantPropagation);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_ConstantPropagationTest, BuiltinCall) {
+    auto* x = b.FunctionParam("x", ty.f32());
+    auto* func = b.Function("foo", ty.f32());
+    func->SetParams({x});
+    b.Append(func->Block(), [&] {
+        auto* max = b.Call<f32>(core::BuiltinFn::kMax, 1_f, 2_f);
+        auto* dpdx = b.Call<f32>(core::BuiltinFn::kDpdx, max);
+        b.Return(func, b.Add<f32>(dpdx, x));
+    });
+
+    auto* src = R"(
+%foo = func(%x:f32):f32 {
+  $B1: {
+    %3:f32 = max 1.0f, 2.0f
+    %4:f32 = dpdx %3
+    %5:f32 = add %4, %x
+    ret %5
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func(%x:f32):f32 {
+  $B1: {
+    %3:f32 = dpdx 2.0f
+    %4:f32 = add %3, %x
+    ret %4
+  }
+}
+)";
+
+    Run(ConstantPropagation);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_ConstantPropagationTest, Override) {
+    capabilities = Capability::kAllowOverrides;
+
+    Override* o = nullptr;
+    b.Append(mod.root_block, [&] { o = b.Override("o", 2_i); });
+
+    auto* func = b.Function("foo", ty.i32());
+    b.Append(func->Block(), [&] {  //
+        b.Return(func, b.Add<i32>(o, 1_i));
+    });
+
+    auto* src = R"(
+$B1: {  # root
+  %o:i32 = override 2i
+}
+
+%foo = func():i32 {
+  $B2: {
+    %3:i32 = add %o, 1i
+    ret %3
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = src;
+
+    Run(ConstantPropagation);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_ConstantPropagationTest, If_ConstantCondition) {
+    auto* func = b.Function("foo", ty.i32());
+    b.Append(func->Block(), [&] {
+        auto* cond = b.LessThan<bool>(1_i, 2_i);
+        auto* res = b.InstructionResult(ty.i32());
+        auto* ifelse = b.If(cond);
+        ifelse->SetResults(Vector{res});
+        b.Append(ifelse->True(), [&] {  //
+            b.ExitIf(ifelse, b.Add<i32>(3_i, 4_i));
+        });
+        b.Append(ifelse->False(), [&] {  //
+            b.ExitIf(ifelse, 5_i);
+        });
+        b.Return(func, res);
+    });
+
+    auto* src = R"(
+%foo = func():i32 {
+  $B1: {
+    %2:bool = lt 1i, 2i
+    %3:i32 = if %2 [t: $B2, f: $B3] {  # if_1
+      $B2: {  # true
+        %4:i32 = add 3i, 4i
+        exit_if %4  # if_1
+      }
+      $B3: {  # false
+        exit_if 5i  # if_1
+      }
+    }
+    ret %3
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func():i32 {
+  $B1: {
+    ret 7i
+  }
+}
+)";
+
+    Run(ConstantPropagation);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_ConstantPropagationTest, If_InlinesTakenBlock) {
+    auto* x = b.FunctionParam("x", ty.i32());
+    auto* func = b.Function("foo", ty.i32());
+    func->SetParams({x});
+    b.Append(func->Block(), [&] {
+        auto* res = b.InstructionResult(ty.i32());
+        auto* ifelse = b.If(false);
+        ifelse->SetResults(Vector{res});
+        b.Append(ifelse->True(), [&] {  //
+            b.ExitIf(ifelse, 1_i);
+        });
+        b.Append(ifelse->False(), [&] {  //
+            b.ExitIf(ifelse, b.Multiply<i32>(x, 3_i));
+        });
+        b.Return(func, res);
+    });
+
+    auto* src = R"(
+%foo = func(%x:i32):i32 {
+  $B1: {
+    %3:i32 = if false [t: $B2, f: $B3] {  # if_1
+      $B2: {  # true
+        exit_if 1i  # if_1
+      }
+      $B3: {  # false
+        %4:i32 = mul %x, 3i
+        exit_if %4  # if_1
+      }
+    }
+    ret %3
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func(%x:i32):i32 {
+  $B1: {
+    %3:i32 = mul %x, 3i
+    ret %3
+  }
+}
+)";
+
+    Run(ConstantPropagation);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_ConstantPropagationTest, If_TakenBlockReturns) {
+    auto* x = b.FunctionParam("x", ty.i32());
+    auto* func = b.Function("foo", ty.i32());
+    func->SetParams({x});
+    b.Append(func->Block(), [&] {
+        auto* ifelse = b.If(true);
+        b.Append(ifelse->True(), [&] {  //
+            b.Return(func, x);
+        });
+        b.Append(ifelse->False(), [&] {  //
+            b.ExitIf(ifelse);
+        });
+        auto* inner = b.If(b.Equal<bool>(x, 1_i));
+        b.Append(inner->True(), [&] {  //
+            b.Return(func, 2_i);
+        });
+        b.Return(func, b.Add<i32>(x, 1_i));
+    });
+
+    auto* src = R"(
+%foo = func(%x:i32):i32 {
+  $B1: {
+    if true [t: $B2, f: $B3] {  # if_1
+      $B2: {  # true
+        ret %x
+      }
+      $B3: {  # false
+        exit_if  # if_1
+      }
+    }
+    %3:bool = eq %x, 1i
+    if %3 [t: $B4] {  # if_2
+      $B4: {  # true
+        ret 2i
+      }
+    }
+    %4:i32 = add %x, 1i
+    ret %4
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func(%x:i32):i32 {
+  $B1: {
+    ret %x
+  }
+}
+)";
+
+    Run(ConstantPropagation);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_ConstantPropagationTest, Switch_ConstantCondition) {
+    auto* func = b.Function("foo", ty.i32());
+    b.Append(func->Block(), [&] {
+        auto* res = b.InstructionResult(ty.i32());
+        auto* swtch = b.Switch(b.Add<i32>(1_i, 1_i));
+        swtch->SetResults(Vector{res});
+        b.Append(b.Case(swtch, Vector{b.Constant(1_i)}), [&] {  //
+            b.ExitSwitch(swtch, 10_i);
+        });
+        b.Append(b.Case(swtch, Vector{b.Constant(2_i), b.Constant(3_i)}), [&] {  //
+            b.ExitSwitch(swtch, 20_i);
+        });
+        b.Append(b.DefaultCase(swtch), [&] {  //
+            b.ExitSwitch(swtch, 30_i);
+        });
+        b.Return(func, res);
+    });
+
+    auto* src = R"(
+%foo = func():i32 {
+  $B1: {
+    %2:i32 = add 1i, 1i
+    %3:i32 = switch %2 [c: (1i, $B2), c: (2i 3i, $B3), c: (default, $B4)] {  # switch_1
+      $B2: {  # case
+        exit_switch 10i  # switch_1
+      }
+      $B3: {  # case
+        exit_switch 20i  # switch_1
+      }
+      $B4: {  # case
+        exit_switch 30i  # switch_1
+      }
+    }
+    ret %3
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func():i32 {
+  $B1: {
+    ret 20i
+  }
+}
+)";
+
+    Run(ConstantPropagation);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_ConstantPropagationTest, Switch_Default) {
+    auto* func = b.Function("foo", ty.i32());
+    b.Append(func->Block(), [&] {
+        auto* res = b.InstructionResult(ty.i32());
+        auto* swtch = b.Switch(5_u);
+        swtch->SetResults(Vector{res});
+        b.Append(b.Case(swtch, Vector{b.Constant(1_u)}), [&] {  //
+            b.ExitSwitch(swtch, 10_i);
+        });
+        b.Append(b.DefaultCase(swtch), [&] {  //
+            b.ExitSwitch(swtch, 30_i);
+        });
+        b.Return(func, res);
+    });
+
+    auto* src = R"(
+%foo = func():i32 {
+  $B1: {
+    %2:i32 = switch 5u [c: (1u, $B2), c: (default, $B3)] {  # switch_1
+      $B2: {  # case
+        exit_switch 10i  # switch_1
+      }
+      $B3: {  # case
+        exit_switch 30i  # switch_1
+      }
+    }
+    ret %2
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func():i32 {
+  $B1: {
+    ret 30i
+  }
+}
+)";
+
+    Run(ConstantPropagation);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_ConstantPropagationTest, Switch_NestedExit) {
+    auto* x = b.FunctionParam("x", ty.bool_());
+    auto* func = b.Function("foo", ty.void_());
+    func->SetParams({x});
+    b.Append(func->Block(), [&] {
+        auto* swtch = b.Switch(1_i);
+        b.Append(b.DefaultCase(swtch), [&] {
+            auto* ifelse = b.If(x);
+            b.Append(ifelse->True(), [&] {  //
+                b.ExitSwitch(swtch);
+            });
+            b.ExitSwitch(swtch);
+        });
+        b.Return(func);
+    });
+
+    auto* src = R"(
+%foo = func(%x:bool):void {
+  $B1: {
+    switch 1i [c: (default, $B2)] {  # switch_1
+      $B2: {  # case
+        if %x [t: $B3] {  # if_1
+          $B3: {  # true
+            exit_switch  # switch_1
+          }
+        }
+        exit_switch  # switch_1
+      }
+    }
+    ret
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = src;
+
+    Run(ConstantPropagation);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_ConstantPropagationTest, Select) {
+    auto* x = b.FunctionParam("x", ty.vec2<f32>());
+    auto* y = b.FunctionParam("y", ty.vec2<f32>());
+    auto* func = b.Function("foo", ty.vec2<f32>());
+    func->SetParams({x, y});
+    b.Append(func->Block(), [&] {
+        auto* neg = b.Negation<vec2<f32>>(x);
+        auto* cond = b.Splat<vec2<bool>>(true);
+        b.Return(func, b.Call<vec2<f32>>(core::BuiltinFn::kSelect, neg, y, cond));
+    });
+
+    auto* src = R"(
+%foo = func(%x:vec2<f32>, %y:vec2<f32>):vec2<f32> {
+  $B1: {
+    %4:vec2<f32> = negation %x
+    %5:vec2<f32> = select %4, %y, vec2<bool>(true)
+    ret %5
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func(%x:vec2<f32>, %y:vec2<f32>):vec2<f32> {
+  $B1: {
+    ret %y
+  }
+}
+)";
+
+    Run(ConstantPropagation);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_ConstantPropagationTest, Select_MixedCondition) {
+    auto* x = b.FunctionParam("x", ty.vec2<f32>());
+    auto* y = b.FunctionParam("y", ty.vec2<f32>());
+    auto* func = b.Function("foo", ty.vec2<f32>());
+    func->SetParams({x, y});
+    b.Append(func->Block(), [&] {
+        auto* cond = b.Composite<vec2<bool>>(true, false);
+        b.Return(func, b.Call<vec2<f32>>(core::BuiltinFn::kSelect, x, y, cond));
+    });
+
+    auto* src = R"(
+%foo = func(%x:vec2<f32>, %y:vec2<f32>):vec2<f32> {
+  $B1: {
+    %4:vec2<f32> = select %x, %y, vec2<bool>(true, false)
+    ret %4
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = src;
+
+    Run(ConstantPropagation);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_ConstantPropagationTest, AlgebraicIdentities) {
+    auto* i = b.FunctionParam("i", ty.vec3<i32>());
+    auto* u = b.FunctionParam("u", ty.u32());
+    auto* f = b.FunctionParam("f", ty.f32());
+    auto* func = b.Function("foo", ty.void_());
+    func->SetParams({i, u, f});
+    b.Append(func->Block(), [&] {
+        auto* i_add = b.Add<vec3<i32>>(b.Splat<vec3<i32>>(0_i), i);
+        auto* i_mul = b.Multiply<vec3<i32>>(i_add, 1_i);
+        b.Let("a", b.ShiftLeft<vec3<i32>>(i_mul, b.Splat<vec3<u32>>(0_u)));
+
+        auto* u_or = b.Or<u32>(u, 0_u);
+        auto* u_and = b.And<u32>(0xffffffff_u, u_or);
+        b.Let("b", b.Divide<u32>(u_and, 1_u));
+
+        auto* f_sub = b.Subtract<f32>(f, 0_f);
+        b.Let("c", b.Multiply<f32>(1_f, f_sub));
+
+        b.Return(func);
+    });
+
+    auto* src = R"(
+%foo = func(%i:vec3<i32>, %u:u32, %f:f32):void {
+  $B1: {
+    %5:vec3<i32> = add vec3<i32>(0i), %i
+    %6:vec3<i32> = mul %5, 1i
+    %7:vec3<i32> = shl %6, vec3<u32>(0u)
+    %a:vec3<i32> = let %7
+    %9:u32 = or %u, 0u
+    %10:u32 = and 4294967295u, %9
+    %11:u32 = div %10, 1u
+    %b:u32 = let %11
+    %13:f32 = sub %f, 0.0f
+    %14:f32 = mul 1.0f, %13
+    %c:f32 = let %14
+    ret
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = R"(
+%foo = func(%i:vec3<i32>, %u:u32, %f:f32):void {
+  $B1: {
+    %a:vec3<i32> = let %i
+    %b:u32 = let %u
+    %c:f32 = let %f
+    ret
+  }
+}
+)";
+
+    Run(ConstantPropagation);
+
+    EXPECT_EQ(expect, str());
+}
+
+TEST_F(IR_ConstantPropagationTest, AlgebraicIdentities_NotApplied) {
+    auto* f = b.FunctionParam("f", ty.f32());
+    auto* m = b.FunctionParam("m", ty.mat2x2<f32>());
+    auto* func = b.Function("foo", ty.void_());
+    func->SetParams({f, m});
+    b.Append(func->Block(), [&] {
+        // `-0.0 + 0.0` is `0.0`.
+        b.Let("add", b.Add<f32>(f, 0_f));
+        // The scalar is splatted to a vector.
+        b.Let("splat", b.Multiply<vec2<f32>>(f, b.Splat<vec2<f32>>(1_f)));
+        // An all-ones matrix is not an identity matrix.
+        auto* ones = b.Composite<mat2x2<f32>>(b.Splat<vec2<f32>>(1_f), b.Splat<vec2<f32>>(1_f));
+        b.Let("mat", b.Multiply<mat2x2<f32>>(m, ones));
+        b.Return(func);
+    });
+
+    auto* src = R"(
+%foo = func(%f:f32, %m:mat2x2<f32>):void {
+  $B1: {
+    %4:f32 = add %f, 0.0f
+    %add:f32 = let %4
+    %6:vec2<f32> = mul %f, vec2<f32>(1.0f)
+    %splat:vec2<f32> = let %6
+    %8:mat2x2<f32> = mul %m, mat2x2<f32>(vec2<f32>(1.0f))
+    %mat:mat2x2<f32> = let %8
+    ret
+  }
+}
+)";
+    EXPECT_EQ(src, str());
+
+    auto* expect = src;
+
+    Run(ConstantPropagation);
+
+    EXPECT_EQ(expect, str());
+}
+
+}  // namespace
+}  // namespace tint::core::ir::transform
@@ -71,6 +71,7 @@ tint_target_add_dependencies(tint_lang_msl_writer_printer lib
 
 tint_target_add_external_dependencies(tint_lang_msl_writer_printer lib
   "src_utils"
+  "thread"
 )
 
 if(TINT_BUILD_MSL_WRITER)
@@ -27,11 +27,14 @@
 
 #include "src/tint/lang/msl/writer/printer/printer.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "src/tint/lang/core/constant/splat.h"
 #include "src/tint/lang/core/constant/string.h"
@@ -121,8 +124,10 @@ class Printer : public tint::TextGenerator {
   public:
     /// Constructor
     /// @param module the Tint IR module to generate
-    explicit Printer(core::ir::Module& module, const Options& options)
-        : ir_(module), options_(options) {}
+    /// @param options the MSL writer options
+    /// @param thread_count the number of threads used to print the functions of the module
+    Printer(core::ir::Module& module, const Options& options, uint32_t thread_count)
+        : ir_(module), options_(options), thread_count_(thread_count) {}
 
     /// @returns the generated MSL shader
     tint::Result<Output> Generate() {
@@ -150,8 +155,13 @@ class Printer : public tint::TextGenerator {
         FindHostShareableStructs();
 
         // Emit functions.
-        for (auto* func : ir_.DependencyOrderedFunctions()) {
-            EmitFunction(func);
+        auto functions = ir_.DependencyOrderedFunctions();
+        if (thread_count_ > 1 && functions.Length() > 1) {
+            EmitFunctionsConcurrently(functions);
+        } else {
+            for (auto* func : functions) {
+                EmitFunction(func);
+            }
         }
 
         StringStream ss;
@@ -162,12 +172,42 @@ class Printer : public tint::TextGenerator {
     }
 
   private:
+    /// DeferredOp is an operation on the module-scope printer state, recorded by a function that
+    /// is being printed on a worker thread. The operations are replayed in order on the main
+    /// printer, and their text substituted for the placeholders in the function's text.
+    struct DeferredOp {
+        /// The kind of operation
+        enum class Kind : uint8_t {
+            /// NameOf(const core::ir::Value*)
+            kValueName,
+            /// NameOf(const core::type::StructMember*)
+            kMemberName,
+            /// StructName()
+            kStructName,
+            /// EmitStructType(), which has no text
+            kStructType,
+            /// EmitType()
+            kType,
+        };
+        /// The kind of operation
+        Kind kind;
+        /// The value, member or type that the operation is performed on
+        const CastableBase* object;
+    };
+
+    /// The characters that delimit the index of a deferred operation in the text of a function
+    /// printed on a worker thread. Neither can appear in MSL output.
+    static constexpr char kDeferredBegin = '\x01';
+    static constexpr char kDeferredEnd = '\x02';
+
     /// The result of printing the module.
     Output result_;
 
     core::ir::Module& ir_;
     /// MSL writer options
     Options options_;
+    /// The number of threads used to print the functions of the module
+    uint32_t thread_count_ = 1;
 
     /// A hashmap of object to name.
     Hashmap<const CastableBase*, std::string, 32> names_;
@@ -194,6 +234,116 @@ class Printer : public tint::TextGenerator {
     /// Block to emit for a continuing
     std::function<void()> emit_continuing_;
 
+    /// The operations on the module-scope state made by the function being printed.
+    /// Non-null only for printers of a single function on a worker thread.
+    Vector<DeferredOp, 32>* deferred_ = nullptr;
+
+    /// Emits @p functions, printing all functions except entry points concurrently.
+    /// Each function is printed by a separate printer that records the operations it makes on the
+    /// module-scope state (names, structures and the array template) instead of performing them.
+    /// The functions are then appended in order, replaying their operations, so the output is
+    /// identical to emitting the functions serially.
+    /// @param functions the dependency-ordered functions of the module
+    void EmitFunctionsConcurrently(VectorRef<core::ir::Function*> functions) {
+        struct PrintedFunction {
+            TextBuffer text;
+            Vector<DeferredOp, 32> deferred;
+        };
+        std::vector<PrintedFunction> printed(functions.Length());
+
+        std::atomic<size_t> next{0};
+        auto print = [&] {
+            for (size_t i = next++; i < functions.Length(); i = next++) {
+                // Entry points update the output's reflection data, so are emitted serially.
+                if (functions[i]->IsEntryPoint()) {
+                    continue;
+                }
+                Printer printer(ir_, options_, /* thread_count */ 1);
+                printer.deferred_ = &printed[i].deferred;
+                printer.EmitFunction(functions[i]);
+                printed[i].text = std::move(printer.main_buffer_);
+            }
+        };
+
+        auto num_threads = std::min<size_t>(thread_count_, functions.Length());
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < num_threads; i++) {
+            threads.emplace_back(print);
+        }
+        print();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        for (size_t i = 0; i < functions.Length(); i++) {
+            if (functions[i]->IsEntryPoint()) {
+                EmitFunction(functions[i]);
+                continue;
+            }
+
+            Vector<std::string, 32> replacements;
+            for (auto& op : printed[i].deferred) {
+                replacements.Push(Replay(op));
+            }
+            for (auto& line : printed[i].text.lines) {
+                line.content = SubstituteDeferred(line.content, replacements);
+            }
+            current_buffer_->Append(printed[i].text);
+        }
+    }
+
+    /// Records the operation @p kind on @p object, to be replayed by the main printer.
+    /// @returns the placeholder text for the operation's result
+    std::string Defer(DeferredOp::Kind kind, const CastableBase* object) {
+        std::string placeholder;
+        placeholder += kDeferredBegin;
+        placeholder += std::to_string(deferred_->Length());
+        placeholder += kDeferredEnd;
+        deferred_->Push(DeferredOp{kind, object});
+        return placeholder;
+    }
+
+    /// Performs the deferred operation @p op.
+    /// @returns the text of the operation's result
+    std::string Replay(const DeferredOp& op) {
+        switch (op.kind) {
+            case DeferredOp::Kind::kValueName:
+                return NameOf(static_cast<const core::ir::Value*>(op.object));
+            case DeferredOp::Kind::kMemberName:
+                return NameOf(static_cast<const core::type::StructMember*>(op.object));
+            case DeferredOp::Kind::kStructName:
+                return StructName(static_cast<const core::type::Struct*>(op.object));
+            case DeferredOp::Kind::kStructType:
+                EmitStructType(static_cast<const core::type::Struct*>(op.object));
+                return "";
+            case DeferredOp::Kind::kType: {
+                StringStream ss;
+                EmitType(ss, static_cast<const core::type::Type*>(op.object));
+                return ss.str();
+            }
+        }
+        TINT_UNREACHABLE();
+    }
+
+    /// @returns @p text with the deferred operation placeholders replaced with @p replacements
+    static std::string SubstituteDeferred(const std::string& text,
+                                          VectorRef<std::string> replacements) {
+        auto begin = text.find(kDeferredBegin);
+        if (begin == std::string::npos) {
+            return text;
+        }
+        std::string out = text.substr(0, begin);
+        while (begin != std::string::npos) {
+            auto end = text.find(kDeferredEnd, begin);
+            TINT_ASSERT(end != std::string::npos);
+            auto index = std::stoul(text.substr(begin + 1, end - begin - 1));
+            out += replacements[index];
+            begin = text.find(kDeferredBegin, end);
+            out += text.substr(end + 1, begin - end - 1);
+        }
+        return out;
+    }
+
     /// @returns the name of the templated `tint_array` helper type, generating it if needed
     const std::string& ArrayTemplateName() {
         if (!array_template_name_.empty()) {
@@ -1321,6 +1471,10 @@ class Printer : public tint::TextGenerator {
     /// @param out the stream to emit too
     /// @param ty the type to emit
     void EmitType(StringStream& out, const core::type::Type* ty) {
+        if (deferred_) {
+            out << Defer(DeferredOp::Kind::kType, ty);
+            return;
+        }
         tint::Switch(
             ty,                                               //
             [&](const core::type::Bool*) { out << "bool"; },  //
@@ -1533,6 +1687,10 @@ class Printer : public tint::TextGenerator {
     /// this function will simply return without emitting anything.
     /// @param str the struct to generate
     void EmitStructType(const core::type::Struct* str) {
+        if (deferred_) {
+            Defer(DeferredOp::Kind::kStructType, str);
+            return;
+        }
         if (!emitted_structs_.Add(str)) {
             return;
         }
@@ -1852,6 +2010,9 @@ class Printer : public tint::TextGenerator {
     /// with double underscores. If the structure is a builtin, then the returned name will be a
     /// unique name without the leading underscores.
     std::string StructName(const core::type::Struct* s) {
+        if (deferred_) {
+            return Defer(DeferredOp::Kind::kStructName, s);
+        }
         return names_.GetOrAdd(s, [&] {
             auto name = s->Name().Name();
             if (HasPrefix(name, "__")) {
@@ -1867,6 +2028,9 @@ class Printer : public tint::TextGenerator {
     /// @param m the struct member
     /// @returns the name to use for the struct member
     std::string NameOf(const core::type::StructMember* m) {
+        if (deferred_) {
+            return Defer(DeferredOp::Kind::kMemberName, m);
+        }
         return names_.GetOrAdd(m, [&] {
             auto name = m->Name().Name();
             if (ShouldRename(name)) {
@@ -1880,6 +2044,9 @@ class Printer : public tint::TextGenerator {
     /// @returns the name of the given value, creating a new unique name if the value is unnamed in
     /// the module.
     std::string NameOf(const core::ir::Value* value) {
+        if (deferred_) {
+            return Defer(DeferredOp::Kind::kValueName, value);
+        }
         return names_.GetOrAdd(value, [&] {
             auto sym = ir_.NameOf(value);
             if (!sym || ShouldRename(sym.NameView())) {
@@ -1892,6 +2059,8 @@ class Printer : public tint::TextGenerator {
     /// @return a new, unique identifier with the given prefix.
     /// @param prefix prefix to apply to the generated identifier
     std::string UniqueIdentifier(const std::string& prefix) {
+        // The symbol table is module-scope state, which must not be modified by worker threads.
+        TINT_ASSERT(!deferred_);
         return ir_.symbols.New(prefix).Name();
     }
 };
@@ -2176,8 +2345,8 @@ bool IsKeyword(std::string_view ident) {
 
 }  // namespace
 
-Result<Output> Print(core::ir::Module& module, const Options& options) {
-    return Printer{module, options}.Generate();
+Result<Output> Print(core::ir::Module& module, const Options& options, uint32_t thread_count) {
+    return Printer{module, options, thread_count}.Generate();
 }
 
 }  // namespace tint::msl::writer
@@ -53,8 +53,12 @@ const core::ir::Capabilities kPrinterCapabilities{
 };
 
 /// @param module the Tint IR module to generate
+/// @param options the MSL writer options
+/// @param thread_count the number of threads used to print the functions of the module. Values
+/// greater than 1 print the functions that are not entry points concurrently. The output is
+/// identical for any value.
 /// @returns the result of printing the MSL shader on success, or failure
-Result<Output> Print(core::ir::Module& module, const Options& options);
+Result<Output> Print(core::ir::Module& module, const Options& options, uint32_t thread_count = 1);
 
 }  // namespace tint::msl::writer
 
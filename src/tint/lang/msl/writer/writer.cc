@@ -124,7 +124,9 @@ Result<SuccessType> CanGenerate(const core::ir::Module& ir, const Options& optio
     return Success;
 }
 
-Result<Output> Generate(core::ir::Module& ir, const Options& options) {
+Result<Output> Generate(core::ir::Module& ir,
+                        const Options& options,
+                        uint32_t printer_thread_count) {
     Output output;
 
     // Raise from core-dialect to MSL-dialect.
@@ -133,7 +135,7 @@ Result<Output> Generate(core::ir::Module& ir, const Options& options) {
         return raise_result.Failure();
     }
 
-    auto result = Print(ir, options);
+    auto result = Print(ir, options, printer_thread_count);
     if (result != Success) {
         return result.Failure();
     }
@@ -49,8 +49,13 @@ Result<SuccessType> CanGenerate(const core::ir::Module& ir, const Options& optio
 /// The result will contain the MSL and supplementary information, or failure.
 /// @param ir the IR module to translate to MSL
 /// @param options the configuration options to use when generating MSL
+/// @param printer_thread_count opt-in: the number of threads used to print the functions of the
+/// module. Values greater than 1 print functions concurrently. The output is identical for any
+/// value, which is why this is not part of @p options, whose fields are used as cache keys.
 /// @returns the resulting MSL and supplementary information, or failure
-Result<Output> Generate(core::ir::Module& ir, const Options& options);
+Result<Output> Generate(core::ir::Module& ir,
+                        const Options& options,
+                        uint32_t printer_thread_count = 1);
 
 }  // namespace tint::msl::writer
 
@@ -311,5 +311,54 @@ vertex main_outputs v(uint tint_vertex_index [[vertex_id]], const device tint_ar
 )");
 }
 
+/// Builds a module with many functions that share a structure, an array and unnamed values.
+void BuildManyFunctions(core::ir::Module& mod) {
+    core::ir::Builder b{mod};
+    auto& ty = mod.Types();
+    auto* arr = ty.array<i32, 4>();
+    auto* str = ty.Struct(mod.symbols.New("S"), {
+                                                    {mod.symbols.Register("a"), ty.f32()},
+                                                    {mod.symbols.Register("b"), arr},
+                                                });
+
+    core::ir::Function* prev = nullptr;
+    for (uint32_t i = 0; i < 16; i++) {
+        auto* func = b.Function("f" + std::to_string(i), ty.f32());
+        auto* param = b.FunctionParam("p", str);
+        func->AppendParam(param);
+        b.Append(func->Block(), [&] {
+            auto* a = b.Access<f32>(param, 0_u);
+            auto* elem = b.Access<i32>(param, 1_u, u32(i % 4));
+            core::ir::Value* sum = b.Add<f32>(a, b.Convert<f32>(elem))->Result();
+            if (prev) {
+                auto* next = b.Construct(str, sum, b.Zero(arr));
+                sum = b.Add<f32>(sum, b.Call<f32>(prev, next))->Result();
+            }
+            b.Return(func, sum);
+        });
+        prev = func;
+    }
+
+    auto* ep = b.ComputeFunction("main");
+    b.Append(ep->Block(), [&] {
+        b.Let("r", b.Call<f32>(prev, b.Construct(str, 1_f, b.Zero(arr))));
+        b.Return(ep);
+    });
+}
+
+TEST_F(MslWriterTest, PrinterThreadCount) {
+    core::ir::Module serial_mod;
+    BuildManyFunctions(serial_mod);
+    auto serial = writer::Generate(serial_mod, Options{});
+    ASSERT_EQ(serial, Success) << serial.Failure().reason;
+
+    BuildManyFunctions(mod);
+    auto concurrent = writer::Generate(mod, Options{}, /* printer_thread_count */ 4);
+    ASSERT_EQ(concurrent, Success) << concurrent.Failure().reason;
+    EXPECT_EQ(concurrent->msl, serial->msl);
+    EXPECT_EQ(concurrent->workgroup_info.x, serial->workgroup_info.x);
+    EXPECT_THAT(concurrent->msl, testing::HasSubstr("tint_array<int, 4> b;"));
+}
+
 }  // namespace
 }  // namespace tint::msl::writer
@@ -41,6 +41,8 @@ if(TINT_BUILD_WGSL_READER)
 # Condition: TINT_BUILD_WGSL_READER
 ################################################################################
 tint_add_target(tint_lang_wgsl_reader_parser lib
+  lang/wgsl/reader/parser/char_scan.cc
+  lang/wgsl/reader/parser/char_scan.h
   lang/wgsl/reader/parser/classify_template_args.cc
   lang/wgsl/reader/parser/classify_template_args.h
   lang/wgsl/reader/parser/detail.h
@@ -94,6 +96,7 @@ tint_add_target(tint_lang_wgsl_reader_parser_test test
   lang/wgsl/reader/parser/break_stmt_test.cc
   lang/wgsl/reader/parser/bug_cases_test.cc
   lang/wgsl/reader/parser/call_stmt_test.cc
+  lang/wgsl/reader/parser/char_scan_test.cc
   lang/wgsl/reader/parser/classify_template_args_test.cc
   lang/wgsl/reader/parser/compound_stmt_test.cc
   lang/wgsl/reader/parser/const_literal_test.cc
@@ -0,0 +1,263 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/wgsl/reader/parser/char_scan.h"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+#include "src/tint/utils/macros/compiler.h"
+
+#if defined(__AVX2__)
+#define TINT_CHAR_SCAN_AVX2 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TINT_CHAR_SCAN_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define TINT_CHAR_SCAN_NEON 1
+#include <arm_neon.h>
+#endif
+
+TINT_BEGIN_DISABLE_WARNING(UNSAFE_BUFFER_USAGE);
+
+namespace tint::wgsl::reader {
+namespace {
+
+/// Character class bits, used by kCharClasses.
+enum CharClass : uint8_t {
+    kSpaceOrTab = 1 << 0,
+    kDecimalDigit = 1 << 1,
+    kASCIIIdent = 1 << 2,
+    kBlockCommentDelimiter = 1 << 3,
+};
+
+/// The scalar lookup table of CharClass bits for each byte value.
+constexpr std::array<uint8_t, 256> kCharClasses = [] {
+    std::array<uint8_t, 256> classes{};
+    classes[' '] |= kSpaceOrTab;
+    classes['\t'] |= kSpaceOrTab;
+    for (char c = '0'; c <= '9'; c++) {
+        classes[static_cast<uint8_t>(c)] |= kDecimalDigit | kASCIIIdent;
+    }
+    for (char c = 'a'; c <= 'z'; c++) {
+        classes[static_cast<uint8_t>(c)] |= kASCIIIdent;
+        classes[static_cast<uint8_t>(c - 'a' + 'A')] |= kASCIIIdent;
+    }
+    classes['_'] |= kASCIIIdent;
+    classes['*'] |= kBlockCommentDelimiter;
+    classes['/'] |= kBlockCommentDelimiter;
+    classes[0] |= kBlockCommentDelimiter;
+    return classes;
+}();
+
+#if TINT_CHAR_SCAN_AVX2 || TINT_CHAR_SCAN_SSE2 || TINT_CHAR_SCAN_NEON
+
+/// Bytes is a vector of kWidth bytes, where each byte holds either a character, or the result of
+/// a classification (0xff for true, 0x00 for false).
+class Bytes {
+  public:
+#if TINT_CHAR_SCAN_AVX2
+    using Vec = __m256i;
+    static constexpr size_t kWidth = 32;
+#elif TINT_CHAR_SCAN_SSE2
+    using Vec = __m128i;
+    static constexpr size_t kWidth = 16;
+#else
+    using Vec = uint8x16_t;
+    static constexpr size_t kWidth = 16;
+#endif
+
+    /// The number of bits of Mask() used for each byte.
+#if TINT_CHAR_SCAN_NEON
+    static constexpr size_t kMaskBitsPerByte = 4;
+#else
+    static constexpr size_t kMaskBitsPerByte = 1;
+#endif
+
+    /// A Mask() with all bytes set.
+    static constexpr uint64_t kMaskAll =
+        kWidth * kMaskBitsPerByte == 64 ? ~uint64_t(0)
+                                        : (uint64_t(1) << (kWidth * kMaskBitsPerByte)) - 1;
+
+    /// @returns the kWidth bytes starting at @p ptr
+    static Bytes Load(const char* ptr) {
+#if TINT_CHAR_SCAN_AVX2
+        return Bytes{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr))};
+#elif TINT_CHAR_SCAN_SSE2
+        return Bytes{_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))};
+#else
+        return Bytes{vld1q_u8(reinterpret_cast<const uint8_t*>(ptr))};
+#endif
+    }
+
+    /// @returns a vector of @p c
+    static Bytes Splat(char c) {
+#if TINT_CHAR_SCAN_AVX2
+        return Bytes{_mm256_set1_epi8(c)};
+#elif TINT_CHAR_SCAN_SSE2
+        return Bytes{_mm_set1_epi8(c)};
+#else
+        return Bytes{vdupq_n_u8(static_cast<uint8_t>(c))};
+#endif
+    }
+
+    /// @returns the classification of bytes equal to @p c
+    Bytes operator==(char c) const {
+#if TINT_CHAR_SCAN_AVX2
+        return Bytes{_mm256_cmpeq_epi8(v_, Splat(c).v_)};
+#elif TINT_CHAR_SCAN_SSE2
+        return Bytes{_mm_cmpeq_epi8(v_, Splat(c).v_)};
+#else
+        return Bytes{vceqq_u8(v_, Splat(c).v_)};
+#endif
+    }
+
+    /// @returns the classification of bytes in the ASCII range [@p lo, @p hi]
+    Bytes InRange(char lo, char hi) const {
+#if TINT_CHAR_SCAN_AVX2
+        // Signed comparisons exclude all bytes >= 0x80, which are never in an ASCII range.
+        return Bytes{_mm256_and_si256(_mm256_cmpgt_epi8(v_, Splat(static_cast<char>(lo - 1)).v_),
+                                      _mm256_cmpgt_epi8(Splat(static_cast<char>(hi + 1)).v_, v_))};
+#elif TINT_CHAR_SCAN_SSE2
+        // Signed comparisons exclude all bytes >= 0x80, which are never in an ASCII range.
+        return Bytes{_mm_and_si128(_mm_cmpgt_epi8(v_, Splat(static_cast<char>(lo - 1)).v_),
+                                   _mm_cmplt_epi8(v_, Splat(static_cast<char>(hi + 1)).v_))};
+#else
+        return Bytes{vandq_u8(vcgeq_u8(v_, Splat(lo).v_), vcleq_u8(v_, Splat(hi).v_))};
+#endif
+    }
+
+    /// @returns the bytes with the ASCII lower-case bit set
+    Bytes ToLower() const {
+#if TINT_CHAR_SCAN_AVX2
+        return Bytes{_mm256_or_si256(v_, Splat(0x20).v_)};
+#elif TINT_CHAR_SCAN_SSE2
+        return Bytes{_mm_or_si128(v_, Splat(0x20).v_)};
+#else
+        return Bytes{vorrq_u8(v_, Splat(0x20).v_)};
+#endif
+    }
+
+    /// @returns the union of the classifications of this and @p other
+    Bytes operator|(const Bytes& other) const {
+#if TINT_CHAR_SCAN_AVX2
+        return Bytes{_mm256_or_si256(v_, other.v_)};
+#elif TINT_CHAR_SCAN_SSE2
+        return Bytes{_mm_or_si128(v_, other.v_)};
+#else
+        return Bytes{vorrq_u8(v_, other.v_)};
+#endif
+    }
+
+    /// @returns a bit mask of the classification, with kMaskBitsPerByte bits per byte
+    uint64_t Mask() const {
+#if TINT_CHAR_SCAN_AVX2
+        return static_cast<uint32_t>(_mm256_movemask_epi8(v_));
+#elif TINT_CHAR_SCAN_SSE2
+        return static_cast<uint32_t>(_mm_movemask_epi8(v_));
+#else
+        // Narrow each 16-bit lane by 4 bits, leaving a nibble per byte.
+        uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(v_), 4);
+        return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0);
+#endif
+    }
+
+  private:
+    explicit Bytes(Vec v) : v_(v) {}
+
+    Vec v_;
+};
+
+Bytes IsSpaceOrTab(Bytes b) {
+    return (b == ' ') | (b == '\t');
+}
+
+Bytes IsDecimalDigit(Bytes b) {
+    return b.InRange('0', '9');
+}
+
+Bytes IsASCIIIdent(Bytes b) {
+    return b.InRange('0', '9') | b.ToLower().InRange('a', 'z') | (b == '_');
+}
+
+Bytes IsBlockCommentDelimiter(Bytes b) {
+    return (b == '*') | (b == '/') | (b == '\0');
+}
+
+#endif
+
+/// @returns the position of the first byte at or after @p pos in @p str where membership of the
+/// class @p CLASS is equal to @p MATCH, or `str.size()` if there is no such byte.
+/// @param classify the vectorized classification function for @p CLASS
+template <CharClass CLASS, bool MATCH, typename CLASSIFY>
+size_t Find(std::string_view str, size_t pos, [[maybe_unused]] CLASSIFY&& classify) {
+    const char* data = str.data();
+    const size_t size = str.size();
+#if TINT_CHAR_SCAN_AVX2 || TINT_CHAR_SCAN_SSE2 || TINT_CHAR_SCAN_NEON
+    for (; pos + Bytes::kWidth <= size; pos += Bytes::kWidth) {
+        uint64_t mask = classify(Bytes::Load(data + pos)).Mask();
+        if (!MATCH) {
+            mask = ~mask & Bytes::kMaskAll;
+        }
+        if (mask) {
+            return pos + static_cast<size_t>(std::countr_zero(mask)) / Bytes::kMaskBitsPerByte;
+        }
+    }
+#endif
+    for (; pos < size; pos++) {
+        bool is_class = (kCharClasses[static_cast<uint8_t>(data[pos])] & CLASS) != 0;
+        if (is_class == MATCH) {
+            break;
+        }
+    }
+    return pos;
+}
+
+}  // namespace
+
+size_t SkipSpaceAndTab(std::string_view str, size_t pos) {
+    return Find<kSpaceOrTab, false>(str, pos, [](auto b) { return IsSpaceOrTab(b); });
+}
+
+size_t SkipASCIIIdentChars(std::string_view str, size_t pos) {
+    return Find<kASCIIIdent, false>(str, pos, [](auto b) { return IsASCIIIdent(b); });
+}
+
+size_t SkipDecimalDigits(std::string_view str, size_t pos) {
+    return Find<kDecimalDigit, false>(str, pos, [](auto b) { return IsDecimalDigit(b); });
+}
+
+size_t FindBlockCommentDelimiter(std::string_view str, size_t pos) {
+    return Find<kBlockCommentDelimiter, true>(str, pos,
+                                              [](auto b) { return IsBlockCommentDelimiter(b); });
+}
+
+}  // namespace tint::wgsl::reader
+
+TINT_END_DISABLE_WARNING(UNSAFE_BUFFER_USAGE);
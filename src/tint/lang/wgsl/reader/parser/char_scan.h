@@ -0,0 +1,67 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_LANG_WGSL_READER_PARSER_CHAR_SCAN_H_
+#define SRC_TINT_LANG_WGSL_READER_PARSER_CHAR_SCAN_H_
+
+#include <cstddef>
+#include <string_view>
+
+// Functions used by the Lexer to skip over runs of characters of the same class.
+// Each of these processes a vector of bytes at a time using SSE2, AVX2 or NEON where available,
+// falling back to a scalar lookup table.
+
+namespace tint::wgsl::reader {
+
+/// @param str the string to scan
+/// @param pos the position in @p str to start scanning from
+/// @returns the position of the first character at or after @p pos that is not a space or
+/// horizontal tab, or `str.size()` if there is no such character.
+size_t SkipSpaceAndTab(std::string_view str, size_t pos);
+
+/// @param str the string to scan
+/// @param pos the position in @p str to start scanning from
+/// @returns the position of the first character at or after @p pos that is not an ASCII letter,
+/// decimal digit or underscore, or `str.size()` if there is no such character.
+size_t SkipASCIIIdentChars(std::string_view str, size_t pos);
+
+/// @param str the string to scan
+/// @param pos the position in @p str to start scanning from
+/// @returns the position of the first character at or after @p pos that is not a decimal digit,
+/// or `str.size()` if there is no such character.
+size_t SkipDecimalDigits(std::string_view str, size_t pos);
+
+/// @param str the string to scan
+/// @param pos the position in @p str to start scanning from
+/// @returns the position of the first '*', '/' or null character at or after @p pos, or
+/// `str.size()` if there is no such character. These are the only characters that need to be
+/// inspected when skipping the body of a block comment.
+size_t FindBlockCommentDelimiter(std::string_view str, size_t pos);
+
+}  // namespace tint::wgsl::reader
+
+#endif  // SRC_TINT_LANG_WGSL_READER_PARSER_CHAR_SCAN_H_
@@ -0,0 +1,108 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/lang/wgsl/reader/parser/char_scan.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace tint::wgsl::reader {
+namespace {
+
+// The vectorized scans process up to 32 bytes at a time, so each test builds strings with the
+// terminating character at every offset up to beyond two vectors, to exercise both the vector
+// loop and the scalar tail.
+constexpr size_t kMaxLength = 80;
+
+TEST(CharScanTest, SkipSpaceAndTab) {
+    for (size_t n = 0; n < kMaxLength; n++) {
+        std::string str;
+        for (size_t i = 0; i < n; i++) {
+            str += (i % 3 == 0) ? '\t' : ' ';
+        }
+        EXPECT_EQ(SkipSpaceAndTab(str, 0), n);
+        EXPECT_EQ(SkipSpaceAndTab(str + "x   ", 0), n);
+        EXPECT_EQ(SkipSpaceAndTab(str + "\r ", 0), n);
+        EXPECT_EQ(SkipSpaceAndTab("ab" + str + "\xE2\x80\x8E", 2), n + 2);
+    }
+}
+
+TEST(CharScanTest, SkipASCIIIdentChars) {
+    const std::string chars = "abcXYZ_019qQ";
+    for (size_t n = 0; n < kMaxLength; n++) {
+        std::string str;
+        for (size_t i = 0; i < n; i++) {
+            str += chars[i % chars.size()];
+        }
+        EXPECT_EQ(SkipASCIIIdentChars(str, 0), n);
+        for (char end : {' ', '(', '.', '@', '`', '[', '{', '/', ':', '\0', '\x80', '\xff'}) {
+            EXPECT_EQ(SkipASCIIIdentChars(str + end + "abc", 0), n)
+                << "end: " << static_cast<int>(end);
+        }
+        EXPECT_EQ(SkipASCIIIdentChars("((" + str + "\xC3\xA9", 2), n + 2);
+    }
+}
+
+TEST(CharScanTest, SkipDecimalDigits) {
+    for (size_t n = 0; n < kMaxLength; n++) {
+        std::string str;
+        for (size_t i = 0; i < n; i++) {
+            str += static_cast<char>('0' + i % 10);
+        }
+        EXPECT_EQ(SkipDecimalDigits(str, 0), n);
+        for (char end : {'.', 'e', 'f', 'u', '/', ':', 'a', ' ', '\0', '\xb0'}) {
+            EXPECT_EQ(SkipDecimalDigits(str + end + "123", 0), n)
+                << "end: " << static_cast<int>(end);
+        }
+        EXPECT_EQ(SkipDecimalDigits("0x" + str, 2), n + 2);
+    }
+}
+
+TEST(CharScanTest, FindBlockCommentDelimiter) {
+    for (size_t n = 0; n < kMaxLength; n++) {
+        std::string str;
+        for (size_t i = 0; i < n; i++) {
+            str += static_cast<char>('!' + i % 8);  // '!' to '(', before '*'
+        }
+        EXPECT_EQ(FindBlockCommentDelimiter(str, 0), n);
+        EXPECT_EQ(FindBlockCommentDelimiter(str + "*/", 0), n);
+        EXPECT_EQ(FindBlockCommentDelimiter(str + "/*", 0), n);
+        EXPECT_EQ(FindBlockCommentDelimiter(str + std::string(1, '\0'), 0), n);
+        EXPECT_EQ(FindBlockCommentDelimiter("**" + str + "*", 2), n + 2);
+    }
+}
+
+TEST(CharScanTest, StartAtEnd) {
+    EXPECT_EQ(SkipSpaceAndTab("  ", 2), 2u);
+    EXPECT_EQ(SkipASCIIIdentChars("ab", 2), 2u);
+    EXPECT_EQ(SkipDecimalDigits("12", 2), 2u);
+    EXPECT_EQ(FindBlockCommentDelimiter("ab", 2), 2u);
+}
+
+}  // namespace
+}  // namespace tint::wgsl::reader
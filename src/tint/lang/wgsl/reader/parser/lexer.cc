@@ -41,6 +41,7 @@
 
 #include "src/tint/lang/core/fluent_types.h"
 #include "src/tint/lang/core/number.h"
+#include "src/tint/lang/wgsl/reader/parser/char_scan.h"
 #include "src/tint/utils/ice/ice.h"
 #include "src/tint/utils/strconv/parse_num.h"
 #include "src/tint/utils/text/unicode.h"
@@ -289,6 +290,12 @@ std::optional<Token> Lexer::skip_blankspace_and_comments() {
                 continue;
             }
 
+            // Fast path for runs of ASCII blankspace.
+            if (auto end = SkipSpaceAndTab(line(), pos()); end != pos()) {
+                set_pos(static_cast<uint32_t>(end));
+                continue;
+            }
+
             bool is_blankspace;
             uint32_t blankspace_size;
             if (!read_blankspace(line(), pos(), &is_blankspace, &blankspace_size)) {
@@ -322,12 +329,11 @@ std::optional<Token> Lexer::skip_blankspace_and_comments() {
 std::optional<Token> Lexer::skip_comment() {
     if (matches(pos(), "//")) {
         // Line comment: ignore everything until the end of line.
-        while (!is_eol()) {
-            if (is_null()) {
-                return Token{Token::Type::kError, begin_source(), "null character found"};
-            }
-            advance();
+        if (auto null_pos = line().find('\0', pos()); null_pos != std::string_view::npos) {
+            set_pos(static_cast<uint32_t>(null_pos));
+            return Token{Token::Type::kError, begin_source(), "null character found"};
         }
+        set_pos(length());
         return {};
     }
 
@@ -342,6 +348,12 @@ std::optional<Token> Lexer::skip_comment() {
 
         int depth = 1;
         while (!is_eof() && depth > 0) {
+            // Skip over the characters that cannot start or end a comment.
+            if (auto end = FindBlockCommentDelimiter(line(), pos()); end != pos()) {
+                set_pos(static_cast<uint32_t>(end));
+                continue;
+            }
+
             if (matches(pos(), "/*")) {
                 // Start of block comment: increase nesting depth.
                 advance(2);
@@ -375,13 +387,15 @@ std::optional<Token> Lexer::try_float() {
     bool has_mantissa_digits = false;
 
     std::optional<size_t> first_significant_digit_position;
-    while (end < length() && is_digit(at(end))) {
-        if (!first_significant_digit_position.has_value() && (at(end) != '0')) {
-            first_significant_digit_position = end;
+    auto integer_end = static_cast<uint32_t>(SkipDecimalDigits(line(), end));
+    if (integer_end != end) {
+        auto digits = line().substr(0, integer_end);
+        if (auto nz = digits.find_first_not_of('0', end); nz != std::string_view::npos) {
+            first_significant_digit_position = nz;
         }
 
         has_mantissa_digits = true;
-        end++;
+        end = integer_end;
     }
 
     std::optional<size_t> dot_position;
@@ -391,17 +405,20 @@ std::optional<Token> Lexer::try_float() {
     }
 
     size_t zeros_before_digit = 0;
-    while (end < length() && is_digit(at(end))) {
+    auto fraction_end = static_cast<uint32_t>(SkipDecimalDigits(line(), end));
+    if (fraction_end != end) {
         if (!first_significant_digit_position.has_value()) {
-            if (at(end) == '0') {
-                zeros_before_digit += 1;
+            auto digits = line().substr(0, fraction_end);
+            if (auto nz = digits.find_first_not_of('0', end); nz != std::string_view::npos) {
+                zeros_before_digit += nz - end;
+                first_significant_digit_position = nz;
             } else {
-                first_significant_digit_position = end;
+                zeros_before_digit += fraction_end - end;
             }
         }
 
         has_mantissa_digits = true;
-        end++;
+        end = fraction_end;
     }
 
     if (!has_mantissa_digits) {
@@ -419,11 +436,9 @@ std::optional<Token> Lexer::try_float() {
         }
         exponent_value_position = end;
 
-        bool has_digits = false;
-        while (end < length() && isdigit(at(end))) {
-            has_digits = true;
-            end++;
-        }
+        auto exponent_end = static_cast<uint32_t>(SkipDecimalDigits(line(), end));
+        bool has_digits = exponent_end != end;
+        end = exponent_end;
 
         // If an 'e' or 'E' was present, then the number part must also be present.
         if (!has_digits) {
@@ -1023,6 +1038,16 @@ std::optional<Token> Lexer::try_ident() {
     }
 
     while (!is_eol()) {
+        // Fast path for runs of ASCII identifier characters.
+        if (auto end = SkipASCIIIdentChars(line(), pos()); end != pos()) {
+            set_pos(static_cast<uint32_t>(end));
+            continue;
+        }
+        // The only ASCII XID_Continue characters are those skipped above.
+        if (static_cast<uint8_t>(at(pos())) < 0x80) {
+            break;
+        }
+
         // Must continue with an XID_Continue unicode character
         auto* utf8 = reinterpret_cast<const uint8_t*>(&at(pos()));
         auto [code_point, n] = tint::utf8::Decode(utf8, line().size() - pos());
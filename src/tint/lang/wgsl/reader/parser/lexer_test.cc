@@ -324,6 +324,42 @@ abcd)");
     EXPECT_EQ(t.source().range.end.column, 4u);
 }
 
+// Tokens longer than the vector width of the character scans.
+TEST_F(LexerTest, LongTokens) {
+    std::string ident = "_" + std::string(70, 'a') + "Z9";
+    std::string comment = "/* " + std::string(70, '-') + " /* " + std::string(40, '.') + " */ */";
+    std::string blank = std::string(40, ' ') + std::string(40, '\t');
+    std::string number =
+        std::string(50, '0') + "1.5" + std::string(50, '0') + "e" + std::string(40, '0') + "1";
+    Source::File file("", blank + ident + blank + comment + number + " // " + comment);
+    Lexer l(&file);
+
+    auto list = l.Lex();
+    ASSERT_EQ(3u, list.size());
+
+    {
+        auto& t = list[0];
+        EXPECT_TRUE(t.IsIdentifier());
+        EXPECT_EQ(t.to_str(), ident);
+        EXPECT_EQ(t.source().range.begin.column, blank.size() + 1);
+        EXPECT_EQ(t.source().range.end.column, blank.size() + ident.size() + 1);
+    }
+
+    {
+        auto& t = list[1];
+        EXPECT_TRUE(t.Is(Token::Type::kFloatLiteral));
+        EXPECT_EQ(t.to_f64(), 15.0);
+        auto start = blank.size() * 2 + ident.size() + comment.size() + 1;
+        EXPECT_EQ(t.source().range.begin.column, start);
+        EXPECT_EQ(t.source().range.end.column, start + number.size());
+    }
+
+    {
+        auto& t = list[2];
+        EXPECT_TRUE(t.IsEof());
+    }
+}
+
 TEST_F(LexerTest, Null_InBlankspace_IsError) {
     Source::File file("", std::string{' ', 0, ' '});
     Lexer l(&file);
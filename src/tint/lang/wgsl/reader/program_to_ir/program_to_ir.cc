@@ -105,6 +105,7 @@
 #include "src/tint/lang/wgsl/sem/value_conversion.h"
 #include "src/tint/lang/wgsl/sem/value_expression.h"
 #include "src/tint/lang/wgsl/sem/variable.h"
+#include "src/tint/utils/containers/hashmap.h"
 #include "src/tint/utils/containers/reverse.h"
 #include "src/tint/utils/containers/scope_stack.h"
 #include "src/tint/utils/macros/defer.h"
@@ -151,6 +152,27 @@ class Impl {
         /* dst */ {builder_.ir.constant_values},
     };
 
+    /// Map of program type to cloned IR type.
+    /// Expressions of the same type are common, so caching avoids repeatedly walking and
+    /// re-interning the type in the IR type manager.
+    Hashmap<const core::type::Type*, const core::type::Type*, 32> cloned_types_;
+
+    /// Map of program constant to cloned IR constant.
+    /// Large constant tables are often referenced many times, and each clone is a deep copy.
+    Hashmap<const core::constant::Value*, const core::constant::Value*, 32> cloned_constants_;
+
+    /// @param ty the program type
+    /// @returns the IR type cloned from @p ty
+    const core::type::Type* CloneType(const core::type::Type* ty) {
+        return cloned_types_.GetOrAdd(ty, [&] { return ty->Clone(clone_ctx_.type_ctx); });
+    }
+
+    /// @param value the program constant
+    /// @returns the IR constant cloned from @p value
+    const core::constant::Value* CloneConstant(const core::constant::Value* value) {
+        return cloned_constants_.GetOrAdd(value, [&] { return value->Clone(clone_ctx_); });
+    }
+
     /// The stack of flow control instructions.
     Vector<core::ir::ControlInstruction*, 8> control_stack_;
 
@@ -271,7 +293,7 @@ class Impl {
         const auto* sem = program_.Sem().Get(ast_func);
 
         auto* ir_func = builder_.Function(ast_func->name->symbol.NameView(),
-                                          sem->ReturnType()->Clone(clone_ctx_.type_ctx));
+                                          CloneType(sem->ReturnType()));
         current_function_ = ir_func;
         scopes_.Set(ast_func->name->symbol, ir_func);
 
@@ -328,7 +350,7 @@ class Impl {
         Vector<core::ir::FunctionParam*, 1> params;
         for (auto* p : ast_func->params) {
             const auto* param_sem = program_.Sem().Get(p)->As<sem::Parameter>();
-            auto* ty = param_sem->Type()->Clone(clone_ctx_.type_ctx);
+            auto* ty = CloneType(param_sem->Type());
             auto* param = builder_.FunctionParam(p->name->symbol.NameView(), ty);
 
             for (auto* attr : p->attributes) {
@@ -682,7 +704,7 @@ class Impl {
                 if (selector->IsDefault()) {
                     selectors.Push(nullptr);
                 } else {
-                    selectors.Push(builder_.Constant(selector->Value()->Clone(clone_ctx_)));
+                    selectors.Push(builder_.Constant(CloneConstant(selector->Value())));
                 }
             }
 
@@ -823,7 +845,7 @@ class Impl {
             core::ir::Value* EmitConstant(const ast::Expression* expr) {
                 if (auto* sem = impl.program_.Sem().GetVal(expr)) {
                     if (auto* v = sem->ConstantValue()) {
-                        if (auto* cv = v->Clone(impl.clone_ctx_)) {
+                        if (auto* cv = impl.CloneConstant(v)) {
                             auto* val = impl.builder_.Constant(cv);
                             bindings_.Add(expr, val);
                             return val;
@@ -848,8 +870,7 @@ class Impl {
 
                 // The access result type should match the source result type. If the source is a
                 // pointer, we generate a pointer.
-                const core::type::Type* ty =
-                    sem->Type()->UnwrapRef()->Clone(impl.clone_ctx_.type_ctx);
+                const core::type::Type* ty = impl.CloneType(sem->Type()->UnwrapRef());
                 if (auto* ptr = obj->Type()->As<core::type::Pointer>();
                     ptr && !ty->Is<core::type::Pointer>()) {
                     ty = impl.builder_.ir.Types().ptr(ptr->AddressSpace(), ty, ptr->Access());
@@ -859,7 +880,7 @@ class Impl {
                     sem,
                     [&](const sem::IndexAccessorExpression* idx) -> core::ir::Value* {
                         if (auto* v = idx->Index()->ConstantValue()) {
-                            if (auto* cv = v->Clone(impl.clone_ctx_)) {
+                            if (auto* cv = impl.CloneConstant(v)) {
                                 return impl.builder_.Constant(cv);
                             }
                             TINT_UNREACHABLE() << "constant clone failed";
@@ -914,7 +935,7 @@ class Impl {
 
             void EmitBinary(const ast::BinaryExpression* b) {
                 auto* b_sem = impl.program_.Sem().Get(b);
-                auto* ty = b_sem->Type()->Clone(impl.clone_ctx_.type_ctx);
+                auto* ty = impl.CloneType(b_sem->Type());
                 auto lhs = GetValue(b->lhs);
                 if (!lhs) {
                     return;
@@ -946,17 +967,17 @@ class Impl {
                         Bind(expr, val);
                         return;
                     case core::UnaryOp::kComplement: {
-                        auto* ty = sem->Type()->Clone(impl.clone_ctx_.type_ctx);
+                        auto* ty = impl.CloneType(sem->Type());
                         inst = impl.builder_.Complement(ty, val);
                         break;
                     }
                     case core::UnaryOp::kNegation: {
-                        auto* ty = sem->Type()->Clone(impl.clone_ctx_.type_ctx);
+                        auto* ty = impl.CloneType(sem->Type());
                         inst = impl.builder_.Negation(ty, val);
                         break;
                     }
                     case core::UnaryOp::kNot: {
-                        auto* ty = sem->Type()->Clone(impl.clone_ctx_.type_ctx);
+                        auto* ty = impl.CloneType(sem->Type());
                         inst = impl.builder_.Not(ty, val);
                         break;
                     }
@@ -969,7 +990,7 @@ class Impl {
                 // If this is a materialized semantic node, just use the constant value.
                 if (auto* mat = impl.program_.Sem().Get(expr)) {
                     if (mat->ConstantValue()) {
-                        auto* cv = mat->ConstantValue()->Clone(impl.clone_ctx_);
+                        auto* cv = impl.CloneConstant(mat->ConstantValue());
                         if (!cv) {
                             impl.AddError(expr->source) << "failed to get constant value for call "
                                                         << expr->TypeInfo().name;
@@ -996,7 +1017,7 @@ class Impl {
                         << "failed to get semantic information for call " << expr->TypeInfo().name;
                     return;
                 }
-                auto* ty = sem->Target()->ReturnType()->Clone(impl.clone_ctx_.type_ctx);
+                auto* ty = impl.CloneType(sem->Target()->ReturnType());
                 core::ir::Instruction* inst = nullptr;
                 // If this is a builtin function, emit the specific builtin value
                 if (auto* b = sem->Target()->As<sem::BuiltinFn>()) {
@@ -1015,7 +1036,7 @@ class Impl {
                                 auto* tmpl_sem = impl.program_.Sem().Get(tmpl->arguments[i]);
                                 auto* tmpl_ty = tmpl_sem->As<sem::TypeExpression>();
                                 TINT_ASSERT(tmpl_ty);
-                                auto* cloned_ty = tmpl_ty->Type()->Clone(impl.clone_ctx_.type_ctx);
+                                auto* cloned_ty = impl.CloneType(tmpl_ty->Type());
                                 explicit_types.Push(cloned_ty);
                             }
                             call->SetExplicitTemplateParams(std::move(explicit_types));
@@ -1060,7 +1081,7 @@ class Impl {
                         << "failed to get semantic information for node " << lit->TypeInfo().name;
                     return;
                 }
-                auto* cv = sem->ConstantValue()->Clone(impl.clone_ctx_);
+                auto* cv = impl.CloneConstant(sem->ConstantValue());
                 if (!cv) {
                     impl.AddError(lit->source)
                         << "failed to get constant value for node " << lit->TypeInfo().name;
@@ -1248,10 +1269,10 @@ class Impl {
                     auto* ary_count =
                         builder_.ir.Types().Get<core::ir::type::ValueArrayCount>(count);
                     store_ty = builder_.ir.Types().Get<core::type::Array>(
-                        ary->ElemType()->Clone(clone_ctx_.type_ctx), ary_count, ary->Align(),
+                        CloneType(ary->ElemType()), ary_count, ary->Align(),
                         ary->Size(), ary->Stride(), ary->ImplicitStride());
                 } else {
-                    store_ty = ref->StoreType()->Clone(clone_ctx_.type_ctx);
+                    store_ty = CloneType(ref->StoreType());
                 }
 
                 auto* ty = builder_.ir.Types().Get<core::type::Pointer>(ref->AddressSpace(),
@@ -1299,7 +1320,7 @@ class Impl {
             },
             [&](const ast::Override* o) {
                 auto* o_sem = program_.Sem().Get(o);
-                auto* ty = sem->Type()->Clone(clone_ctx_.type_ctx);
+                auto* ty = CloneType(sem->Type());
 
                 auto* override = builder_.Override(ty);
                 if (o->initializer) {
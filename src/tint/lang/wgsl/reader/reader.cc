@@ -50,8 +50,22 @@ Program Parse(const Source::File* file, const Options& options) {
 }
 
 Result<core::ir::Module> WgslToIR(const Source::File* file, const Options& options) {
-    Program program = Parse(file, options);
-    return ProgramToLoweredIR(program);
+    // The IR does not reference the AST or semantic info, so the program is released before
+    // lowering to reduce the peak memory usage.
+    auto ir = [&]() -> Result<core::ir::Module> {
+        Program program = Parse(file, options);
+        return ProgramToIR(program);
+    }();
+    if (ir != Success) {
+        return ir.Failure();
+    }
+
+    // Lower from WGSL-dialect to core-dialect
+    auto res = Lower(ir.Get());
+    if (res != Success) {
+        return res.Failure();
+    }
+    return ir;
 }
 
 Result<core::ir::Module> ProgramToLoweredIR(const Program& program) {
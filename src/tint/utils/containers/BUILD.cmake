@@ -46,6 +46,7 @@ tint_add_target(tint_utils_containers lib
   utils/containers/filtered_iterator.h
   utils/containers/hashmap.h
   utils/containers/hashmap_base.h
+  utils/containers/hashmap_group.h
   utils/containers/hashset.h
   utils/containers/map.h
   utils/containers/predicates.h
@@ -78,6 +79,7 @@ tint_add_target(tint_utils_containers_test test
   utils/containers/bitset_test.cc
   utils/containers/enum_set_test.cc
   utils/containers/filtered_iterator_test.cc
+  utils/containers/hashmap_group_test.cc
   utils/containers/hashmap_test.cc
   utils/containers/hashset_test.cc
   utils/containers/map_test.cc
@@ -34,6 +34,7 @@
 #include <tuple>
 #include <utility>
 
+#include "src/tint/utils/containers/hashmap_group.h"
 #include "src/tint/utils/containers/vector.h"
 #include "src/tint/utils/ice/ice.h"
 #include "src/tint/utils/math/hash.h"
@@ -41,6 +42,14 @@
 #include "src/tint/utils/memory/aligned_storage.h"
 #include "src/tint/utils/rtti/traits.h"
 
+// TINT_HASHMAP_OPEN_ADDRESSING selects how HashmapBase indexes its entries:
+// * 0 (default): Each slot holds a linked list of the entries that hash to the slot.
+// * 1: Entries are indexed by an open-addressing table of control bytes, probed a group at a time
+//      using SSE2 or NEON where available. See hashmap_group.h.
+#ifndef TINT_HASHMAP_OPEN_ADDRESSING
+#define TINT_HASHMAP_OPEN_ADDRESSING 0
+#endif
+
 // This file implements a custom STL style container & iterator in a performant manner, using
 // C-style data access. It is not unexpected that -Wunsafe-buffer-usage triggers in this code, since
 // the type of dynamic access being used cannot be guaranteed to be safe via static analysis.
@@ -180,6 +189,16 @@ class HashmapBase {
   protected:
     struct Node;
     struct Slot;
+    class ChainedSlots;
+    class GroupedSlots;
+
+#if TINT_HASHMAP_OPEN_ADDRESSING
+    /// Slots is the index used to find the nodes in the map.
+    using Slots = GroupedSlots;
+#else
+    /// Slots is the index used to find the nodes in the map.
+    using Slots = ChainedSlots;
+#endif
 
   public:
     /// Entry is the type of a single record in the hashmap.
@@ -207,7 +226,6 @@ class HashmapBase {
     /// Constructor.
     /// Constructs an empty map.
     HashmapBase() {
-        slots_.Resize(slots_.Capacity());
         for (auto& node : fixed_) {
             free_.Add(&node);
         }
@@ -234,14 +252,7 @@ class HashmapBase {
     /// Destructor.
     ~HashmapBase() {
         // Call the destructor on all entries in the map.
-        for (size_t slot_idx = 0; slot_idx < slots_.Length(); slot_idx++) {
-            auto* node = slots_[slot_idx].nodes;
-            while (node) {
-                auto next = node->next;
-                node->Destroy();
-                node = next;
-            }
-        }
+        slots_.Clear([](Node* node) { node->Destroy(); });
     }
 
     /// Assignment operator.
@@ -278,16 +289,10 @@ class HashmapBase {
     /// @note the map's capacity is not reduced, as it is assumed that a reused map will likely fill
     /// to a similar size as before.
     void Clear() {
-        for (size_t slot_idx = 0; slot_idx < slots_.Length(); slot_idx++) {
-            auto* node = slots_[slot_idx].nodes;
-            while (node) {
-                auto next = node->next;
-                node->Destroy();
-                free_.Add(node);
-                node = next;
-            }
-            slots_[slot_idx].nodes = nullptr;
-        }
+        slots_.Clear([&](Node* node) {
+            node->Destroy();
+            free_.Add(node);
+        });
         count_ = 0;
     }
 
@@ -310,8 +315,8 @@ class HashmapBase {
     template <typename K>
     Entry* GetEntry(K&& key) {
         HashCode hash = Hash{}(key);
-        auto& slot = slots_[hash % slots_.Length()];
-        return slot.Find(hash, key);
+        auto* node = slots_.Find(hash, key);
+        return node ? &node->Entry() : nullptr;
     }
 
     /// Looks up an entry with the given key.
@@ -322,8 +327,8 @@ class HashmapBase {
     template <typename K>
     const Entry* GetEntry(K&& key) const {
         HashCode hash = Hash{}(key);
-        auto& slot = slots_[hash % slots_.Length()];
-        return slot.Find(hash, key);
+        const auto* node = slots_.Find(hash, key);
+        return node ? &node->Entry() : nullptr;
     }
 
     /// @returns true if the map contains an entry with a key that matches @p key.
@@ -339,17 +344,11 @@ class HashmapBase {
     template <typename K = Key>
     bool Remove(K&& key) {
         HashCode hash = Hash{}(key);
-        auto& slot = slots_[hash % slots_.Length()];
-        Node** edge = &slot.nodes;
-        for (auto* node = *edge; node; node = node->next) {
-            if (node->Equals(hash, key)) {
-                *edge = node->next;
-                node->Destroy();
-                free_.Add(node);
-                count_--;
-                return true;
-            }
-            edge = &node->next;
+        if (auto* node = slots_.Remove(hash, key)) {
+            node->Destroy();
+            free_.Add(node);
+            count_--;
+            return true;
         }
         return false;
     }
@@ -371,8 +370,7 @@ class HashmapBase {
         /// Increments the iterator
         /// @returns this iterator
         IteratorT& operator++() {
-            node_ = node_->next;
-            SkipEmptySlots();
+            node_ = map_.slots_.Next(slot_, node_);
             return *this;
         }
 
@@ -390,15 +388,11 @@ class HashmapBase {
         /// Friend class
         friend class HashmapBase;
 
-        IteratorT(MAP& map, size_t slot, NODE* node) : map_(map), slot_(slot), node_(node) {
-            SkipEmptySlots();
-        }
+        /// Constructs an iterator to the first entry of the map.
+        explicit IteratorT(MAP& map) : map_(map), node_(map.slots_.First(slot_)) {}
 
-        void SkipEmptySlots() {
-            while (!node_ && slot_ + 1 < map_.slots_.Length()) {
-                node_ = map_.slots_[++slot_].nodes;
-            }
-        }
+        /// Constructs an iterator to the end of the map.
+        IteratorT(MAP& map, std::nullptr_t) : map_(map) {}
 
         MAP& map_;
         size_t slot_ = 0;
@@ -412,16 +406,16 @@ class HashmapBase {
     using ConstIterator = IteratorT</*IS_CONST*/ true>;
 
     /// @returns an immutable iterator to the start of the map.
-    ConstIterator begin() const { return ConstIterator{*this, 0, slots_.Front().nodes}; }
+    ConstIterator begin() const { return ConstIterator{*this}; }
 
     /// @returns an immutable iterator to the end of the map.
-    ConstIterator end() const { return ConstIterator{*this, slots_.Length(), nullptr}; }
+    ConstIterator end() const { return ConstIterator{*this, nullptr}; }
 
     /// @returns an iterator to the start of the map.
-    Iterator begin() { return Iterator{*this, 0, slots_.Front().nodes}; }
+    Iterator begin() { return Iterator{*this}; }
 
     /// @returns an iterator to the end of the map.
-    Iterator end() { return Iterator{*this, slots_.Length(), nullptr}; }
+    Iterator end() { return Iterator{*this, nullptr}; }
 
     /// STL-friendly alias to Entry. Used by gmock.
     using value_type = const Entry&;
@@ -465,14 +459,11 @@ class HashmapBase {
     /// @param other the hashmap to copy
     void Copy(const HashmapBase& other) {
         Reserve(other.capacity_);
-        slots_.Resize(other.slots_.Length());
-        for (size_t slot_idx = 0; slot_idx < slots_.Length(); slot_idx++) {
-            for (auto* o = other.slots_[slot_idx].nodes; o; o = o->next) {
-                auto* node = free_.Take();
-                new (&node->Entry()) Entry{o->Entry()};
-                slots_[slot_idx].Add(node);
-            }
-        }
+        slots_.Copy(other.slots_, [&](const Node* o) {
+            auto* node = free_.Take();
+            new (&node->Entry()) Entry{o->Entry()};
+            return node;
+        });
         count_ = other.count_;
     }
 
@@ -481,14 +472,11 @@ class HashmapBase {
     /// @param other the hashmap to move
     void Move(HashmapBase&& other) {
         Reserve(other.capacity_);
-        slots_.Resize(other.slots_.Length());
-        for (size_t slot_idx = 0; slot_idx < slots_.Length(); slot_idx++) {
-            for (auto* o = other.slots_[slot_idx].nodes; o; o = o->next) {
-                auto* node = free_.Take();
-                new (&node->Entry()) Entry{std::move(o->Entry())};
-                slots_[slot_idx].Add(node);
-            }
-        }
+        slots_.Copy(other.slots_, [&](Node* o) {
+            auto* node = free_.Take();
+            new (&node->Entry()) Entry{std::move(o->Entry())};
+            return node;
+        });
         count_ = other.count_;
         other.Clear();
     }
@@ -498,8 +486,6 @@ class HashmapBase {
     struct EditIndex {
         /// The HashmapBase that created this EditIndex
         HashmapBase& map;
-        /// The slot that will hold the edit.
-        Slot& slot;
         /// The hash of the key, passed to EditAt().
         HashCode hash;
         /// The resolved node entry, or nullptr if EditAt() did not resolve to an existing entry.
@@ -524,10 +510,10 @@ class HashmapBase {
         template <typename K, typename... V>
         void Insert(K&& key, V&&... values) {
             auto* node = map.free_.Take();
-            slot.Add(node);
-            map.count_++;
             entry = &node->Entry();
             new (entry) Entry{Key{hash, std::forward<K>(key)}, std::forward<V>(values)...};
+            map.slots_.Add(hash, node);
+            map.count_++;
         }
     };
 
@@ -542,30 +528,11 @@ class HashmapBase {
         if (!free_.nodes_) {
             free_.Allocate(capacity_);
             capacity_ += capacity_;
-            Rehash();
+            slots_.Rehash(capacity_);
         }
         HashCode hash = Hash{}(key);
-        auto& slot = slots_[hash % slots_.Length()];
-        auto* entry = slot.Find(hash, key);
-        return {*this, slot, hash, entry};
-    }
-
-    /// Rehash resizes the slots vector proportionally to the map capacity, and then reinserts the
-    /// nodes so they're linked in the correct slots linked lists.
-    void Rehash() {
-        size_t num_slots = NumSlots(capacity_);
-        decltype(slots_) old_slots;
-        std::swap(slots_, old_slots);
-        slots_.Resize(num_slots);
-        for (size_t old_slot_idx = 0; old_slot_idx < old_slots.Length(); old_slot_idx++) {
-            auto* node = old_slots[old_slot_idx].nodes;
-            while (node) {
-                auto next = node->next;
-                size_t new_slot_idx = node->Key().hash % num_slots;
-                slots_[new_slot_idx].Add(node);
-                node = next;
-            }
-        }
+        auto* node = slots_.Find(hash, key);
+        return {*this, hash, node ? &node->Entry() : nullptr};
     }
 
     /// Slot holds a linked list of nodes. Nodes are assigned to the slot list by calculating the
@@ -586,27 +553,350 @@ class HashmapBase {
         /// @param hash the key hash to search for.
         /// @param key the key value to search for.
         template <typename K>
-        const Entry* Find(HashCode hash, K&& key) const {
+        Node* Find(HashCode hash, K&& key) const {
             for (auto* node = nodes; node; node = node->next) {
                 if (node->Equals(hash, key)) {
-                    return &node->Entry();
+                    return node;
                 }
             }
             return nullptr;
         }
+    };
 
-        /// @returns the node in the slot with the given hash and key.
+    /// ChainedSlots indexes the nodes of the map with a vector of Slots, where each slot holds a
+    /// linked list of nodes.
+    class ChainedSlots {
+      public:
+        /// Constructor
+        ChainedSlots() { slots_.Resize(slots_.Capacity()); }
+
+        /// @returns the node with the given hash and key, or nullptr if not found.
         /// @param hash the key hash to search for.
         /// @param key the key value to search for.
         template <typename K>
-        Entry* Find(HashCode hash, K&& key) {
-            for (auto* node = nodes; node; node = node->next) {
+        Node* Find(HashCode hash, K&& key) const {
+            return slots_[hash % slots_.Length()].Find(hash, key);
+        }
+
+        /// Adds the node @p node to the index.
+        /// @param hash the hash of the node's key.
+        /// @param node the node to add. Must not already be in the index.
+        void Add(HashCode hash, Node* node) { slots_[hash % slots_.Length()].Add(node); }
+
+        /// Unlinks the node with the given hash and key.
+        /// @param hash the key hash to search for.
+        /// @param key the key value to search for.
+        /// @returns the unlinked node, or nullptr if not found.
+        template <typename K>
+        Node* Remove(HashCode hash, K&& key) {
+            auto& slot = slots_[hash % slots_.Length()];
+            Node** edge = &slot.nodes;
+            for (auto* node = *edge; node; node = node->next) {
                 if (node->Equals(hash, key)) {
-                    return &node->Entry();
+                    *edge = node->next;
+                    return node;
                 }
+                edge = &node->next;
             }
             return nullptr;
         }
+
+        /// Rehash resizes the slots vector proportionally to the map capacity, and then reinserts
+        /// the nodes so they're linked in the correct slots linked lists.
+        /// @param capacity the new capacity of the map.
+        void Rehash(size_t capacity) {
+            size_t num_slots = NumSlots(capacity);
+            decltype(slots_) old_slots;
+            std::swap(slots_, old_slots);
+            slots_.Resize(num_slots);
+            for (size_t old_slot_idx = 0; old_slot_idx < old_slots.Length(); old_slot_idx++) {
+                auto* node = old_slots[old_slot_idx].nodes;
+                while (node) {
+                    auto next = node->next;
+                    size_t new_slot_idx = node->Key().hash % num_slots;
+                    slots_[new_slot_idx].Add(node);
+                    node = next;
+                }
+            }
+        }
+
+        /// Unlinks all the nodes, calling @p f on each.
+        /// @param f the function called with each of the unlinked nodes.
+        template <typename F>
+        void Clear(F&& f) {
+            for (size_t slot_idx = 0; slot_idx < slots_.Length(); slot_idx++) {
+                auto* node = slots_[slot_idx].nodes;
+                while (node) {
+                    auto next = node->next;
+                    f(node);
+                    node = next;
+                }
+                slots_[slot_idx].nodes = nullptr;
+            }
+        }
+
+        /// Populates this empty index with the nodes returned by calling @p f with each of the
+        /// nodes of @p other.
+        /// @param other the index to copy.
+        /// @param f the function that returns the new node for the node of @p other.
+        template <typename F>
+        void Copy(const ChainedSlots& other, F&& f) {
+            slots_.Resize(other.slots_.Length());
+            for (size_t slot_idx = 0; slot_idx < slots_.Length(); slot_idx++) {
+                for (auto* o = other.slots_[slot_idx].nodes; o; o = o->next) {
+                    slots_[slot_idx].Add(f(o));
+                }
+            }
+        }
+
+        /// @param slot assigned the slot index of the returned node.
+        /// @returns the first node of the index, or nullptr if the index is empty.
+        Node* First(size_t& slot) const {
+            slot = 0;
+            return SkipEmptySlots(slot, slots_.Front().nodes);
+        }
+
+        /// @param slot the slot index of @p node, assigned the slot index of the returned node.
+        /// @param node the current node
+        /// @returns the node following @p node, or nullptr if @p node is the last node.
+        Node* Next(size_t& slot, const Node* node) const {
+            return SkipEmptySlots(slot, node->next);
+        }
+
+      private:
+        Node* SkipEmptySlots(size_t& slot, Node* node) const {
+            while (!node && slot + 1 < slots_.Length()) {
+                node = slots_[++slot].nodes;
+            }
+            return node;
+        }
+
+        /// The vector of slots. Each slot holds a linked list of nodes which hold entries in the
+        /// map.
+        Vector<Slot, NumSlots(N)> slots_;
+    };
+
+    /// GroupedSlots indexes the nodes of the map with an open-addressing table of node pointers.
+    /// Each bucket has a control byte which holds 7 bits of the node's hash, or marks the bucket as
+    /// empty or deleted. Lookups probe a hashmap_group::Group of control bytes at a time, so most
+    /// mismatching nodes are rejected without dereferencing their pointer.
+    /// Nodes are never moved, preserving the stability of entry references.
+    class GroupedSlots {
+        using Group = hashmap_group::Group;
+
+        /// @returns the number of buckets required to hold @p capacity nodes, below the maximum
+        /// load factor of 7/8.
+        static constexpr size_t NumBuckets(size_t capacity) {
+            size_t num_buckets = 16;
+            while (MaxUsed(num_buckets) <= capacity) {
+                num_buckets *= 2;
+            }
+            return num_buckets;
+        }
+
+        /// @returns the maximum number of full and deleted buckets before the table is rebuilt.
+        static constexpr size_t MaxUsed(size_t num_buckets) {
+            return num_buckets - num_buckets / 8;
+        }
+
+        static constexpr size_t kFixedBuckets = NumBuckets(kMinCapacity);
+        static_assert(kFixedBuckets % Group::kWidth == 0);
+
+      public:
+        /// Constructor
+        GroupedSlots() { Init(kFixedBuckets); }
+
+        /// @returns the node with the given hash and key, or nullptr if not found.
+        /// @param hash the key hash to search for.
+        /// @param key the key value to search for.
+        template <typename K>
+        Node* Find(HashCode hash, K&& key) const {
+            auto bucket = FindBucket(hash, key);
+            return bucket ? nodes_[*bucket] : nullptr;
+        }
+
+        /// Adds the node @p node to the index.
+        /// @param hash the hash of the node's key.
+        /// @param node the node to add. Must not already be in the index.
+        void Add(HashCode hash, Node* node) {
+            uint32_t mixed = hashmap_group::Mix(hash);
+            size_t bucket = FindFreeBucket(mixed);
+            if (ctrl_[bucket] == hashmap_group::kEmpty) {
+                if (DAWN_UNLIKELY(used_ >= MaxUsed(ctrl_.Length()))) {
+                    // Rebuild to drop the deleted buckets, growing if required.
+                    Rebuild(std::max(ctrl_.Length(), NumBuckets(full_ + 1)));
+                    bucket = FindFreeBucket(mixed);
+                }
+                used_++;
+            }
+            ctrl_[bucket] = hashmap_group::H2(mixed);
+            nodes_[bucket] = node;
+            full_++;
+        }
+
+        /// Unlinks the node with the given hash and key.
+        /// @param hash the key hash to search for.
+        /// @param key the key value to search for.
+        /// @returns the unlinked node, or nullptr if not found.
+        template <typename K>
+        Node* Remove(HashCode hash, K&& key) {
+            auto bucket = FindBucket(hash, key);
+            if (!bucket) {
+                return nullptr;
+            }
+            // If the bucket's group has an empty bucket, then no probe sequence can have passed
+            // over this group, and the bucket can be marked as empty instead of deleted.
+            size_t group_start = *bucket - (*bucket % Group::kWidth);
+            if (Group{&ctrl_[group_start]}.MatchEmpty()) {
+                ctrl_[*bucket] = hashmap_group::kEmpty;
+                used_--;
+            } else {
+                ctrl_[*bucket] = hashmap_group::kDeleted;
+            }
+            full_--;
+            return nodes_[*bucket];
+        }
+
+        /// Grows the table to hold @p capacity nodes.
+        /// @param capacity the new capacity of the map.
+        void Rehash(size_t capacity) {
+            size_t num_buckets = NumBuckets(capacity);
+            if (num_buckets > ctrl_.Length()) {
+                Rebuild(num_buckets);
+            }
+        }
+
+        /// Unlinks all the nodes, calling @p f on each.
+        /// @param f the function called with each of the unlinked nodes.
+        template <typename F>
+        void Clear(F&& f) {
+            for (size_t i = 0; i < ctrl_.Length(); i++) {
+                if (hashmap_group::IsFull(ctrl_[i])) {
+                    f(nodes_[i]);
+                }
+                ctrl_[i] = hashmap_group::kEmpty;
+            }
+            used_ = 0;
+            full_ = 0;
+        }
+
+        /// Populates this empty index with the nodes returned by calling @p f with each of the
+        /// nodes of @p other.
+        /// @param other the index to copy.
+        /// @param f the function that returns the new node for the node of @p other.
+        template <typename F>
+        void Copy(const GroupedSlots& other, F&& f) {
+            Init(std::max(ctrl_.Length(), other.ctrl_.Length()));
+            for (size_t i = 0; i < other.ctrl_.Length(); i++) {
+                if (hashmap_group::IsFull(other.ctrl_[i])) {
+                    Node* node = f(other.nodes_[i]);
+                    Place(hashmap_group::Mix(node->Key().hash), node);
+                }
+            }
+        }
+
+        /// @param slot assigned the bucket index of the returned node.
+        /// @returns the first node of the index, or nullptr if the index is empty.
+        Node* First(size_t& slot) const { return SkipEmptyBuckets(slot = 0); }
+
+        /// @param slot the bucket index of the current node, assigned the bucket index of the
+        /// returned node.
+        /// @returns the node following the current node, or nullptr if it is the last node.
+        Node* Next(size_t& slot, const Node*) const { return SkipEmptyBuckets(++slot); }
+
+      private:
+        /// @returns the index of the bucket holding the node with the given hash and key, or
+        /// std::nullopt if not found.
+        template <typename K>
+        std::optional<size_t> FindBucket(HashCode hash, K&& key) const {
+            uint32_t mixed = hashmap_group::Mix(hash);
+            uint8_t h2 = hashmap_group::H2(mixed);
+            size_t group = hashmap_group::H1(mixed) & group_mask_;
+            for (size_t step = 1;; step++) {
+                size_t start = group * Group::kWidth;
+                Group g{&ctrl_[start]};
+                for (auto match = g.Match(h2); match; match.ClearLowest()) {
+                    size_t bucket = start + match.Lowest();
+                    if (nodes_[bucket]->Equals(hash, key)) {
+                        return bucket;
+                    }
+                }
+                if (DAWN_LIKELY(g.MatchEmpty())) {
+                    return std::nullopt;
+                }
+                // Triangular probing visits every group, as the group count is a power of two.
+                group = (group + step) & group_mask_;
+            }
+        }
+
+        /// @returns the index of the first empty or deleted bucket in the probe sequence for the
+        /// mixed hash @p mixed.
+        size_t FindFreeBucket(uint32_t mixed) const {
+            size_t group = hashmap_group::H1(mixed) & group_mask_;
+            for (size_t step = 1;; step++) {
+                size_t start = group * Group::kWidth;
+                if (auto match = Group{&ctrl_[start]}.MatchEmptyOrDeleted()) {
+                    return start + match.Lowest();
+                }
+                group = (group + step) & group_mask_;
+            }
+        }
+
+        /// Places @p node into a free bucket, without checking the load of the table.
+        void Place(uint32_t mixed, Node* node) {
+            size_t bucket = FindFreeBucket(mixed);
+            if (ctrl_[bucket] == hashmap_group::kEmpty) {
+                used_++;
+            }
+            ctrl_[bucket] = hashmap_group::H2(mixed);
+            nodes_[bucket] = node;
+            full_++;
+        }
+
+        /// Resets the table to @p num_buckets empty buckets.
+        void Init(size_t num_buckets) {
+            ctrl_.Clear();
+            ctrl_.Resize(num_buckets, hashmap_group::kEmpty);
+            nodes_.Resize(num_buckets);
+            group_mask_ = num_buckets / Group::kWidth - 1;
+            used_ = 0;
+            full_ = 0;
+        }
+
+        /// Reinserts all the nodes into a new table of @p num_buckets buckets.
+        void Rebuild(size_t num_buckets) {
+            decltype(ctrl_) old_ctrl;
+            decltype(nodes_) old_nodes;
+            std::swap(ctrl_, old_ctrl);
+            std::swap(nodes_, old_nodes);
+            Init(num_buckets);
+            for (size_t i = 0; i < old_ctrl.Length(); i++) {
+                if (hashmap_group::IsFull(old_ctrl[i])) {
+                    Node* node = old_nodes[i];
+                    Place(hashmap_group::Mix(node->Key().hash), node);
+                }
+            }
+        }
+
+        Node* SkipEmptyBuckets(size_t& slot) const {
+            for (; slot < ctrl_.Length(); slot++) {
+                if (hashmap_group::IsFull(ctrl_[slot])) {
+                    return nodes_[slot];
+                }
+            }
+            return nullptr;
+        }
+
+        /// The control bytes, one per bucket.
+        Vector<uint8_t, kFixedBuckets> ctrl_;
+        /// The node pointers, one per bucket. Only valid for full buckets.
+        Vector<Node*, kFixedBuckets> nodes_;
+        /// The number of groups, minus one.
+        size_t group_mask_ = 0;
+        /// The number of full and deleted buckets.
+        size_t used_ = 0;
+        /// The number of full buckets.
+        size_t full_ = 0;
     };
 
     /// Free holds a linked list of nodes which are currently not used by entries in the map, and a
@@ -679,8 +969,8 @@ class HashmapBase {
     /// The fixed-size array of nodes, used for the first kMinCapacity entries of the map, before
     /// allocating from the heap.
     std::array<Node, kMinCapacity> fixed_;
-    /// The vector of slots. Each slot holds a linked list of nodes which hold entries in the map.
-    Vector<Slot, NumSlots(N)> slots_;
+    /// The index of the nodes which hold entries in the map.
+    Slots slots_;
     /// The linked list of free nodes, and node allocations from the heap.
     FreeNodes free_;
     /// The total number of nodes, including free nodes (kMinCapacity + heap-allocated)
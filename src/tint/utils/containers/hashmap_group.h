@@ -0,0 +1,250 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef SRC_TINT_UTILS_CONTAINERS_HASHMAP_GROUP_H_
+#define SRC_TINT_UTILS_CONTAINERS_HASHMAP_GROUP_H_
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "src/tint/utils/macros/compiler.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TINT_HASHMAP_GROUP_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define TINT_HASHMAP_GROUP_NEON 1
+#include <arm_neon.h>
+#endif
+
+#ifndef TINT_HASHMAP_GROUP_SSE2
+#define TINT_HASHMAP_GROUP_SSE2 0
+#endif
+
+#ifndef TINT_HASHMAP_GROUP_NEON
+#define TINT_HASHMAP_GROUP_NEON 0
+#endif
+
+TINT_BEGIN_DISABLE_WARNING(UNSAFE_BUFFER_USAGE);
+
+namespace tint::hashmap_group {
+
+/// Control byte values.
+/// A control byte is associated with each bucket of an open-addressing hash table.
+/// A full bucket holds the low 7 bits of the entry's hash (H2), so the top bit is clear.
+/// Empty and deleted buckets have the top bit set.
+enum Ctrl : uint8_t {
+    /// The bucket has never held an entry since the table was last rebuilt.
+    kEmpty = 0x80,
+    /// The bucket held an entry that has since been removed (a tombstone).
+    kDeleted = 0xfe,
+};
+
+/// @returns true if the control byte @p ctrl represents a bucket holding an entry.
+inline constexpr bool IsFull(uint8_t ctrl) {
+    return (ctrl & 0x80) == 0;
+}
+
+/// @returns the 7-bit hash fragment stored in the control byte of a full bucket.
+/// @param hash the mixed hash of the entry
+inline constexpr uint8_t H2(uint32_t hash) {
+    return static_cast<uint8_t>(hash & 0x7f);
+}
+
+/// @returns the hash fragment used to select the first probed group.
+/// @param hash the mixed hash of the entry
+inline constexpr uint32_t H1(uint32_t hash) {
+    return hash >> 7;
+}
+
+/// @returns @p hash with the bits avalanched, so that both H1() and H2() are well distributed.
+/// Many of Tint's hashers are identity functions or pointer shifts, which leave clusters in the
+/// low bits.
+/// @param hash the hash to mix
+inline constexpr uint32_t Mix(uint32_t hash) {
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+/// BitMask is the result of matching a Group's control bytes.
+/// Each matching byte is represented by a single set bit within the `1 << SHIFT` bits that
+/// correspond to that byte.
+/// @tparam T the underlying integer type
+/// @tparam SHIFT the log2 of the number of bits used per control byte
+template <typename T, int SHIFT>
+class BitMask {
+  public:
+    /// Constructor
+    /// @param mask the mask bits
+    explicit constexpr BitMask(T mask) : mask_(mask) {}
+
+    /// @returns true if any of the bytes matched
+    explicit constexpr operator bool() const { return mask_ != 0; }
+
+    /// @returns the index of the lowest matching byte
+    /// @note must only be called if this mask is non-zero
+    constexpr size_t Lowest() const {
+        return static_cast<size_t>(std::countr_zero(mask_)) >> SHIFT;
+    }
+
+    /// Clears the lowest matching byte
+    constexpr void ClearLowest() { mask_ &= mask_ - 1; }
+
+  private:
+    T mask_;
+};
+
+#if TINT_HASHMAP_GROUP_SSE2
+
+/// Group is a window of kWidth control bytes, matched with SSE2 instructions.
+class Group {
+  public:
+    /// The number of control bytes in a group.
+    static constexpr size_t kWidth = 16;
+
+    /// Constructor
+    /// @param ctrl a pointer to the first of the kWidth control bytes of the group
+    explicit Group(const uint8_t* ctrl)
+        : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+    /// @returns a mask of the full buckets with the hash fragment @p h2
+    /// @param h2 the 7-bit hash fragment to match
+    BitMask<uint32_t, 0> Match(uint8_t h2) const {
+        auto match = _mm_set1_epi8(static_cast<char>(h2));
+        return BitMask<uint32_t, 0>(
+            static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(match, ctrl_))));
+    }
+
+    /// @returns a mask of the empty buckets
+    BitMask<uint32_t, 0> MatchEmpty() const {
+        auto match = _mm_set1_epi8(static_cast<char>(kEmpty));
+        return BitMask<uint32_t, 0>(
+            static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(match, ctrl_))));
+    }
+
+    /// @returns a mask of the empty or deleted buckets
+    BitMask<uint32_t, 0> MatchEmptyOrDeleted() const {
+        // Empty and deleted are the only control bytes with the top bit set.
+        return BitMask<uint32_t, 0>(static_cast<uint32_t>(_mm_movemask_epi8(ctrl_)));
+    }
+
+  private:
+    __m128i ctrl_;
+};
+
+#elif TINT_HASHMAP_GROUP_NEON
+
+/// Group is a window of kWidth control bytes, matched with NEON instructions.
+class Group {
+  public:
+    /// The number of control bytes in a group.
+    static constexpr size_t kWidth = 8;
+
+    /// Constructor
+    /// @param ctrl a pointer to the first of the kWidth control bytes of the group
+    explicit Group(const uint8_t* ctrl) : ctrl_(vld1_u8(ctrl)) {}
+
+    /// @returns a mask of the full buckets with the hash fragment @p h2
+    /// @param h2 the 7-bit hash fragment to match
+    BitMask<uint64_t, 3> Match(uint8_t h2) const { return ToMask(vceq_u8(ctrl_, vdup_n_u8(h2))); }
+
+    /// @returns a mask of the empty buckets
+    BitMask<uint64_t, 3> MatchEmpty() const { return ToMask(vceq_u8(ctrl_, vdup_n_u8(kEmpty))); }
+
+    /// @returns a mask of the empty or deleted buckets
+    BitMask<uint64_t, 3> MatchEmptyOrDeleted() const {
+        // Empty and deleted are the only control bytes with the top bit set.
+        return ToMask(ctrl_);
+    }
+
+  private:
+    static BitMask<uint64_t, 3> ToMask(uint8x8_t bytes) {
+        return BitMask<uint64_t, 3>(vget_lane_u64(vreinterpret_u64_u8(bytes), 0) &
+                                    0x8080808080808080ull);
+    }
+
+    uint8x8_t ctrl_;
+};
+
+#else
+
+/// Group is a window of kWidth control bytes, matched using 64-bit integer arithmetic.
+class Group {
+  public:
+    /// The number of control bytes in a group.
+    static constexpr size_t kWidth = 8;
+
+    /// Constructor
+    /// @param ctrl a pointer to the first of the kWidth control bytes of the group
+    explicit Group(const uint8_t* ctrl) {
+        // Assembled byte-by-byte so that byte `i` is always at bits [8i, 8i+7], regardless of
+        // the host's endianness. Compilers fold this into a single load on little-endian hosts.
+        for (size_t i = 0; i < kWidth; i++) {
+            ctrl_ |= static_cast<uint64_t>(ctrl[i]) << (i * 8);
+        }
+    }
+
+    /// @returns a mask of the full buckets with the hash fragment @p h2
+    /// @param h2 the 7-bit hash fragment to match
+    /// @note this may report false positives for bytes that follow a true match. This is harmless,
+    /// as callers always compare the keys of the matched buckets.
+    BitMask<uint64_t, 3> Match(uint8_t h2) const {
+        uint64_t x = ctrl_ ^ (kLsbs * h2);
+        return BitMask<uint64_t, 3>((x - kLsbs) & ~x & kMsbs);
+    }
+
+    /// @returns a mask of the empty buckets
+    BitMask<uint64_t, 3> MatchEmpty() const {
+        // kEmpty is the only control byte with the top bit set and bit 1 clear.
+        return BitMask<uint64_t, 3>(ctrl_ & ~(ctrl_ << 6) & kMsbs);
+    }
+
+    /// @returns a mask of the empty or deleted buckets
+    BitMask<uint64_t, 3> MatchEmptyOrDeleted() const {
+        // Empty and deleted are the only control bytes with the top bit set.
+        return BitMask<uint64_t, 3>(ctrl_ & kMsbs);
+    }
+
+  private:
+    static constexpr uint64_t kLsbs = 0x0101010101010101ull;
+    static constexpr uint64_t kMsbs = 0x8080808080808080ull;
+
+    uint64_t ctrl_ = 0;
+};
+
+#endif
+
+}  // namespace tint::hashmap_group
+
+TINT_END_DISABLE_WARNING(UNSAFE_BUFFER_USAGE);
+
+#endif  // SRC_TINT_UTILS_CONTAINERS_HASHMAP_GROUP_H_
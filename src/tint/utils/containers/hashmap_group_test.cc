@@ -0,0 +1,119 @@
+// Copyright 2026 The Dawn & Tint Authors
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "src/tint/utils/containers/hashmap_group.h"
+
+#include <array>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+namespace tint::hashmap_group {
+namespace {
+
+using Ctrl = std::array<uint8_t, Group::kWidth>;
+
+/// @returns the indices of the bytes set in @p mask, in ascending order
+template <typename MASK>
+std::vector<size_t> Indices(MASK mask) {
+    std::vector<size_t> out;
+    for (; mask; mask.ClearLowest()) {
+        out.push_back(mask.Lowest());
+    }
+    return out;
+}
+
+Ctrl MakeCtrl() {
+    Ctrl ctrl;
+    ctrl.fill(kEmpty);
+    ctrl[1] = 0x12;
+    ctrl[2] = kDeleted;
+    ctrl[3] = 0x34;
+    ctrl[Group::kWidth - 1] = 0x12;
+    ctrl[Group::kWidth - 2] = kDeleted;
+    return ctrl;
+}
+
+TEST(HashmapGroup, Match) {
+    auto ctrl = MakeCtrl();
+    Group group{ctrl.data()};
+    EXPECT_THAT(Indices(group.Match(0x12)), testing::ElementsAre(1, Group::kWidth - 1));
+    EXPECT_THAT(Indices(group.Match(0x34)), testing::ElementsAre(3));
+    EXPECT_THAT(Indices(group.Match(0x56)), testing::ElementsAre());
+}
+
+TEST(HashmapGroup, MatchEmpty) {
+    auto ctrl = MakeCtrl();
+    Group group{ctrl.data()};
+    auto empty = Indices(group.MatchEmpty());
+    EXPECT_EQ(empty.size(), Group::kWidth - 5);
+    EXPECT_EQ(empty.front(), 0u);
+    for (size_t i : empty) {
+        EXPECT_EQ(ctrl[i], kEmpty);
+    }
+}
+
+TEST(HashmapGroup, MatchEmptyOrDeleted) {
+    auto ctrl = MakeCtrl();
+    Group group{ctrl.data()};
+    auto free = Indices(group.MatchEmptyOrDeleted());
+    EXPECT_EQ(free.size(), Group::kWidth - 3);
+    for (size_t i : free) {
+        EXPECT_FALSE(IsFull(ctrl[i]));
+    }
+}
+
+TEST(HashmapGroup, Full) {
+    Ctrl ctrl;
+    for (size_t i = 0; i < Group::kWidth; i++) {
+        ctrl[i] = static_cast<uint8_t>(i * 9 % 0x80);
+    }
+    Group group{ctrl.data()};
+    EXPECT_FALSE(group.MatchEmpty());
+    EXPECT_FALSE(group.MatchEmptyOrDeleted());
+    for (size_t i = 0; i < Group::kWidth; i++) {
+        auto match = group.Match(ctrl[i]);
+        ASSERT_TRUE(match);
+        EXPECT_EQ(match.Lowest(), i);
+    }
+}
+
+TEST(HashmapGroup, Mix) {
+    // Pointer hashes are shifted addresses, which differ only in a few low bits.
+    std::array<bool, 128> seen{};
+    for (uint32_t i = 0; i < 64; i++) {
+        seen[H2(Mix(0x1000 + i * 4))] = true;
+    }
+    size_t distinct = 0;
+    for (bool s : seen) {
+        distinct += s ? 1 : 0;
+    }
+    EXPECT_GT(distinct, 32u);
+}
+
+}  // namespace
+}  // namespace tint::hashmap_group
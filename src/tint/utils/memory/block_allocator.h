@@ -35,6 +35,7 @@
 #include "src/tint/utils/macros/compiler.h"
 #include "src/tint/utils/math/math.h"
 #include "src/tint/utils/memory/bitcast.h"
+#include "src/tint/utils/memory/bump_allocator.h"
 
 // This file implements a custom allocator & iterator using C-style data access. It is not
 // unexpected that -Wunsafe-buffer-usage triggers in this code, since the type of dynamic access
@@ -52,6 +53,11 @@ namespace tint {
 /// freed.
 ///
 /// Objects held by the BlockAllocator can be iterated over using a View.
+///
+/// A BlockAllocator can optionally allocate its blocks from a BumpAllocator arena, which lets
+/// several BlockAllocators share the arena's larger heap allocations. In this case the blocks are
+/// not freed by the BlockAllocator, and are instead released in bulk when the arena is reset or
+/// destructed. The arena must outlive the BlockAllocator.
 template <typename T, size_t BLOCK_SIZE = 64 * 1024, size_t BLOCK_ALIGNMENT = 16>
 class BlockAllocator {
     /// Pointers is a chunk of T* pointers, forming a linked list.
@@ -175,9 +181,16 @@ class BlockAllocator {
     /// Constructor
     BlockAllocator() = default;
 
+    /// Constructor
+    /// @param arena the arena to allocate blocks from
+    explicit BlockAllocator(BumpAllocator& arena) : arena_(&arena) {}
+
     /// Move constructor
     /// @param rhs the BlockAllocator to move
-    BlockAllocator(BlockAllocator&& rhs) { std::swap(data, rhs.data); }
+    BlockAllocator(BlockAllocator&& rhs) {
+        std::swap(data, rhs.data);
+        std::swap(arena_, rhs.arena_);
+    }
 
     /// Move assignment operator
     /// @param rhs the BlockAllocator to move
@@ -186,6 +199,7 @@ class BlockAllocator {
         if (this != &rhs) {
             Reset();
             std::swap(data, rhs.data);
+            std::swap(arena_, rhs.arena_);
         }
         return *this;
     }
@@ -224,11 +238,13 @@ class BlockAllocator {
         for (auto ptr : Objects()) {
             ptr->~T();
         }
-        auto* block = data.block.root;
-        while (block != nullptr) {
-            auto* next = block->next;
-            delete block;
-            block = next;
+        if (!arena_) {
+            auto* block = data.block.root;
+            while (block != nullptr) {
+                auto* next = block->next;
+                delete block;
+                block = next;
+            }
         }
         data = {};
     }
@@ -254,7 +270,12 @@ class BlockAllocator {
         if (block.current_offset + sizeof(TYPE) > BLOCK_SIZE) {
             // Allocate a new block from the heap
             auto* prev_block = block.current;
-            block.current = new Block;
+            if (arena_) {
+                auto* mem = arena_->Allocate(sizeof(Block), alignof(Block));
+                block.current = mem ? new (mem) Block : nullptr;
+            } else {
+                block.current = new Block;
+            }
             if (!block.current) {
                 return nullptr;  // out of memory
             }
@@ -321,6 +342,9 @@ class BlockAllocator {
 
         size_t count = 0;
     } data;
+
+    /// The arena that blocks are allocated from, or nullptr if blocks are allocated from the heap
+    BumpAllocator* arena_ = nullptr;
 };
 
 }  // namespace tint
@@ -148,6 +148,69 @@ TEST_F(BlockAllocatorTest, MoveAssign) {
     }
 }
 
+TEST_F(BlockAllocatorTest, Arena) {
+    using Allocator = BlockAllocator<LifetimeCounter>;
+
+    for (size_t n : {0u, 1u, 10u, 100u, 10000u}) {
+        size_t count = 0;
+        BumpAllocator arena;
+        {
+            Allocator allocator_a{arena};
+            Allocator allocator_b{arena};
+            for (size_t i = 0; i < n; i++) {
+                allocator_a.Create(&count);
+                allocator_b.Create(&count);
+            }
+            EXPECT_EQ(count, 2 * n);
+            EXPECT_EQ(allocator_a.Count(), n);
+            EXPECT_EQ(allocator_b.Count(), n);
+            if (n > 0) {
+                EXPECT_GT(arena.BytesReserved(), 0u);
+            } else {
+                EXPECT_EQ(arena.BytesReserved(), 0u);
+            }
+        }
+        // The objects are destructed with the allocators, but the arena still holds the memory.
+        EXPECT_EQ(count, 0u);
+        EXPECT_EQ(arena.BytesReserved() > 0, n > 0);
+    }
+}
+
+TEST_F(BlockAllocatorTest, ArenaMoveAssign) {
+    using Allocator = BlockAllocator<LifetimeCounter>;
+
+    size_t count_a = 0;
+    size_t count_b = 0;
+    BumpAllocator arena_a;
+    BumpAllocator arena_b;
+    {
+        Allocator allocator_a{arena_a};
+        for (size_t i = 0; i < 100; i++) {
+            allocator_a.Create(&count_a);
+        }
+
+        Allocator allocator_b{arena_b};
+        for (size_t i = 0; i < 100; i++) {
+            allocator_b.Create(&count_b);
+        }
+
+        allocator_b = std::move(allocator_a);
+        EXPECT_EQ(count_a, 100u);
+        EXPECT_EQ(count_b, 0u);
+
+        // New allocations come from the arena of the moved allocator.
+        size_t reserved_a = arena_a.BytesReserved();
+        size_t reserved_b = arena_b.BytesReserved();
+        for (size_t i = 0; i < 10000; i++) {
+            allocator_b.Create(&count_a);
+        }
+        EXPECT_GT(arena_a.BytesReserved(), reserved_a);
+        EXPECT_EQ(arena_b.BytesReserved(), reserved_b);
+    }
+    EXPECT_EQ(count_a, 0u);
+    EXPECT_EQ(count_b, 0u);
+}
+
 TEST_F(BlockAllocatorTest, ObjectOrder) {
     using Allocator = BlockAllocator<int>;
 
@@ -31,8 +31,10 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <new>
+#include <type_traits>
 #include <utility>
 
 #include "src/tint/utils/macros/compiler.h"
@@ -51,6 +53,9 @@ namespace tint {
 
 /// A allocator for chunks of memory. The memory is owned by the BumpAllocator. When the
 /// BumpAllocator is freed all of the allocated memory is freed.
+///
+/// A BumpAllocator can be used as an arena for a single compilation, backing other allocators
+/// such as BlockAllocator, so that all of their memory is released together.
 class BumpAllocator {
     /// BlockHeader is linked list of memory blocks.
     /// Blocks are allocated out of heap memory.
@@ -63,6 +68,11 @@ class BumpAllocator {
     /// allocations will use this size.
     static constexpr size_t kDefaultBlockDataSize = 64 * 1024;
 
+    /// The maximum size for a block's data, unless a single allocation requires a larger block.
+    /// Each new block is twice the size of the last, up to this size, so that large arenas need
+    /// few heap allocations.
+    static constexpr size_t kMaxBlockDataSize = 1024 * 1024;
+
     /// Constructor
     BumpAllocator() = default;
 
@@ -87,37 +97,47 @@ class BumpAllocator {
     /// Allocates @p size_in_bytes from the current block, or from a newly allocated block if the
     /// current block is full.
     /// @param size_in_bytes the number of bytes to allocate
+    /// @param alignment the alignment of the returned pointer. Must be a power of two.
     /// @returns the pointer to the allocated memory or `nullptr` if the memory can not be allocated
-    std::byte* Allocate(size_t size_in_bytes) {
-        if (DAWN_UNLIKELY(data.current_offset + size_in_bytes < size_in_bytes)) {
+    std::byte* Allocate(size_t size_in_bytes, size_t alignment = 1) {
+        if (DAWN_UNLIKELY(size_in_bytes + alignment < size_in_bytes)) {
+            return nullptr;  // integer overflow
+        }
+        size_t padding = Padding(alignment);
+        if (DAWN_UNLIKELY(data.current_offset + padding + size_in_bytes < size_in_bytes)) {
             return nullptr;  // integer overflow
         }
-        if (data.current_offset + size_in_bytes > data.current_data_size) {
-            // Allocate a new block from the heap
-            auto* prev_block = data.current;
-            size_t data_size = std::max(size_in_bytes, kDefaultBlockDataSize);
-            data.current = Bitcast<BlockHeader*>(new (std::nothrow)
-                                                     std::byte[sizeof(BlockHeader) + data_size]);
-            if (DAWN_UNLIKELY(!data.current)) {
+        if (data.current_offset + padding + size_in_bytes > data.current_data_size) {
+            // Allocate a new block from the heap, with enough space to align the allocation.
+            if (DAWN_UNLIKELY(!NewBlock(size_in_bytes + alignment - 1))) {
                 return nullptr;  // out of memory
             }
-            data.current->next = nullptr;
-            data.current_data_size = data_size;
-            data.current_offset = 0;
-            if (prev_block) {
-                prev_block->next = data.current;
-            } else {
-                data.root = data.current;
-            }
+            padding = Padding(alignment);
         }
 
-        auto* base = Bitcast<std::byte*>(data.current) + sizeof(BlockHeader);
-        auto* ptr = base + data.current_offset;
-        data.current_offset += size_in_bytes;
+        auto* ptr = Base() + data.current_offset + padding;
+        data.current_offset += padding + size_in_bytes;
+        data.bytes_allocated += size_in_bytes;
         data.count++;
         return ptr;
     }
 
+    /// Constructs a new `T` in memory owned by the BumpAllocator.
+    /// The destructor of the object is never called, so `T` must be trivially destructible.
+    /// @param args the arguments to pass to the constructor
+    /// @returns the pointer to the constructed object, or `nullptr` if the memory can not be
+    /// allocated
+    template <typename T, typename... ARGS>
+    T* Create(ARGS&&... args) {
+        static_assert(std::is_trivially_destructible_v<T>,
+                      "BumpAllocator does not call destructors");
+        auto* ptr = Allocate(sizeof(T), alignof(T));
+        if (DAWN_UNLIKELY(!ptr)) {
+            return nullptr;
+        }
+        return new (ptr) T(std::forward<ARGS>(args)...);
+    }
+
     /// Frees all allocations from the allocator.
     void Reset() {
         auto* block = data.root;
@@ -132,10 +152,59 @@ class BumpAllocator {
     /// @returns the total number of allocations
     size_t Count() const { return data.count; }
 
+    /// @returns the total number of bytes requested by all allocations, excluding padding
+    size_t BytesAllocated() const { return data.bytes_allocated; }
+
+    /// @returns the total number of bytes of heap memory held by the allocator. As memory is only
+    /// released by Reset(), this is also the peak memory usage of the allocator.
+    size_t BytesReserved() const { return data.bytes_reserved; }
+
   private:
     BumpAllocator(const BumpAllocator&) = delete;
     BumpAllocator& operator=(const BumpAllocator&) = delete;
 
+    /// @returns the start of the data of the current block
+    std::byte* Base() const {
+        return data.current ? Bitcast<std::byte*>(data.current) + sizeof(BlockHeader) : nullptr;
+    }
+
+    /// @returns the number of bytes required to align the next allocation to @p alignment
+    size_t Padding(size_t alignment) const {
+        auto address = Bitcast<uintptr_t>(Base() + data.current_offset);
+        return tint::RoundUp<uintptr_t>(alignment, address) - address;
+    }
+
+    /// Appends a new block to the block linked list.
+    /// @param min_data_size the minimum size of the block's data
+    /// @returns true on success, false if the block could not be allocated
+    bool NewBlock(size_t min_data_size) {
+        size_t data_size = kDefaultBlockDataSize;
+        if (data.current) {
+            data_size = std::min(data.current_data_size * 2, kMaxBlockDataSize);
+        }
+        data_size = std::max(data_size, min_data_size);
+        if (DAWN_UNLIKELY(data_size + sizeof(BlockHeader) < data_size)) {
+            return false;  // integer overflow
+        }
+
+        auto* block = Bitcast<BlockHeader*>(new (std::nothrow)
+                                                std::byte[sizeof(BlockHeader) + data_size]);
+        if (DAWN_UNLIKELY(!block)) {
+            return false;
+        }
+        block->next = nullptr;
+        if (data.current) {
+            data.current->next = block;
+        } else {
+            data.root = block;
+        }
+        data.current = block;
+        data.current_data_size = data_size;
+        data.current_offset = 0;
+        data.bytes_reserved += sizeof(BlockHeader) + data_size;
+        return true;
+    }
+
     struct {
         /// The root block of the block linked list
         BlockHeader* root = nullptr;
@@ -148,6 +217,10 @@ class BumpAllocator {
         size_t current_data_size = 0;
         /// Total number of allocations
         size_t count = 0;
+        /// Total number of bytes requested by allocations
+        size_t bytes_allocated = 0;
+        /// Total number of bytes of heap memory held by the blocks, including the headers
+        size_t bytes_reserved = 0;
     } data;
 };
 
@@ -83,5 +83,65 @@ TEST_F(BumpAllocatorTest, MoveConstruct) {
     }
 }
 
+TEST_F(BumpAllocatorTest, Alignment) {
+    BumpAllocator allocator;
+    for (size_t alignment : {1u, 2u, 4u, 8u, 16u, 64u, 256u, 4096u}) {
+        allocator.Allocate(3);
+        auto* ptr = allocator.Allocate(7, alignment);
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_EQ(Bitcast<uintptr_t>(ptr) % alignment, 0u);
+        memset(ptr, 0x42, 7);
+    }
+}
+
+TEST_F(BumpAllocatorTest, Create) {
+    struct S {
+        uint8_t a;
+        uint64_t b;
+    };
+
+    BumpAllocator allocator;
+    allocator.Allocate(1);
+    auto* s = allocator.Create<S>(S{1, 2});
+    ASSERT_NE(s, nullptr);
+    EXPECT_EQ(Bitcast<uintptr_t>(s) % alignof(S), 0u);
+    EXPECT_EQ(s->a, 1u);
+    EXPECT_EQ(s->b, 2u);
+    EXPECT_EQ(allocator.Count(), 2u);
+}
+
+TEST_F(BumpAllocatorTest, Bytes) {
+    BumpAllocator allocator;
+    EXPECT_EQ(allocator.BytesAllocated(), 0u);
+    EXPECT_EQ(allocator.BytesReserved(), 0u);
+
+    allocator.Allocate(10);
+    allocator.Allocate(20);
+    EXPECT_EQ(allocator.BytesAllocated(), 30u);
+    size_t reserved = allocator.BytesReserved();
+    EXPECT_GE(reserved, BumpAllocator::kDefaultBlockDataSize);
+
+    // Fill the first block, and check the next block is larger.
+    allocator.Allocate(BumpAllocator::kDefaultBlockDataSize - 30);
+    EXPECT_EQ(allocator.BytesReserved(), reserved);
+    allocator.Allocate(1);
+    EXPECT_GE(allocator.BytesReserved(), reserved + 2 * BumpAllocator::kDefaultBlockDataSize);
+
+    allocator.Reset();
+    EXPECT_EQ(allocator.BytesAllocated(), 0u);
+    EXPECT_EQ(allocator.BytesReserved(), 0u);
+}
+
+TEST_F(BumpAllocatorTest, BlockSizeLimit) {
+    BumpAllocator allocator;
+    size_t reserved = 0;
+    for (size_t i = 0; i < 16; i++) {
+        allocator.Allocate(BumpAllocator::kMaxBlockDataSize / 2 + 1);
+        size_t block_size = allocator.BytesReserved() - reserved;
+        EXPECT_LE(block_size, BumpAllocator::kMaxBlockDataSize + sizeof(void*));
+        reserved = allocator.BytesReserved();
+    }
+}
+
 }  // namespace
 }  // namespace tint